@@ -0,0 +1,428 @@
+#!/usr/bin/env ucode
+/*
+ * Copyright (c) 2025 Jo-Philipp Wich <jo@mein.io>.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+'use strict';
+
+import { readfile } from 'fs';
+import { pack, unpack, buffer } from 'struct';
+import * as uloop from 'uloop';
+
+import cmdu from 'umap.cmdu';
+import defs from 'umap.defs';
+import utils from 'umap.utils';
+import * as codec from 'umap.tlv.codec';
+
+/*
+ * Micro-benchmark for the CMDU parser and the TLV codec. Frames are either
+ * read from classic pcap captures or produced by a deterministic generator
+ * covering worst case messages, then replayed through cmdu.parse(), the
+ * message get_tlvs() call and each TLV decoder and encoder.
+ *
+ * Allocation counts are the number of ucode values created per operation
+ * as reported by the garbage collector, buffers allocated by native code
+ * are not accounted for.
+ */
+
+const ETHERTYPE_IEEE1905 = 0x893a;
+const IEEE1905_HEADER_LENGTH = 8;
+const ETHERTYPE_VLAN = 0x8100;
+
+const LINKTYPE_ETHERNET = 1;
+const LINKTYPE_LINUX_SLL = 113;
+
+const PCAP_MAGIC_USEC = 0xa1b2c3d4;
+const PCAP_MAGIC_NSEC = 0xa1b23c4d;
+
+const BENCH_DEFAULT_ITERATIONS = 10000;
+
+const SYNTH_SRCMAC = '02:00:00:00:be:ec';
+const SYNTH_NEIGHBORS = 200;
+const SYNTH_NON1905_NEIGHBORS = 240;
+const SYNTH_NEIGHBOR_TLVS = 8;
+const SYNTH_SCAN_RESULTS = 16;
+const SYNTH_SCAN_NEIGHBORS = 48;
+const SYNTH_VENDOR_LENGTH = 16384;
+
+function usage() {
+	warn(`Usage: ${SCRIPT_NAME} [-n iterations] [-s] [-j] [capture.pcap ...]\n`,
+	     `  -n  Number of operations per measurement (default ${BENCH_DEFAULT_ITERATIONS})\n`,
+	     `  -s  Include synthetic worst case messages\n`,
+	     `  -j  Emit results as JSON\n`);
+	exit(1);
+}
+
+function synth_mac(prefix, n) {
+	return pack('!BBBBH', 0x02, prefix, 0, (n >> 16) & 0xff, n & 0xffff);
+}
+
+function read_pcap(path) {
+	const data = readfile(path);
+
+	if (data == null || length(data) < 24)
+		die(`Unable to read pcap file ${path}\n`);
+
+	let endian;
+
+	for (let e in [ '<', '>' ]) {
+		if (unpack(`${e}I`, data)[0] in [ PCAP_MAGIC_USEC, PCAP_MAGIC_NSEC ]) {
+			endian = e;
+			break;
+		}
+	}
+
+	if (!endian)
+		die(`${path}: Not a pcap file (pcapng is not supported)\n`);
+
+	const linktype = unpack(`${endian}I`, data, 20)[0];
+
+	if (!(linktype in [ LINKTYPE_ETHERNET, LINKTYPE_LINUX_SLL ]))
+		die(`${path}: Unsupported link type ${linktype}\n`);
+
+	const frames = [];
+
+	for (let off = 24; off + 16 <= length(data);) {
+		const caplen = unpack(`${endian}8xI`, data, off)[0];
+		const frame = substr(data, off + 16, caplen);
+		let srcmac, ethertype, hdrlen;
+
+		off += 16 + caplen;
+
+		if (linktype == LINKTYPE_ETHERNET) {
+			srcmac = utils.ether_ntoa(frame, 6);
+			ethertype = unpack('!H', frame, 12)?.[0];
+			hdrlen = 14;
+		}
+		else {
+			srcmac = utils.ether_ntoa(frame, 6);
+			ethertype = unpack('!H', frame, 14)?.[0];
+			hdrlen = 16;
+		}
+
+		if (ethertype == ETHERTYPE_VLAN) {
+			ethertype = unpack('!H', frame, hdrlen + 2)?.[0];
+			hdrlen += 4;
+		}
+
+		if (ethertype == ETHERTYPE_IEEE1905 && srcmac != null)
+			push(frames, { srcmac, payload: substr(frame, hdrlen) });
+	}
+
+	return frames;
+}
+
+/* fragment the message and make sure it reassembles to the same TLV stream */
+function synth_frames(msg) {
+	const payloads = msg.fragments();
+	let parsed;
+
+	for (let payload in payloads)
+		parsed = cmdu.parse(SYNTH_SRCMAC, payload);
+
+	if (!parsed?.is_complete() ||
+	    parsed.buf.slice(IEEE1905_HEADER_LENGTH) !== msg.buf.slice(IEEE1905_HEADER_LENGTH))
+		die(sprintf('Synthetic CMDU type 0x%04x does not survive a fragments() and parse() round trip\n', msg.type));
+
+	return map(payloads, (payload) => ({ srcmac: SYNTH_SRCMAC, payload }));
+}
+
+function synth_topology_response() {
+	const msg = cmdu.create(defs.MSG_TOPOLOGY_RESPONSE, 0xb001);
+
+	msg.add_tlv_raw(defs.TLV_IEEE1905_AL_MAC_ADDRESS, synth_mac(0x10, 0));
+
+	for (let t = 0; t < SYNTH_NEIGHBOR_TLVS; t++) {
+		let payload = synth_mac(0x20, t);
+
+		for (let n = 0; n < SYNTH_NEIGHBORS; n++)
+			payload += synth_mac(0x30 + t, n) + pack('B', (n & 1) ? 0x80 : 0x00);
+
+		msg.add_tlv_raw(defs.TLV_IEEE1905_NEIGHBOR_DEVICES, payload);
+
+		payload = synth_mac(0x20, t);
+
+		for (let n = 0; n < SYNTH_NON1905_NEIGHBORS; n++)
+			payload += synth_mac(0x60 + t, n);
+
+		msg.add_tlv_raw(defs.TLV_NON_IEEE1905_NEIGHBOR_DEVICES, payload);
+	}
+
+	return synth_frames(msg);
+}
+
+function synth_scan_report() {
+	const msg = cmdu.create(defs.MSG_CHANNEL_SCAN_REPORT, 0xb002);
+	const timestamp = '2025-01-01T00:00:00.000000Z';
+
+	msg.add_tlv_raw(defs.TLV_TIMESTAMP, pack('!B*', length(timestamp), timestamp));
+
+	for (let r = 0; r < SYNTH_SCAN_RESULTS; r++) {
+		let payload = synth_mac(0x40, r) +
+			pack('!BBBB*BBH', 128, 36 + (r % 8) * 4, 0, length(timestamp), timestamp,
+				r * 7 % 256, 160, SYNTH_SCAN_NEIGHBORS);
+
+		for (let n = 0; n < SYNTH_SCAN_NEIGHBORS; n++)
+			payload += synth_mac(0x50, r * SYNTH_SCAN_NEIGHBORS + n) +
+				pack('!B32sBB*BBH', 32, sprintf('bench-network-%04d-%04d-xxxxxxxx', r, n),
+					(n * 3) % 220, 2, '80', 0x80, n % 256, n);
+
+		payload += pack('!LB', 1000 + r, 0x80);
+
+		msg.add_tlv_raw(defs.TLV_CHANNEL_SCAN_RESULT, payload);
+	}
+
+	return synth_frames(msg);
+}
+
+function synth_fragmented() {
+	const msg = cmdu.create(defs.MSG_VENDOR_SPECIFIC, 0xb003);
+	let payload = '\x00\x11\x22';
+
+	for (let i = 0; length(payload) < SYNTH_VENDOR_LENGTH; i++)
+		payload += pack('!L', i);
+
+	msg.add_tlv_raw(defs.TLV_VENDOR_SPECIFIC, payload);
+
+	return synth_frames(msg);
+}
+
+function measure(iterations, fn) {
+	gc('collect');
+	gc('stop');
+
+	const objects = gc('count');
+	const t0 = clock(true);
+
+	for (let i = 0; i < iterations; i++)
+		fn(i);
+
+	const t1 = clock(true);
+	const allocs = gc('count') - objects;
+
+	gc('start');
+
+	const ns = (t1[0] - t0[0]) * 1000000000 + (t1[1] - t0[1]);
+
+	return { iterations, ns_op: ns / iterations, allocs_op: allocs / iterations };
+}
+
+function result(name, bytes, iterations, fn) {
+	const res = measure(iterations, fn);
+
+	res.name = name;
+	res.bytes_op = bytes;
+	res.mb_s = res.ns_op ? (bytes * 1000) / res.ns_op : 0;
+
+	return res;
+}
+
+function decode_raw(type, payload) {
+	if (type !== defs.TLV_EXTENDED)
+		return codec.find_decoder(type)?.(buffer(payload), length(payload));
+
+	const buf = buffer(payload);
+	const subtype = buf.get('!H');
+
+	return codec.find_extended_decoder(subtype)?.(buf, length(payload));
+}
+
+function encode_raw(type, subtype, data) {
+	if (type !== defs.TLV_EXTENDED)
+		return codec.find_encoder(type)?.(buffer(), data)?.pull?.();
+
+	return codec.find_extended_encoder(subtype)?.(buffer(), data)?.pull?.();
+}
+
+function run(frames, sources, iterations) {
+	const results = [];
+	const messages = [];
+	const samples = {};
+	let total = 0;
+
+	for (let frame in frames)
+		total += length(frame.payload);
+
+	/* replay whole capture rounds so fragmented messages always complete */
+	const rounds = max(1, int(iterations / length(frames)));
+
+	push(results, result('cmdu.parse', total / length(frames), rounds * length(frames), (i) => {
+		const frame = frames[i % length(frames)];
+
+		cmdu.parse(frame.srcmac, frame.payload);
+	}));
+
+	for (let frame in frames) {
+		const msg = cmdu.parse(frame.srcmac, frame.payload);
+
+		if (msg?.is_complete()) {
+			msg.source = sources[frame.source];
+			msg.source.messages++;
+			push(messages, msg);
+		}
+	}
+
+	for (let msg in messages) {
+		let decodable = true;
+
+		for (let tlv in msg.get_tlvs_raw()) {
+			if (tlv.type == defs.TLV_END_OF_MESSAGE)
+				continue;
+
+			const subtype = (tlv.type === defs.TLV_EXTENDED) ? unpack('!H', tlv.payload)?.[0] : null;
+			const key = (subtype != null) ? sprintf('0x%02x/0x%04x', tlv.type, subtype) : sprintf('0x%02x', tlv.type);
+
+			if (decode_raw(tlv.type, tlv.payload) == null) {
+				decodable = false;
+				continue;
+			}
+
+			push(samples[key] ??= [], { type: tlv.type, subtype, payload: tlv.payload });
+		}
+
+		msg.decodable = decodable;
+
+		if (decodable)
+			msg.source.decodable++;
+	}
+
+	/* synthetic messages must always make it into the measurements */
+	for (let src in sources)
+		if (src.synthetic && (src.messages == 0 || src.decodable < src.messages))
+			die(`${src.source}: only ${src.decodable} of ${src.messages} messages are decodable\n`);
+
+	const decodable = filter(messages, (msg) => msg.decodable);
+
+	if (length(decodable)) {
+		let size = 0;
+
+		for (let msg in decodable)
+			size += msg.buf.length();
+
+		push(results, result('cmdu.get_tlvs', size / length(decodable), iterations,
+			(i) => decodable[i % length(decodable)].get_tlvs()));
+	}
+
+	for (let key in sort(keys(samples))) {
+		const list = samples[key];
+		const name = utils.tlv_type_ntoa(list[0].type) ?? key;
+		let size = 0;
+
+		for (let s in list) {
+			size += length(s.payload);
+			s.data = decode_raw(s.type, s.payload);
+		}
+
+		push(results, result(`decode ${key} ${name}`, size / length(list), iterations, (i) => {
+			const s = list[i % length(list)];
+
+			decode_raw(s.type, s.payload);
+		}));
+
+		/* decoders may return structures the encoder does not accept back */
+		if (encode_raw(list[0].type, list[0].subtype, list[0].data) == null)
+			continue;
+
+		push(results, result(`encode ${key} ${name}`, size / length(list), iterations, (i) => {
+			const s = list[i % length(list)];
+
+			encode_raw(s.type, s.subtype, s.data);
+		}));
+	}
+
+	return results;
+}
+
+let iterations = BENCH_DEFAULT_ITERATIONS;
+let synthetic = false;
+let json = false;
+let frames = [];
+let sources = [];
+
+for (let i = 0; i < length(ARGV); i++) {
+	switch (ARGV[i]) {
+	case '-n':
+		iterations = +ARGV[++i];
+
+		if (!(iterations > 0))
+			usage();
+
+		break;
+
+	case '-s':
+		synthetic = true;
+		break;
+
+	case '-j':
+		json = true;
+		break;
+
+	case '-h':
+	case '--help':
+		usage();
+		break;
+
+	default:
+		let captured = read_pcap(ARGV[i]);
+
+		for (let frame in captured)
+			frame.source = length(sources);
+
+		push(sources, { source: ARGV[i], frames: length(captured), messages: 0, decodable: 0 });
+		push(frames, ...captured);
+		break;
+	}
+}
+
+if (!synthetic && !length(frames))
+	usage();
+
+uloop.init();
+
+if (synthetic) {
+	for (let gen in [
+		[ 'synthetic:max-neighbors', synth_topology_response ],
+		[ 'synthetic:max-scan-results', synth_scan_report ],
+		[ 'synthetic:fragmented', synth_fragmented ]
+	]) {
+		const generated = gen[1]();
+
+		for (let frame in generated)
+			frame.source = length(sources);
+
+		push(sources, { source: gen[0], synthetic: true, frames: length(generated), messages: 0, decodable: 0 });
+		push(frames, ...generated);
+	}
+}
+
+if (!length(frames))
+	die('No IEEE 1905.1 frames found in input\n');
+
+const results = run(frames, sources, iterations);
+
+if (json) {
+	printf('%.J\n', { iterations, sources, results });
+}
+else {
+	for (let src in sources)
+		printf('# %s: %d frames, %d messages, %d benchmarked\n',
+			src.source, src.frames, src.messages, src.decodable);
+
+	printf('%-48s %10s %12s %10s %10s\n', 'benchmark', 'ops', 'ns/op', 'MB/s', 'allocs/op');
+
+	for (let res in results)
+		printf('%-48s %10d %12.1f %10.2f %10.1f\n',
+			res.name, res.iterations, res.ns_op, res.mb_s, res.allocs_op);
+}
@@ -16,6 +16,26 @@
 #define ETH_P_1905	0x893a
 #endif
 
+#define CMDU_F_ISRELAY		0x40
+#define RELAY_DEDUP_TIMEOUT	(60ULL * 1000000000ULL)
+
+struct cmdu_hdr {
+	u8 version;
+	u8 __reserved;
+	__be16 type;
+	__be16 mid;
+	u8 fid;
+	u8 flags;
+};
+
+struct umapsocket_relay_key {
+	u8 addr[ETH_ALEN];
+	__be16 type;
+	__be16 mid;
+	u8 fid;
+	u8 __pad;
+};
+
 struct umapsocket_addr_key {
 	__be16 proto;
 	u8 addr[ETH_ALEN];
@@ -37,7 +57,30 @@ struct umapsocket_stats {
 		struct umapsocket_stats_type unicast;
 		struct umapsocket_stats_type multicast;
 		struct umapsocket_stats_type broadcast;
+		struct umapsocket_stats_type ieee1905;
+		struct umapsocket_stats_type lldp;
 	} rx, tx;
+	u64 relay_duplicates;
+	u64 cmdu_stats_dropped;
+};
+
+/*
+ * Counters are sharded per CPU within an ordinary hash to avoid contention,
+ * userspace reads them with plain lookups and sums up the shards. Programs
+ * may still be migrated between CPUs on preemptible kernels, so the counters
+ * are updated atomically nonetheless.
+ */
+struct umapsocket_stats_key {
+	u32 ifindex;
+	u32 cpu;
+};
+
+struct umapsocket_cmdu_stats_key {
+	u32 ifindex;
+	u32 cpu;
+	u16 type;
+	u8 tx;
+	u8 __pad;
 };
 
 struct {
@@ -50,38 +93,159 @@ struct {
 
 struct {
 	__uint(type, BPF_MAP_TYPE_HASH);
-	__type(key, __u32);
+	__type(key, struct umapsocket_stats_key);
 	__type(value, struct umapsocket_stats);
-	__uint(max_entries, 128);
+	__uint(max_entries, 1024);
 	__uint(map_flags, BPF_F_NO_PREALLOC);
 } stats_map SEC(".maps");
 
+struct {
+	__uint(type, BPF_MAP_TYPE_HASH);
+	__type(key, struct umapsocket_cmdu_stats_key);
+	__type(value, struct umapsocket_stats_type);
+	__uint(max_entries, 4096);
+	__uint(map_flags, BPF_F_NO_PREALLOC);
+} cmdu_stats_map SEC(".maps");
+
+struct {
+	__uint(type, BPF_MAP_TYPE_LRU_HASH);
+	__type(key, struct umapsocket_relay_key);
+	__type(value, u64);
+	__uint(max_entries, 1024);
+} relay_map SEC(".maps");
+
+static __always_inline struct umapsocket_stats *
+stats_lookup(u32 ifindex)
+{
+	struct umapsocket_stats_key key = {
+		.ifindex = ifindex,
+		.cpu = bpf_get_smp_processor_id()
+	};
+
+	return bpf_map_lookup_elem(&stats_map, &key);
+}
+
+static __always_inline void
+stats_count(struct umapsocket_stats_type *stype, u32 len)
+{
+	__sync_fetch_and_add(&stype->packets, 1);
+	__sync_fetch_and_add(&stype->bytes, len);
+}
+
+static __always_inline void
+stats_count_addr(struct __sk_buff *skb, u32 *data, bool tx,
+                 struct umapsocket_stats *stats)
+{
+	struct umapsocket_stats_type *stype;
+
+	if (!(data[0] & 1))
+		stype = tx ? &stats->tx.unicast : &stats->rx.unicast;
+	else if (*data == 0xffffffff && *(uint16_t *)&data[1] == 0xffff)
+		stype = tx ? &stats->tx.broadcast : &stats->rx.broadcast;
+	else
+		stype = tx ? &stats->tx.multicast : &stats->rx.multicast;
+
+	stats_count(stype, skb->len);
+}
+
+static __always_inline void
+stats_count_proto(struct __sk_buff *skb, struct skb_parser_info *info,
+                  bool tx, struct umapsocket_stats *stats)
+{
+	struct umapsocket_cmdu_stats_key key = {};
+	struct umapsocket_stats_type *stype, zero = {};
+	struct cmdu_hdr *hdr;
+
+	if (info->proto == bpf_htons(ETH_P_LLDP)) {
+		stats_count(tx ? &stats->tx.lldp : &stats->rx.lldp, skb->len);
+		return;
+	}
+
+	if (info->proto != bpf_htons(ETH_P_1905))
+		return;
+
+	stats_count(tx ? &stats->tx.ieee1905 : &stats->rx.ieee1905, skb->len);
+
+	hdr = skb_ptr(skb, info->offset, sizeof(*hdr));
+	if (!hdr)
+		return;
+
+	key.ifindex = skb->ifindex;
+	key.cpu = bpf_get_smp_processor_id();
+	key.type = bpf_ntohs(hdr->type);
+	key.tx = tx;
+
+	/* the map is bounded, count the frames not accounted once it is full */
+	stype = bpf_map_lookup_elem(&cmdu_stats_map, &key);
+	if (!stype) {
+		bpf_map_update_elem(&cmdu_stats_map, &key, &zero, BPF_NOEXIST);
+		stype = bpf_map_lookup_elem(&cmdu_stats_map, &key);
+		if (!stype) {
+			__sync_fetch_and_add(&stats->cmdu_stats_dropped, 1);
+			return;
+		}
+	}
+
+	stats_count(stype, skb->len);
+}
+
+static __always_inline bool
+relay_is_duplicate(struct __sk_buff *skb, struct skb_parser_info *info)
+{
+	struct umapsocket_relay_key key = {};
+	struct cmdu_hdr *hdr;
+	u64 now, *seen;
+	u8 *eth;
+
+	hdr = skb_ptr(skb, info->offset, sizeof(*hdr));
+	if (!hdr || !(hdr->flags & CMDU_F_ISRELAY))
+		return false;
+
+	eth = skb_ptr(skb, 0, 2 * ETH_ALEN);
+	if (!eth)
+		return false;
+
+	memcpy(key.addr, eth + ETH_ALEN, ETH_ALEN);
+	key.type = hdr->type;
+	key.mid = hdr->mid;
+	key.fid = hdr->fid;
+
+	now = bpf_ktime_get_ns();
+	seen = bpf_map_lookup_elem(&relay_map, &key);
+
+	if (seen && now - *seen < RELAY_DEDUP_TIMEOUT)
+		return true;
+
+	bpf_map_update_elem(&relay_map, &key, &now, BPF_ANY);
+
+	return false;
+}
+
 SEC("tc")
 int egress(struct __sk_buff *skb)
 {
-	struct umapsocket_stats_type *stype;
 	struct umapsocket_stats *stats;
-	u32 ifindex = skb->ifindex;
+	struct skb_parser_info info;
 	u32 *data;
 
+	stats = stats_lookup(skb->ifindex);
+	if (!stats)
+		return TC_ACT_UNSPEC;
+
 	data = skb_ptr(skb, 0, ETH_ALEN);
 	if (!data)
 		return TC_ACT_UNSPEC;
 
-	stats = bpf_map_lookup_elem(&stats_map, &ifindex);
-	if (stats) {
-		uint8_t *addr = (uint8_t *)data;
+	stats_count_addr(skb, data, true, stats);
 
-		if (!(data[0] & 1))
-			stype = &stats->tx.unicast;
-		else if (*data == 0xffffffff && *(uint16_t *)&data[1] == 0xffff)
-			stype = &stats->tx.broadcast;
-		else
-			stype = &stats->tx.multicast;
+	skb_parse_init(&info, skb);
+	if (!skb_parse_ethernet(&info))
+		return TC_ACT_UNSPEC;
 
-		__sync_fetch_and_add(&stype->packets, 1);
-		__sync_fetch_and_add(&stype->bytes, skb->len);
-	}
+	skb_parse_vlan(&info);
+	skb_parse_vlan(&info);
+
+	stats_count_proto(skb, &info, true, stats);
 
 	return TC_ACT_UNSPEC;
 }
@@ -89,7 +253,6 @@ int egress(struct __sk_buff *skb)
 SEC("tc")
 int ingress(struct __sk_buff *skb)
 {
-	struct umapsocket_stats_type *stype;
 	struct umapsocket_stats *stats;
 	struct umapsocket_addr_key key;
 	struct umapsocket_addr_val *val;
@@ -116,25 +279,17 @@ int ingress(struct __sk_buff *skb)
 	if (!data)
 		return TC_ACT_UNSPEC;
 
-	stats = bpf_map_lookup_elem(&stats_map, &ifindex);
-	if (stats) {
-		uint8_t *addr = (uint8_t *)data;
-
-		if (!(data[0] & 1))
-			stype = &stats->rx.unicast;
-		else if (*data == 0xffffffff && *(uint16_t *)&data[1] == 0xffff)
-			stype = &stats->rx.broadcast;
-		else
-			stype = &stats->rx.multicast;
-
-		__sync_fetch_and_add(&stype->packets, 1);
-		__sync_fetch_and_add(&stype->bytes, skb->len);
-	}
+	stats = stats_lookup(ifindex);
+	if (stats)
+		stats_count_addr(skb, data, false, stats);
 
 	if (info.proto != bpf_htons(ETH_P_LLDP) &&
 		info.proto != bpf_htons(ETH_P_1905))
 		return TC_ACT_UNSPEC;
 
+	if (stats)
+		stats_count_proto(skb, &info, false, stats);
+
 	data = skb_ptr(skb, 0, sizeof(key));
 	if (!data)
 		return TC_ACT_UNSPEC;
@@ -146,6 +301,14 @@ int ingress(struct __sk_buff *skb)
 	if (!val)
 		return TC_ACT_UNSPEC;
 
+	/* drop relayed multicast CMDUs we already passed up recently */
+	if (info.proto == bpf_htons(ETH_P_1905) && relay_is_duplicate(skb, &info)) {
+		if (stats)
+			__sync_fetch_and_add(&stats->relay_duplicates, 1);
+
+		return TC_ACT_SHOT;
+	}
+
 	addr_index = val->index;
 	clone = val->clone;
 	bpf_skb_store_bytes(skb, 0, &ifindex, 4, 0);
@@ -0,0 +1,707 @@
+#!/usr/bin/env ucode
+/*
+ * Copyright (c) 2025 Jo-Philipp Wich <jo@mein.io>.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+'use strict';
+
+import { popen, readfile, lsdir } from 'fs';
+import * as uloop from 'uloop';
+
+import socket from 'umap.socket';
+import cmdu from 'umap.cmdu';
+import defs from 'umap.defs';
+import log from 'umap.log';
+
+import * as wsc from 'umap.wsc';
+import * as wconst from 'umap.wireless';
+
+/*
+ * Mesh emulator for controller load and convergence testing. A bridge with
+ * one veth pair for the controller and one veth pair per group of agents is
+ * set up on the local host, optionally shaping controller traffic through
+ * netem on the veth egress and an ifb device for the ingress direction.
+ *
+ * Each synthetic agent owns an AL MAC, one backhaul interface and one radio
+ * and answers the controller's topology, link metric, higher layer and
+ * capability queries and runs AP auto-configuration up to the M2 exchange.
+ * The controller is a real umapd instance attached to the controller veth,
+ * its CPU time and memory usage are sampled from procfs.
+ *
+ * Requires root privileges, iproute2 and, for link shaping, the ifb and
+ * sch_netem kernel modules.
+ */
+
+const EMU_PREFIX = 'emu';
+const EMU_BRIDGE = `${EMU_PREFIX}-br`;
+const EMU_CONTROLLER_IF = `${EMU_PREFIX}-ctl`;
+const EMU_IFB = `${EMU_PREFIX}-ifb`;
+const EMU_CONTROLLER_MAC = '02:ee:ff:00:00:01';
+
+const EMU_DEFAULT_AGENTS = 50;
+const EMU_DEFAULT_AGENTS_PER_LINK = 1;
+const EMU_DEFAULT_RAMP = 20;
+const EMU_DEFAULT_TIMEOUT = 300000;
+const EMU_DEFAULT_SETTLE = 10000;
+
+const AGENT_DISCOVERY_INTERVAL = 60000;
+const AGENT_AUTOCONF_DELAY = 1000;
+const AGENT_AUTOCONF_RETRY = 5000;
+
+const SAMPLE_INTERVAL = 1000;
+
+/* milestones an agent has to pass before it counts as converged */
+const MILESTONES = [
+	'discovered',
+	'topology',
+	'link_metrics',
+	'higher_layer',
+	'bsta_capabilities',
+	'ap_capabilities',
+	'autoconf_response',
+	'configured'
+];
+
+const emu = {
+	links: [],
+	agents: [],
+	by_address: {},
+	controller: null,
+	converged: 0,
+	started: 0,
+	rx: 0,
+	tx: 0,
+	rx_types: {},
+	tx_types: {},
+	samples: [],
+	peak_rx_rate: 0,
+	peak_tx_rate: 0
+};
+
+let opts = {
+	agents: EMU_DEFAULT_AGENTS,
+	per_link: EMU_DEFAULT_AGENTS_PER_LINK,
+	ramp: EMU_DEFAULT_RAMP,
+	timeout: EMU_DEFAULT_TIMEOUT,
+	settle: EMU_DEFAULT_SETTLE,
+	command: 'umapd',
+	pid: null,
+	delay: null,
+	loss: null,
+	keep: false,
+	json: false,
+	verbosity: 0
+};
+
+function timems() {
+	let tv = clock(true) ?? clock(false);
+	return tv[0] * 1000 + tv[1] / 1000000;
+}
+
+function usage() {
+	warn(`Usage: ${SCRIPT_NAME} [options]\n`,
+	     `  -n COUNT    Number of synthetic agents (default ${EMU_DEFAULT_AGENTS})\n`,
+	     `  -g COUNT    Agents sharing one veth link (default ${EMU_DEFAULT_AGENTS_PER_LINK})\n`,
+	     `  -r MS       Start delay between agents (default ${EMU_DEFAULT_RAMP})\n`,
+	     `  -t MS       Give up when not converged after this time (default ${EMU_DEFAULT_TIMEOUT})\n`,
+	     `  -s MS       Keep measuring for this time after convergence (default ${EMU_DEFAULT_SETTLE})\n`,
+	     `  -x COMMAND  Controller command line, interface and AL MAC are appended (default umapd)\n`,
+	     `  -p PID      Monitor an already running controller on ${EMU_CONTROLLER_IF} instead\n`,
+	     `  -d MS       Add netem delay in both directions of the controller link\n`,
+	     `  -l PERCENT  Add netem loss in both directions of the controller link\n`,
+	     `  -k          Keep the emulated network after exiting\n`,
+	     `  -j          Emit results as JSON\n`,
+	     `  -v          Increase log verbosity\n`);
+	exit(1);
+}
+
+function emu_mac(kind, n) {
+	return sprintf('02:ee:%02x:%02x:%02x:%02x', kind, (n >> 16) & 0xff, (n >> 8) & 0xff, n & 0xff);
+}
+
+function run(...argv) {
+	if (opts.verbosity > 0)
+		warn(`+ ${join(' ', argv)}\n`);
+
+	return system(argv) == 0;
+}
+
+function must_run(...argv) {
+	if (!run(...argv))
+		die(`Command failed: ${join(' ', argv)}\n`);
+}
+
+
+/* network setup */
+
+function netem_args() {
+	let args = [];
+
+	if (opts.delay != null)
+		push(args, 'delay', `${opts.delay}ms`);
+
+	if (opts.loss != null)
+		push(args, 'loss', `${opts.loss}%`);
+
+	return args;
+}
+
+/* deleting one end of a veth pair removes its peer as well */
+function network_teardown() {
+	for (let ifname in lsdir('/sys/class/net'))
+		if (index(ifname, `${EMU_PREFIX}-`) == 0 && !match(ifname, /p$/))
+			run('ip', 'link', 'del', ifname);
+}
+
+function network_add_veth(ifname) {
+	must_run('ip', 'link', 'add', ifname, 'type', 'veth', 'peer', 'name', `${ifname}p`);
+	must_run('ip', 'link', 'set', `${ifname}p`, 'master', EMU_BRIDGE, 'up');
+	must_run('ip', 'link', 'set', ifname, 'up');
+}
+
+function network_setup() {
+	const nlinks = int((opts.agents + opts.per_link - 1) / opts.per_link);
+
+	must_run('ip', 'link', 'add', EMU_BRIDGE, 'type', 'bridge', 'forward_delay', '0', 'stp_state', '0');
+	must_run('ip', 'link', 'set', EMU_BRIDGE, 'up');
+
+	network_add_veth(EMU_CONTROLLER_IF);
+
+	/* shape egress directly on the veth, redirect ingress through an ifb
+	 * device since netem only operates on egress queues */
+	if (opts.delay != null || opts.loss != null) {
+		must_run('ip', 'link', 'add', EMU_IFB, 'type', 'ifb');
+		must_run('ip', 'link', 'set', EMU_IFB, 'up');
+		must_run('tc', 'qdisc', 'add', 'dev', EMU_CONTROLLER_IF, 'root', 'netem', ...netem_args());
+		must_run('tc', 'qdisc', 'add', 'dev', EMU_CONTROLLER_IF, 'handle', 'ffff:', 'ingress');
+		must_run('tc', 'filter', 'add', 'dev', EMU_CONTROLLER_IF, 'parent', 'ffff:', 'matchall',
+			'action', 'mirred', 'egress', 'redirect', 'dev', EMU_IFB);
+		must_run('tc', 'qdisc', 'add', 'dev', EMU_IFB, 'root', 'netem', ...netem_args());
+	}
+
+	for (let i = 0; i < nlinks; i++) {
+		const ifname = `${EMU_PREFIX}-a${i}`;
+
+		network_add_veth(ifname);
+		push(emu.links, { ifname, agents: [] });
+	}
+}
+
+
+/* controller process */
+
+function controller_spawn() {
+	const logfile = `/tmp/${EMU_PREFIX}-controller.log`;
+	const cmd = `${opts.command} --controller --interface ${EMU_CONTROLLER_IF} --mac ${EMU_CONTROLLER_MAC}`;
+	const pp = popen(`${cmd} >${logfile} 2>&1 & echo $!`, 'r');
+	const pid = +trim(pp?.read('line') ?? '');
+
+	pp?.close();
+
+	if (!(pid > 0))
+		die(`Unable to launch controller: ${cmd}\n`);
+
+	return { pid, spawned: true, logfile };
+}
+
+function controller_sample() {
+	const ctl = emu.controller;
+	const stat = readfile(`/proc/${ctl.pid}/stat`);
+	const status = readfile(`/proc/${ctl.pid}/status`);
+
+	if (!stat || !status)
+		return null;
+
+	/* fields following the parenthesized command name, utime and stime
+	 * are the 14th and 15th field of the record */
+	const fields = split(substr(stat, index(stat, ')') + 2), ' ');
+
+	return {
+		time: timems() - emu.started,
+		cpu: (+fields[11] + +fields[12]) / ctl.clk_tck,
+		rss: +match(status, /VmRSS:\s+(\d+)/)?.[1],
+		hwm: +match(status, /VmHWM:\s+(\d+)/)?.[1]
+	};
+}
+
+function clock_ticks() {
+	const pp = popen('getconf CLK_TCK', 'r');
+	const ticks = +trim(pp?.read('line') ?? '');
+
+	pp?.close();
+
+	return (ticks > 0) ? ticks : 100;
+}
+
+
+/* synthetic agents */
+
+function agent_count(dir, type) {
+	const name = sprintf('0x%04x', type);
+
+	if (dir == 'rx') {
+		emu.rx++;
+		emu.rx_types[name] = (emu.rx_types[name] ?? 0) + 1;
+	}
+	else {
+		emu.tx++;
+		emu.tx_types[name] = (emu.tx_types[name] ?? 0) + 1;
+	}
+}
+
+let check_converged;
+
+const IAgent = {
+	send: function (msg, dest) {
+		agent_count('tx', msg.type);
+
+		return msg.send(this.link.sock, this.al_address, dest ?? this.controller_al ?? defs.IEEE1905_MULTICAST_MAC);
+	},
+
+	reach: function (milestone) {
+		if (this.milestones[milestone] != null)
+			return;
+
+		this.milestones[milestone] = timems() - this.started;
+
+		if (length(this.milestones) == length(MILESTONES)) {
+			this.converged = timems() - this.started;
+			check_converged();
+		}
+	},
+
+	getRadio: function () {
+		const radio_address = this.radio_address;
+		const n = this.index;
+
+		return {
+			address: radio_address,
+			band: wconst.WPS_RF_5GHZ,
+			deriveUUID: () => [ 0x45, 0x4d, 0x55, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0, (n >> 16) & 0xff, (n >> 8) & 0xff, n & 0xff ],
+			inferWSCAuthenticationSuites: () => wconst.WPS_AUTH_OPEN | wconst.WPS_AUTH_WPA2PSK | wconst.WPS_AUTH_SAE,
+			inferWSCEncryptionTypes: () => wconst.WPS_ENCR_NONE | wconst.WPS_ENCR_AES
+		};
+	},
+
+	getBasicCapabilities: function () {
+		return {
+			radio_unique_identifier: this.radio_address,
+			max_bss_supported: 4,
+			opclasses_supported: [
+				{ opclass: 128, max_txpower_eirp: 23, statically_non_operable_channels: [] }
+			]
+		};
+	},
+
+	sendDiscovery: function () {
+		const msg = cmdu.create(defs.MSG_TOPOLOGY_DISCOVERY);
+
+		msg.add_tlv(defs.TLV_IEEE1905_AL_MAC_ADDRESS, this.al_address);
+		msg.add_tlv(defs.TLV_MAC_ADDRESS, this.if_address);
+
+		this.send(msg, defs.IEEE1905_MULTICAST_MAC);
+	},
+
+	sendSearch: function () {
+		if (this.milestones.autoconf_response != null)
+			return;
+
+		const msg = cmdu.create(defs.MSG_AP_AUTOCONFIGURATION_SEARCH);
+
+		msg.add_tlv(defs.TLV_IEEE1905_AL_MAC_ADDRESS, this.al_address);
+		msg.add_tlv(defs.TLV_SEARCHED_ROLE, 0x00); // Registrar
+		msg.add_tlv(defs.TLV_AUTOCONFIG_FREQUENCY_BAND, 0x01); // 5GHz
+		msg.add_tlv(defs.TLV_SUPPORTED_SERVICE, [0x01]); // Multi-AP Agent
+		msg.add_tlv(defs.TLV_SEARCHED_SERVICE, [0x00]); // Multi-AP Controller
+		msg.add_tlv(defs.TLV_MULTI_AP_PROFILE, 0x03);
+
+		this.send(msg, defs.IEEE1905_MULTICAST_MAC);
+		this.autoconf_timer.set(AGENT_AUTOCONF_RETRY);
+	},
+
+	sendM1: function () {
+		if (this.milestones.configured != null)
+			return;
+
+		const msg = cmdu.create(defs.MSG_AP_AUTOCONFIGURATION_WSC);
+
+		msg.add_tlv(defs.TLV_AP_RADIO_BASIC_CAPABILITIES, this.getBasicCapabilities());
+		msg.add_tlv(defs.TLV_WSC, wsc.wscBuildM1(this.getRadio())[0]);
+
+		this.send(msg);
+		this.autoconf_timer.set(AGENT_AUTOCONF_RETRY);
+	},
+
+	/* the controller drops M1 messages while the topology exchange with the
+	 * agent is still ongoing, keep retrying until an M2 arrives */
+	autoconf: function () {
+		if (this.milestones.autoconf_response == null)
+			this.sendSearch();
+		else
+			this.sendM1();
+	},
+
+	start: function () {
+		this.started = timems();
+		this.sendDiscovery();
+
+		uloop.interval(AGENT_DISCOVERY_INTERVAL, () => this.sendDiscovery());
+		this.autoconf_timer = uloop.timer(AGENT_AUTOCONF_DELAY, () => this.autoconf());
+	},
+
+	neighborTLV: function () {
+		return {
+			local_if_mac_address: this.if_address,
+			ieee1905_neighbors: this.controller_al ? [
+				{ neighbor_al_mac_address: this.controller_al, bridges_present: true }
+			] : []
+		};
+	},
+
+	handle_cmdu: function (dstmac, srcmac, msg) {
+		let reply;
+
+		switch (msg.type) {
+		case defs.MSG_TOPOLOGY_DISCOVERY:
+			this.controller_al ??= msg.get_tlv(defs.TLV_IEEE1905_AL_MAC_ADDRESS);
+			this.controller_if ??= msg.get_tlv(defs.TLV_MAC_ADDRESS);
+			this.reach('discovered');
+			break;
+
+		case defs.MSG_TOPOLOGY_QUERY:
+			reply = cmdu.create(defs.MSG_TOPOLOGY_RESPONSE, msg.mid);
+			reply.add_tlv(defs.TLV_IEEE1905_DEVICE_INFORMATION, {
+				al_mac_address: this.al_address,
+				local_interfaces: [
+					{ local_if_mac_address: this.if_address, media_type: 0x0001, media_specific_information: '' }
+				]
+			});
+			reply.add_tlv(defs.TLV_IEEE1905_NEIGHBOR_DEVICES, this.neighborTLV());
+			reply.add_tlv(defs.TLV_SUPPORTED_SERVICE, [0x01]);
+			reply.add_tlv(defs.TLV_MULTI_AP_PROFILE, 0x03);
+			this.reach('topology');
+			break;
+
+		case defs.MSG_LINK_METRIC_QUERY:
+			reply = cmdu.create(defs.MSG_LINK_METRIC_RESPONSE, msg.mid);
+
+			if (this.controller_al) {
+				const link = {
+					local_if_mac_address: this.if_address,
+					remote_if_mac_address: this.controller_if ?? this.controller_al,
+					media_type: 0x0001,
+					packet_errors: 0
+				};
+
+				reply.add_tlv(defs.TLV_IEEE1905_TRANSMITTER_LINK_METRIC, {
+					transmitter_al_mac_address: this.al_address,
+					neighbor_al_mac_address: this.controller_al,
+					link_metrics: [ {
+						...link,
+						bridges_present: true,
+						transmitted_packets: emu.tx,
+						mac_throughput_capacity: 1000,
+						link_availability: 100,
+						phy_rate: 1000
+					} ]
+				});
+
+				reply.add_tlv(defs.TLV_IEEE1905_RECEIVER_LINK_METRIC, {
+					transmitter_al_mac_address: this.al_address,
+					neighbor_al_mac_address: this.controller_al,
+					link_metrics: [ { ...link, received_packets: emu.rx, rssi: 0xff } ]
+				});
+			}
+
+			this.reach('link_metrics');
+			break;
+
+		case defs.MSG_HIGHER_LAYER_QUERY:
+			reply = cmdu.create(defs.MSG_HIGHER_LAYER_RESPONSE, msg.mid);
+			reply.add_tlv(defs.TLV_IEEE1905_AL_MAC_ADDRESS, this.al_address);
+			reply.add_tlv(defs.TLV_DEVICE_IDENTIFICATION, {
+				friendly_name: `emu-agent-${this.index}`,
+				manufacturer_name: 'umap',
+				manufacturer_model: 'emulated agent'
+			});
+			this.reach('higher_layer');
+			break;
+
+		case defs.MSG_BACKHAUL_STA_CAPABILITY_QUERY:
+			reply = cmdu.create(defs.MSG_BACKHAUL_STA_CAPABILITY_REPORT, msg.mid);
+			reply.add_tlv(defs.TLV_BACKHAUL_STA_RADIO_CAPABILITIES, {
+				radio_unique_identifier: this.radio_address
+			});
+			this.reach('bsta_capabilities');
+			break;
+
+		case defs.MSG_AP_CAPABILITY_QUERY:
+			reply = cmdu.create(defs.MSG_AP_CAPABILITY_REPORT, msg.mid);
+			reply.add_tlv(defs.TLV_AP_CAPABILITY, {
+				onchannel_unassoc_sta_metrics: false,
+				offchannel_unassoc_sta_metrics: false,
+				agent_initiated_rcpi_steering: false
+			});
+			reply.add_tlv(defs.TLV_AP_RADIO_BASIC_CAPABILITIES, this.getBasicCapabilities());
+			this.reach('ap_capabilities');
+			break;
+
+		case defs.MSG_AP_AUTOCONFIGURATION_RESPONSE:
+			if (this.milestones.autoconf_response == null) {
+				this.reach('autoconf_response');
+				this.sendM1();
+			}
+
+			break;
+
+		case defs.MSG_AP_AUTOCONFIGURATION_WSC:
+			if (msg.get_tlv(defs.TLV_AP_RADIO_IDENTIFIER) == this.radio_address) {
+				this.reach('configured');
+				this.autoconf_timer.cancel();
+			}
+
+			break;
+		}
+
+		if (reply)
+			this.send(reply, srcmac);
+	}
+};
+
+function handle_link_input(payload) {
+	const link = this.link;
+	const dstmac = payload[0], srcmac = payload[1];
+
+	/* ignore frames of other emulated agents flooded by the bridge */
+	if (emu.by_address[srcmac])
+		return;
+
+	const msg = cmdu.parse(srcmac, payload[3]);
+
+	if (!msg?.is_complete())
+		return;
+
+	if (dstmac == defs.IEEE1905_MULTICAST_MAC) {
+		for (let agent in link.agents) {
+			if (!agent.started)
+				continue;
+
+			agent_count('rx', msg.type);
+			agent.handle_cmdu(dstmac, srcmac, msg);
+		}
+	}
+	else {
+		const agent = emu.by_address[dstmac];
+
+		if (agent?.link === link && agent.started) {
+			agent_count('rx', msg.type);
+			agent.handle_cmdu(dstmac, srcmac, msg);
+		}
+	}
+}
+
+function links_open() {
+	for (let link in emu.links) {
+		link.sock = socket.create(link.ifname, socket.const.ETH_P_1905);
+
+		if (!link.sock)
+			die(`Unable to open socket on ${link.ifname}: ${socket.error()}\n`);
+
+		link.sock.link = link;
+		link.sock.handler(handle_link_input);
+	}
+}
+
+function agents_create() {
+	for (let i = 0; i < opts.agents; i++) {
+		const link = emu.links[int(i / opts.per_link)];
+		const agent = proto({
+			index: i,
+			link,
+			al_address: emu_mac(0x01, i),
+			if_address: emu_mac(0x02, i),
+			radio_address: emu_mac(0x03, i),
+			milestones: {}
+		}, IAgent);
+
+		push(emu.agents, agent);
+		push(link.agents, agent);
+
+		emu.by_address[agent.al_address] = agent;
+		emu.by_address[agent.if_address] = agent;
+	}
+}
+
+
+/* measurement */
+
+function percentile(values, p) {
+	if (!length(values))
+		return null;
+
+	values = sort([ ...values ], (a, b) => a - b);
+
+	return values[min(length(values) - 1, int(length(values) * p / 100))];
+}
+
+function summary() {
+	const elapsed = timems() - emu.started;
+	const first = emu.samples[0], last = emu.samples[-1];
+	const converged = filter(emu.agents, a => a.converged != null);
+	let milestones = {};
+
+	for (let name in MILESTONES) {
+		const times = map(filter(emu.agents, a => a.milestones[name] != null), a => a.milestones[name]);
+
+		milestones[name] = {
+			reached: length(times),
+			p50: percentile(times, 50),
+			p90: percentile(times, 90),
+			max: percentile(times, 100)
+		};
+	}
+
+	return {
+		agents: opts.agents,
+		links: length(emu.links),
+		converged: length(converged),
+		convergence_time: (length(converged) == opts.agents) ? emu.converged_at : null,
+		elapsed,
+		milestones,
+		controller: {
+			pid: emu.controller.pid,
+			cpu_time: (first && last) ? last.cpu - first.cpu : null,
+			cpu_load: (first && last && last.time > first.time) ? (last.cpu - first.cpu) * 100000 / (last.time - first.time) : null,
+			rss_kb: last?.rss,
+			peak_rss_kb: last?.hwm
+		},
+		cmdu: {
+			rx: emu.rx,
+			tx: emu.tx,
+			rx_rate: emu.rx * 1000 / elapsed,
+			tx_rate: emu.tx * 1000 / elapsed,
+			peak_rx_rate: emu.peak_rx_rate,
+			peak_tx_rate: emu.peak_tx_rate,
+			rx_types: emu.rx_types,
+			tx_types: emu.tx_types
+		}
+	};
+}
+
+function report(res) {
+	if (opts.json) {
+		printf('%.J\n', res);
+		return;
+	}
+
+	printf('Agents:           %d on %d links, %d converged\n', res.agents, res.links, res.converged);
+	printf('Convergence time: %s\n', (res.convergence_time != null) ? sprintf('%.1f ms', res.convergence_time) : 'not converged');
+	printf('Elapsed:          %.1f ms\n', res.elapsed);
+	printf('Controller:       %.2f s CPU (%.1f%%), RSS %d kB, peak %d kB\n',
+		res.controller.cpu_time ?? 0, res.controller.cpu_load ?? 0,
+		res.controller.rss_kb ?? 0, res.controller.peak_rss_kb ?? 0);
+	printf('CMDUs:            rx %d (%.1f/s, peak %d/s), tx %d (%.1f/s, peak %d/s)\n',
+		res.cmdu.rx, res.cmdu.rx_rate, res.cmdu.peak_rx_rate,
+		res.cmdu.tx, res.cmdu.tx_rate, res.cmdu.peak_tx_rate);
+
+	printf('\n%-20s %8s %10s %10s %10s\n', 'milestone', 'reached', 'p50 ms', 'p90 ms', 'max ms');
+
+	for (let name, m in res.milestones)
+		printf('%-20s %8d %10.1f %10.1f %10.1f\n', name, m.reached, m.p50 ?? 0, m.p90 ?? 0, m.max ?? 0);
+}
+
+let finish_timer;
+
+check_converged = function () {
+	if (++emu.converged < opts.agents)
+		return;
+
+	emu.converged_at = timems() - emu.started;
+	finish_timer.set(opts.settle);
+};
+
+function sample() {
+	const s = controller_sample();
+
+	if (!s) {
+		warn(`Controller process ${emu.controller.pid} vanished\n`);
+		uloop.end();
+		return;
+	}
+
+	push(emu.samples, s);
+
+	emu.peak_rx_rate = max(emu.peak_rx_rate, emu.rx - (emu.last_rx ?? 0));
+	emu.peak_tx_rate = max(emu.peak_tx_rate, emu.tx - (emu.last_tx ?? 0));
+	emu.last_rx = emu.rx;
+	emu.last_tx = emu.tx;
+}
+
+
+for (let i = 0; i < length(ARGV); i++) {
+	switch (ARGV[i]) {
+	case '-n': opts.agents = +ARGV[++i]; break;
+	case '-g': opts.per_link = +ARGV[++i]; break;
+	case '-r': opts.ramp = +ARGV[++i]; break;
+	case '-t': opts.timeout = +ARGV[++i]; break;
+	case '-s': opts.settle = +ARGV[++i]; break;
+	case '-x': opts.command = ARGV[++i]; break;
+	case '-p': opts.pid = +ARGV[++i]; break;
+	case '-d': opts.delay = +ARGV[++i]; break;
+	case '-l': opts.loss = +ARGV[++i]; break;
+	case '-k': opts.keep = true; break;
+	case '-j': opts.json = true; break;
+	case '-v': opts.verbosity++; break;
+	default: usage();
+	}
+}
+
+if (!(opts.agents > 0) || !(opts.per_link > 0) || opts.ramp < 0 || opts.command == null)
+	usage();
+
+log.setVerbosity(opts.verbosity);
+uloop.init();
+
+/* remove leftovers of a previous run */
+network_teardown();
+
+network_setup();
+links_open();
+agents_create();
+
+emu.controller = opts.pid ? { pid: opts.pid, spawned: false } : controller_spawn();
+emu.controller.clk_tck = clock_ticks();
+emu.started = timems();
+
+sample();
+uloop.interval(SAMPLE_INTERVAL, sample);
+
+for (let agent in emu.agents)
+	uloop.timer(agent.index * opts.ramp, () => agent.start());
+
+finish_timer = uloop.timer(opts.timeout, () => uloop.end());
+
+uloop.run();
+
+sample();
+report(summary());
+
+if (emu.controller.spawned)
+	run('kill', `${emu.controller.pid}`);
+
+if (!opts.keep)
+	network_teardown();
+
+exit((emu.converged == opts.agents) ? 0 : 1);
@@ -14,12 +14,13 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
-import { buffer } from 'struct';
+import { buffer, unpack } from 'struct';
 import { timer } from 'uloop';
+import { ether_ntoa } from 'umap.core';
 
-import utils from 'umap.utils';
 import log from 'umap.log';
 import defs from 'umap.defs';
+import stats from 'umap.stats';
 
 import * as codec from 'umap.tlv.codec';
 
@@ -36,19 +37,59 @@ const CMDU_MESSAGE_VERSION = 0;
 const CMDU_F_LASTFRAG = 0b10000000;
 const CMDU_F_ISRELAY = 0b01000000;
 
-const CMDU_MAX_CONCURRENT_REASSEMBLY = 16;
+const CMDU_MAX_CONCURRENT_REASSEMBLY = 64;
 const CMDU_MAX_PAYLOAD_SIZE = 102400;
-
-let reassembly = utils.Queue(CMDU_MAX_CONCURRENT_REASSEMBLY);
-let callbacks = {};
+const CMDU_REASSEMBLY_BUDGET = 1048576;
+const CMDU_REASSEMBLY_TIMEOUT = 5000;
+
+let reassembly = {
+	entries: {},
+	order: [],
+	bytes: 0,
+	stats: {
+		completed: 0,
+		expired: 0,
+		evicted: 0,
+		dropped: 0
+	}
+};
 
 function alloc_fragment(type, mid, fid, flags) {
 	return buffer().put('!BxHHBB', CMDU_MESSAGE_VERSION, type, mid, fid, flags);
 }
 
+// queue the given payloads for each socket, grouped by the underlying
+// transmit socket, and send each batch at once
+function transmit(sockets, src, dest, payloads) {
+	let batches = [];
+
+	for (let socket in sockets) {
+		let tx = socket.transmitter();
+		let batch;
+
+		for (let b in batches)
+			if (b[0] === tx)
+				batch = b;
+
+		if (!batch)
+			push(batches, batch = [ tx, [] ]);
+
+		push(batch[1], ...socket.frames(src, dest, payloads));
+	}
+
+	let sent = 0;
+
+	for (let batch in batches)
+		sent += batch[0].transmit(batch[1]) ?? 0;
+
+	stats.count('tx_frames', sent);
+
+	return sent;
+}
+
 function decode_tlv(msg, type, start, end) {
 	if (type !== defs.TLV_EXTENDED) {
-		const decode = codec.decoder[type];
+		const decode = codec.find_decoder(type);
 
 		if (decode == null) {
 			log.warn(`CMDU ${msg.srcmac}#${msg.mid}: Unrecognized TLV type ${type} at offset ${start}`);
@@ -66,7 +107,7 @@ function decode_tlv(msg, type, start, end) {
 	}
 	else {
 		const subtype = msg.buf.pos(start).get('!H');
-		const decode = codec.extended_decoder[subtype];
+		const decode = codec.find_extended_decoder(subtype);
 
 		if (decode == null) {
 			log.warn(`CMDU ${msg.srcmac}#${msg.mid}: Unrecognized extended TLV type ${type}, subtype ${subtype} at offset ${start}`);
@@ -103,6 +144,75 @@ function parse_tlvs(buf) {
 	return tlvs;
 }
 
+function reassembly_remove(msg) {
+	const idx = index(reassembly.order, msg);
+
+	if (idx > -1)
+		splice(reassembly.order, idx, 1);
+
+	delete reassembly.entries[msg.key];
+
+	reassembly.bytes -= msg.size;
+
+	msg.deadline.cancel();
+
+	delete msg.fragments;
+	delete msg.deadline;
+}
+
+function reassembly_drop(msg, reason) {
+	reassembly_remove(msg);
+	reassembly.stats[reason]++;
+}
+
+function reassembly_add(srcmac, type, mid) {
+	const key = `${srcmac}/${type}/${mid}`;
+	let msg = reassembly.entries[key];
+
+	if (msg)
+		return msg;
+
+	while (length(reassembly.order) >= CMDU_MAX_CONCURRENT_REASSEMBLY) {
+		const oldest = reassembly.order[0];
+
+		log.warn(`CMDU ${oldest.srcmac}#${oldest.mid}: Too many concurrent reassemblies, evicting oldest message`);
+		reassembly_drop(oldest, 'evicted');
+	}
+
+	msg = {
+		key,
+		srcmac,
+		flags: 0,
+		type,
+		mid,
+		fragments: [],
+		received: 0,
+		size: 0
+	};
+
+	msg.deadline = timer(CMDU_REASSEMBLY_TIMEOUT, () => {
+		log.warn(`CMDU ${srcmac}#${mid}: Reassembly timed out after ${msg.received} fragments`);
+		reassembly_drop(msg, 'expired');
+	});
+
+	reassembly.entries[key] = msg;
+	push(reassembly.order, msg);
+
+	return msg;
+}
+
+function reassembly_account(msg, size) {
+	msg.size += size;
+	reassembly.bytes += size;
+
+	while (reassembly.bytes > CMDU_REASSEMBLY_BUDGET && reassembly.order[0] !== msg) {
+		const oldest = reassembly.order[0];
+
+		log.warn(`CMDU ${oldest.srcmac}#${oldest.mid}: Reassembly memory exhausted, evicting oldest message`);
+		reassembly_drop(oldest, 'evicted');
+	}
+}
+
 function cmdu_name(type) {
 	for (let k, v in defs)
 		if (v === type && index(k, 'MSG_') === 0)
@@ -116,6 +226,128 @@ function tlv_name(type) {
 }
 
 
+/*
+ * Streaming encoder: TLVs are encoded straight into the current fragment
+ * buffer which is transmitted as soon as the next TLV does not fit anymore.
+ * TLVs exceeding the maximum fragment payload are split at octet boundary.
+ * Without sockets, completed fragments are collected in `payloads` instead,
+ * this is used by fragments() to split already encoded CMDUs.
+ */
+const ICMDUStream = {
+	emit: function (last) {
+		if (last)
+			this.frag.pos(7).put('B', this.flags | CMDU_F_LASTFRAG);
+
+		if (this.payloads)
+			push(this.payloads, this.frag.pull());
+		else
+			this.sent += transmit(this.sockets, this.src, this.dest, [ this.frag.pull() ]) ?? 0;
+
+		if (!last)
+			this.frag = alloc_fragment(this.type, this.mid, ++this.fid, this.flags);
+	},
+
+	flush: function (tlv_start) {
+		const max_len = IEEE1905_HEADER_LENGTH + IEEE1905_MAX_PAYLOAD_LENGTH;
+
+		if (this.frag.length() <= max_len)
+			return;
+
+		// move the TLV into the next fragment if it fits there as a whole
+		if (tlv_start > IEEE1905_HEADER_LENGTH && this.frag.length() - tlv_start <= IEEE1905_MAX_PAYLOAD_LENGTH) {
+			const tlv = this.frag.slice(tlv_start);
+
+			this.frag.length(tlv_start);
+			this.emit(false);
+			this.frag.put('*', tlv);
+
+			return;
+		}
+
+		log.debug('  ! Requires fragmentation at octet boundary');
+
+		while (this.frag.length() > max_len) {
+			const rest = this.frag.slice(max_len);
+
+			this.frag.length(max_len);
+			this.emit(false);
+			this.frag.put('*', rest);
+		}
+	},
+
+	add_tlv: function (type, ...args) {
+		const start = stats.now();
+		const offset = this.frag.length();
+		let subtype, encode;
+
+		if (type !== defs.TLV_EXTENDED) {
+			encode = codec.find_encoder(type);
+			this.frag.pos(offset + TLV_HEADER_LENGTH);
+		}
+		else {
+			subtype = shift(args);
+			encode = codec.find_extended_encoder(subtype);
+			this.frag.pos(offset + TLV_EXTENDED_HEADER_LENGTH);
+		}
+
+		if (encode == null || !encode(this.frag, ...args)) {
+			// encoding failure, reset buffer length
+			this.frag.length(offset);
+			die(`Failed to add TLV [${type}]`);
+		}
+
+		const tlv_len = this.frag.pos() - offset - TLV_HEADER_LENGTH;
+
+		if (subtype != null)
+			this.frag.pos(offset).put('!BHH', type, tlv_len, subtype);
+		else
+			this.frag.pos(offset).put('!BH', type, tlv_len);
+
+		log.debug2('  TLV %02x (%s) - %d byte',
+			type, tlv_name(type) ?? 'Unknown TLV', TLV_HEADER_LENGTH + tlv_len);
+
+		this.flush(offset);
+		this.elapsed += stats.now() - start;
+
+		return true;
+	},
+
+	// append an already encoded TLV including its header
+	put_tlv: function (tlv) {
+		const offset = this.frag.length();
+
+		this.frag.pos(offset).put('*', tlv);
+		this.flush(offset);
+	},
+
+	add_tlv_raw: function (type, payload) {
+		const start = stats.now();
+		const offset = this.frag.length();
+
+		this.frag.pos(offset).put('!BH*', type, length(payload), payload);
+		this.flush(offset);
+		this.elapsed += stats.now() - start;
+
+		return true;
+	},
+
+	// append End-Of-Message TLV and transmit the final fragment
+	finish: function () {
+		this.add_tlv_raw(defs.TLV_END_OF_MESSAGE, '');
+
+		const start = stats.now();
+
+		this.emit(true);
+
+		// account the encoding and transmit time spent in this stream,
+		// excluding the time the producer took between TLVs
+		stats.count('tx_messages');
+		stats.add('send', this.type, this.elapsed + stats.now() - start);
+
+		return this.sent;
+	}
+};
+
 export default {
 	mid_counter: 0,
 
@@ -174,25 +406,11 @@ export default {
 			}, this);
 		}
 
-		// find message in reassembly buffer
-		let msg = reassembly.find(e => (e.srcmac == srcmac && e.type == type && e.mid == mid));
-
-		// no reassemble entry, create
-		if (!msg) {
-			// add entry
-			msg = proto({
-				srcmac,
-				flags,
-				type,
-				mid,
-				fragments: []
-			}, this);
-
-			reassembly.push(msg);
-		}
+		// find message in reassembly buffer or create new entry
+		let msg = reassembly_add(srcmac, type, mid);
 
 		// reject duplicate fragment
-		else if (msg.fragments[fid]) {
+		if (msg.fragments[fid] != null) {
 			log.warn(`CMDU ${srcmac}#${mid}: Duplicate fragment #${fid} received`);
 			return null;
 		}
@@ -203,47 +421,74 @@ export default {
 			return null;
 		}
 
+		// last fragment, ensure that no higher fid has been seen
+		if ((flags & CMDU_F_LASTFRAG) && fid < length(msg.fragments) - 1) {
+			log.warn(`CMDU ${srcmac}#${mid}: Bogus last fragment #${fid} received`);
+			return null;
+		}
+
+		// retain header of first fragment only, strip it from the others
+		const fragment = fid ? substr(payload, IEEE1905_HEADER_LENGTH) : payload;
+
+		if (msg.size + length(fragment) > CMDU_MAX_PAYLOAD_SIZE) {
+			log.warn(`CMDU ${srcmac}#${mid}: Reassembled message exceeds ${CMDU_MAX_PAYLOAD_SIZE} bytes, dropping`);
+			reassembly_drop(msg, 'dropped');
+			return null;
+		}
+
 		msg.flags |= flags;
-		msg.fragments[fid] = buf;
-
-		// reassemble fragments
-		if (msg.flags & CMDU_F_LASTFRAG) {
-			// return on yet missing fragments (fragments were received out of order)
-			for (let i = 0; i < length(msg.fragments); i++) {
-				if (msg.fragments[fid] == null) {
-					log.debug(`CMDU ${srcmac}#${mid}: Fragments received out of order, fragment ${i + 1} of ${length(msg.fragments)} missing`);
-					return msg;
-				}
-			}
+		msg.fragments[fid] = fragment;
+		msg.received++;
 
-			// all fragments present, reassemble message
-			msg.buf = shift(msg.fragments);
+		reassembly_account(msg, length(fragment));
 
-			while (msg.fragments[0] != null)
-				msg.buf.end().put('*', shift(msg.fragments).slice(IEEE1905_HEADER_LENGTH));
+		// return on yet missing fragments
+		if (!(msg.flags & CMDU_F_LASTFRAG) || msg.received < length(msg.fragments)) {
+			if (msg.flags & CMDU_F_LASTFRAG)
+				log.debug(`CMDU ${srcmac}#${mid}: Fragments received out of order, ${length(msg.fragments) - msg.received} of ${length(msg.fragments)} missing`);
 
-			msg.buf.pos(IEEE1905_HEADER_LENGTH);
+			return proto(msg, this);
+		}
 
-			let tlvs = parse_tlvs(msg.buf);
+		// all fragments present, reassemble message in one go
+		const fragments = msg.fragments;
 
-			if (tlvs == null) {
-				log.warn(`CMDU ${srcmac}#${mid}: Invalid message payload`);
-				return null;
-			}
+		reassembly_remove(msg);
 
-			if (tlvs[-3] !== defs.TLV_END_OF_MESSAGE) {
-				log.warn(`CMDU ${srcmac}#${mid}: Missing End-Of-Message TLV`);
-				return null;
-			}
+		msg.buf = buffer(join('', fragments)).pos(IEEE1905_HEADER_LENGTH);
 
-			msg.tlvs = tlvs;
+		let tlvs = parse_tlvs(msg.buf);
 
-			reassembly.remove(msg);
+		if (tlvs == null) {
+			log.warn(`CMDU ${srcmac}#${mid}: Invalid message payload`);
+			reassembly.stats.dropped++;
+			return null;
+		}
 
-			delete msg.fragments;
+		if (tlvs[-3] !== defs.TLV_END_OF_MESSAGE) {
+			log.warn(`CMDU ${srcmac}#${mid}: Missing End-Of-Message TLV`);
+			reassembly.stats.dropped++;
+			return null;
 		}
 
-		return msg;
+		reassembly.stats.completed++;
+
+		return proto({
+			srcmac,
+			flags: msg.flags,
+			type,
+			mid,
+			buf: msg.buf,
+			tlvs
+		}, this);
+	},
+
+	reassembly_stats: function () {
+		return {
+			...reassembly.stats,
+			pending: length(reassembly.order),
+			bytes: reassembly.bytes
+		};
 	},
 
 	is_complete: function () {
@@ -274,7 +519,7 @@ export default {
 		}
 
 		if (type !== defs.TLV_EXTENDED) {
-			const encode = codec.encoder[type];
+			const encode = codec.find_encoder(type);
 
 			if (encode != null && encode(this.buf.pos(offset + TLV_HEADER_LENGTH), ...args)) {
 				// encoding successfull, write TLV header
@@ -290,7 +535,7 @@ export default {
 		}
 		else {
 			const subtype = shift(args);
-			const encode = codec.extended_encoder[subtype];
+			const encode = codec.find_extended_encoder(subtype);
 
 			if (encode != null && encode(this.buf.pos(offset + TLV_EXTENDED_HEADER_LENGTH), ...args)) {
 				// encoding successfull, write extended TLV header
@@ -385,19 +630,7 @@ export default {
 		return count;
 	},
 
-	send: function (socket, src, dest, flags) {
-		let payload_data = [];
-		let payload_fmt = [];
-		let size = 0;
-		let fid = 0;
-
-		log.debug('TX %-8s: %s > %s : %04x (%s) [%d]',
-			socket.ifname,
-			src, dest,
-			this.type,
-			cmdu_name(this.type) ?? 'Unknown Type',
-			this.mid);
-
+	fragments: function (flags) {
 		this.ensure_eom();
 
 		for (let i = 0; this.tlvs[i] !== null; i += 3) {
@@ -409,85 +642,143 @@ export default {
 			}
 		}
 
-		let cmdu_size = this.tlvs[-1] ?? IEEE1905_HEADER_LENGTH;
+		// repack the encoded TLVs by the same rules as the streaming encoder,
+		// walking the TLV headers in the buffer to find the cut points
+		const packer = proto({
+			type: this.type,
+			mid: this.mid,
+			flags: flags ?? 0,
+			fid: 0,
+			payloads: [],
+			frag: alloc_fragment(this.type, this.mid, 0, flags ?? 0)
+		}, ICMDUStream);
+
+		const buf = this.buf;
+		const end = buf.length();
+
+		for (let off = IEEE1905_HEADER_LENGTH; off + TLV_HEADER_LENGTH <= end;) {
+			const tlv_end = min(end, off + TLV_HEADER_LENGTH + buf.pos(off + 1).get('!H'));
+
+			packer.put_tlv(buf.slice(off, tlv_end));
+			off = tlv_end;
+		}
 
-		if (cmdu_size <= 1500 - ETHERNET_HEADER_LENGTH) {
-			this.buf.start().put('!BxHHBB', CMDU_MESSAGE_VERSION, this.type, this.mid, 0, (flags ?? 0) | CMDU_F_LASTFRAG);
+		packer.emit(true);
 
-			socket.send(src, dest, this.buf.slice());
-		}
-		else if (true) {
-			log.debug('  ! Requires fragmentation at TLV boundary');
+		return packer.payloads;
+	},
 
-			let payload_len = 0;
+	send: function (socket, src, dest, flags) {
+		return this.send_multi([ socket ], src, dest, flags);
+	},
 
-			for (let i = 0; this.tlvs[i] !== null; i += 3) {
-				let tlv_len = this.tlvs[i + 2] - this.tlvs[i + 1];
+	send_multi: function (sockets, src, dest, flags) {
+		for (let socket in sockets) {
+			log.debug('TX %-8s: %s > %s : %04x (%s) [%d]',
+				socket.ifname,
+				src, dest,
+				this.type,
+				cmdu_name(this.type) ?? 'Unknown Type',
+				this.mid);
+		}
 
-				if (payload_len + tlv_len > IEEE1905_MAX_PAYLOAD_LENGTH) {
-					let fragment = alloc_fragment(this.type, this.mid, fid++, flags ?? 0);
+		const start = stats.now();
 
-					fragment.put('*', this.buf.slice(this.tlvs[i + 1] - payload_len, this.tlvs[i + 1]));
-					socket.send(src, dest, fragment.pull());
+		// encode the message once, then send the resulting frames on all sockets
+		const sent = transmit(sockets, src, dest, this.fragments(flags));
 
-					payload_len = 0;
-				}
+		stats.count('tx_messages');
+		stats.record('send', this.type, start);
 
-				payload_len += tlv_len;
-			}
+		return sent;
+	},
 
-			let fragment = alloc_fragment(this.type, this.mid, fid++, (flags ?? 0) | CMDU_F_LASTFRAG);
+	// start a streamed CMDU which is transmitted to the given sockets as
+	// fragments fill up, see ICMDUStream
+	create_stream: function (type, sockets, src, dest, flags, mid) {
+		mid ??= (++this.mid_counter % 65536);
 
-			fragment.put('*', this.buf.slice(-payload_len));
-			socket.send(src, dest, fragment.pull());
+		for (let socket in sockets) {
+			log.debug('TX %-8s: %s > %s : %04x (%s) [%d] (streamed)',
+				socket.ifname,
+				src, dest,
+				type,
+				cmdu_name(type) ?? 'Unknown Type',
+				mid);
 		}
-		else {
-			log.debug('  ! Requires fragmentation at octet boundary');
 
-			let offset = IEEE1905_HEADER_LENGTH;
-
-			while (cmdu_size - offset > IEEE1905_MAX_PAYLOAD_LENGTH) {
-				let fragment = alloc_fragment(this.type, this.mid, fid++, flags ?? 0);
+		return proto({
+			type, mid, sockets, src, dest,
+			flags: flags ?? 0,
+			fid: 0,
+			sent: 0,
+			elapsed: 0,
+			frag: alloc_fragment(type, mid, 0, flags ?? 0)
+		}, ICMDUStream);
+	},
 
-				fragment.put('*', this.buf.slice(offset, offset + IEEE1905_MAX_PAYLOAD_LENGTH));
-				socket.send(src, dest, fragment.pull());
+	// decode the fixed header of a raw CMDU frame without parsing its payload
+	header: function (payload) {
+		if (length(payload) < IEEE1905_HEADER_LENGTH)
+			return null;
 
-				offset += IEEE1905_MAX_PAYLOAD_LENGTH;
-			}
+		const header = unpack('!BxHHBB', payload);
 
-			let fragment = alloc_fragment(this.type, this.mid, fid++, (flags ?? 0) | CMDU_F_LASTFRAG);
+		if (header?.[0] != CMDU_MESSAGE_VERSION)
+			return null;
 
-			fragment.put('*', this.buf.slice(offset));
-			socket.send(src, dest, fragment.pull());
-		}
+		return {
+			type: header[1],
+			mid: header[2],
+			fid: header[3],
+			flags: header[4]
+		};
 	},
 
-	on_reply: function (func, timeout, reply_type) {
-		if (type(func) == 'function') {
-			// We assume that reply CMDU type IDs are always request type ID + 1
-			const id = sprintf('%04x%04x', reply_type ?? this.type + 1, this.mid);
+	// sanity check a raw fragment with the given header before relaying it,
+	// the AL MAC address carried in a first fragment is stored in hdr.al_mac
+	relay_check: function (payload, hdr) {
+		const len = length(payload);
+
+		if (len < IEEE1905_HEADER_LENGTH + TLV_HEADER_LENGTH ||
+		    len > IEEE1905_HEADER_LENGTH + IEEE1905_MAX_PAYLOAD_LENGTH)
+			return false;
+
+		if (hdr.fid != 0)
+			return true;
+
+		// unfragmented messages must consist of complete TLVs up to the EOM
+		const complete = !!(hdr.flags & CMDU_F_LASTFRAG);
+		let eom = false;
+
+		for (let off = IEEE1905_HEADER_LENGTH; !eom && off + TLV_HEADER_LENGTH <= len;) {
+			const tlv = unpack('!BH', payload, off);
+			const end = off + TLV_HEADER_LENGTH + tlv[1];
+
+			if (end > len)
+				return !complete;
+
+			if (tlv[0] == defs.TLV_IEEE1905_AL_MAC_ADDRESS && tlv[1] == 6)
+				hdr.al_mac = ether_ntoa(payload, off + TLV_HEADER_LENGTH);
 
-			callbacks[id] = [
-				func,
-				timer(timeout ?? 1000, () => {
-					callbacks[id][0](null);
-					delete callbacks[id];
-				})
-			];
+			eom = (tlv[0] == defs.TLV_END_OF_MESSAGE);
+			off = end;
 		}
-	},
 
-	run_handler: function () {
-		const id = sprintf('%04x%04x', this.type, this.mid);
+		return eom || !complete;
+	},
 
-		if (!exists(callbacks, id))
-			return false;
+	// forward a received raw fragment unchanged
+	relay: function (sockets, src, dest, payload) {
+		for (let socket in sockets)
+			log.debug('RELAY %-8s: %s > %s : %d byte', socket.ifname, src, dest, length(payload));
 
-		callbacks[id][1].cancel();
-		callbacks[id][0](this);
+		const start = stats.now();
+		const sent = transmit(sockets, src, dest, [ payload ]);
 
-		delete callbacks[id];
+		stats.count('relayed');
+		stats.record('send', 'relay', start);
 
-		return true;
+		return sent;
 	}
 };
@@ -5,10 +5,19 @@
 #include <unistd.h>
 #include <errno.h>
 #include <sys/wait.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <linux/if_packet.h>
 
 #include "ucode/module.h"
 #include "ucode/platform.h"
 
+#define RXRING_DEFAULT_BLOCK_SIZE	65536
+#define RXRING_DEFAULT_BLOCK_COUNT	16
+#define RXRING_FRAME_SIZE			2048
+#define RXRING_BLOCK_TIMEOUT		10
+
 typedef struct {
 	char *name;
 	char type, store, action;
@@ -17,6 +26,15 @@ typedef struct {
 	uc_value_t *defval;
 } option_spec_t;
 
+typedef struct {
+	uint8_t *map;
+	size_t map_len;
+	unsigned int block_size, block_count, block_index;
+} rxring_t;
+
+static uc_resource_type_t *rxring_type;
+static int last_error;
+
 
 static void *
 getopt_report_error(uc_vm_t *vm, uc_value_t *errcb, const char *fmt, ...)
@@ -565,14 +583,386 @@ uc_waitpid(uc_vm_t *vm, size_t nargs)
 }
 
 
+static uc_value_t *
+uc_rxring(uc_vm_t *vm, size_t nargs)
+{
+	uc_value_t *fdval = uc_fn_arg(0);
+	uc_value_t *countval = uc_fn_arg(1);
+	uc_value_t *sizeval = uc_fn_arg(2);
+	struct tpacket_req3 req = { 0 };
+	int version = TPACKET_V3;
+	rxring_t *ring;
+	void *map;
+	int fd;
+
+	if (ucv_type(fdval) != UC_INTEGER || ucv_int64_get(fdval) < 0) {
+		uc_vm_raise_exception(vm, EXCEPTION_TYPE, "Invalid file descriptor");
+
+		return NULL;
+	}
+
+	fd = ucv_int64_get(fdval);
+
+	req.tp_block_nr = countval ? ucv_to_unsigned(countval) : RXRING_DEFAULT_BLOCK_COUNT;
+	req.tp_block_size = sizeval ? ucv_to_unsigned(sizeval) : RXRING_DEFAULT_BLOCK_SIZE;
+	req.tp_frame_size = RXRING_FRAME_SIZE;
+	req.tp_retire_blk_tov = RXRING_BLOCK_TIMEOUT;
+
+	if (req.tp_block_nr == 0 || req.tp_block_size < RXRING_FRAME_SIZE ||
+	    (req.tp_block_size & (getpagesize() - 1)) != 0) {
+		uc_vm_raise_exception(vm, EXCEPTION_TYPE, "Invalid ring geometry");
+
+		return NULL;
+	}
+
+	req.tp_frame_nr = (req.tp_block_size / req.tp_frame_size) * req.tp_block_nr;
+
+	if (setsockopt(fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) == -1 ||
+	    setsockopt(fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) == -1)
+		return NULL;
+
+	map = mmap(NULL, (size_t)req.tp_block_size * req.tp_block_nr,
+		PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+	if (map == MAP_FAILED) {
+		/* tear down ring again, otherwise recvmsg() would not see frames */
+		memset(&req, 0, sizeof(req));
+		setsockopt(fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req));
+
+		return NULL;
+	}
+
+	ring = xalloc(sizeof(*ring));
+	ring->map = map;
+	ring->map_len = (size_t)req.tp_block_size * req.tp_block_nr;
+	ring->block_size = req.tp_block_size;
+	ring->block_count = req.tp_block_nr;
+
+	return ucv_resource_new(rxring_type, ring);
+}
+
+static uc_value_t *
+mac_format(const uint8_t *addr)
+{
+	static const char hex[] = "0123456789abcdef";
+	char mac[17];
+
+	for (size_t i = 0; i < 6; i++) {
+		mac[i * 3 + 0] = hex[addr[i] >> 4];
+		mac[i * 3 + 1] = hex[addr[i] & 15];
+
+		if (i < 5)
+			mac[i * 3 + 2] = ':';
+	}
+
+	return ucv_string_new_length(mac, sizeof(mac));
+}
+
+static int
+mac_nibble(char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+
+	return -1;
+}
+
+static uc_value_t *
+uc_rxring_recv(uc_vm_t *vm, size_t nargs)
+{
+	rxring_t **ring = uc_fn_this("umap.rxring");
+	bool format = ucv_is_truish(uc_fn_arg(0));
+	struct tpacket_block_desc *bd;
+	struct tpacket3_hdr *hdr;
+	uc_value_t *frames;
+	uint32_t count;
+
+	if (!ring || !*ring || !(*ring)->map)
+		return NULL;
+
+	bd = (struct tpacket_block_desc *)
+		((*ring)->map + (size_t)(*ring)->block_index * (*ring)->block_size);
+
+	if (!(__atomic_load_n(&bd->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER))
+		return NULL;
+
+	count = bd->hdr.bh1.num_pkts;
+	frames = ucv_array_new_length(vm, count);
+	hdr = (struct tpacket3_hdr *)((uint8_t *)bd + bd->hdr.bh1.offset_to_first_pkt);
+
+	for (uint32_t i = 0; i < count; i++) {
+		const uint8_t *data = (uint8_t *)hdr + hdr->tp_mac;
+		uc_value_t *frame;
+
+		if (hdr->tp_snaplen >= 14) {
+			frame = ucv_array_new_length(vm, 4);
+
+			if (format) {
+				ucv_array_push(frame, mac_format(data));
+				ucv_array_push(frame, mac_format(data + 6));
+				ucv_array_push(frame, ucv_int64_new((data[12] << 8) | data[13]));
+			}
+			else {
+				ucv_array_push(frame, ucv_string_new_length((char *)data, 6));
+				ucv_array_push(frame, ucv_string_new_length((char *)data + 6, 6));
+				ucv_array_push(frame, ucv_string_new_length((char *)data + 12, 2));
+			}
+
+			ucv_array_push(frame,
+				ucv_string_new_length((char *)data + 14, hdr->tp_snaplen - 14));
+
+			ucv_array_push(frames, frame);
+		}
+
+		hdr = (struct tpacket3_hdr *)((uint8_t *)hdr + hdr->tp_next_offset);
+	}
+
+	/* hand block back to the kernel */
+	__atomic_store_n(&bd->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+
+	(*ring)->block_index = ((*ring)->block_index + 1) % (*ring)->block_count;
+
+	return frames;
+}
+
+static void
+rxring_free(void *ud)
+{
+	rxring_t *ring = ud;
+
+	if (!ring)
+		return;
+
+	if (ring->map)
+		munmap(ring->map, ring->map_len);
+
+	free(ring);
+}
+
+static uc_value_t *
+uc_rxring_close(uc_vm_t *vm, size_t nargs)
+{
+	rxring_t **ring = uc_fn_this("umap.rxring");
+
+	if (!ring || !*ring)
+		return NULL;
+
+	rxring_free(*ring);
+	*ring = NULL;
+
+	return ucv_boolean_new(true);
+}
+
+
+/* format six bytes at the optional offset of a binary string as MAC text */
+static uc_value_t *
+uc_ether_ntoa(uc_vm_t *vm, size_t nargs)
+{
+	uc_value_t *addr = uc_fn_arg(0);
+	uc_value_t *offval = uc_fn_arg(1);
+	int64_t off = 0;
+
+	if (ucv_type(addr) != UC_STRING)
+		return NULL;
+
+	if (offval) {
+		if (ucv_type(offval) != UC_INTEGER)
+			return NULL;
+
+		off = ucv_int64_get(offval);
+	}
+
+	if (off < 0 || (size_t)off + 6 > ucv_string_length(addr))
+		return NULL;
+
+	return mac_format((uint8_t *)ucv_string_get(addr) + off);
+}
+
+/* parse "xx:xx:xx:xx:xx:xx" into six bytes, null if malformed */
+static uc_value_t *
+uc_ether_aton(uc_vm_t *vm, size_t nargs)
+{
+	uc_value_t *mac = uc_fn_arg(0);
+	uint8_t addr[6];
+	const char *s;
+
+	if (ucv_type(mac) != UC_STRING || ucv_string_length(mac) != 17)
+		return NULL;
+
+	s = ucv_string_get(mac);
+
+	for (size_t i = 0; i < 6; i++) {
+		int hi = mac_nibble(s[i * 3 + 0]);
+		int lo = mac_nibble(s[i * 3 + 1]);
+
+		if (hi < 0 || lo < 0 || (i < 5 && s[i * 3 + 2] != ':'))
+			return NULL;
+
+		addr[i] = (hi << 4) | lo;
+	}
+
+	return ucv_string_new_length((char *)addr, sizeof(addr));
+}
+
+
+static uc_value_t *
+uc_sendmmsg(uc_vm_t *vm, size_t nargs)
+{
+	uc_value_t *fdval = uc_fn_arg(0);
+	uc_value_t *batch = uc_fn_arg(1);
+	size_t count, niov = 0, sent = 0;
+	struct sockaddr_ll *addrs;
+	struct mmsghdr *msgs;
+	struct iovec *iov;
+	int fd, rv;
+
+	if (ucv_type(fdval) != UC_INTEGER || ucv_int64_get(fdval) < 0) {
+		uc_vm_raise_exception(vm, EXCEPTION_TYPE, "Invalid file descriptor");
+
+		return NULL;
+	}
+
+	if (ucv_type(batch) != UC_ARRAY) {
+		uc_vm_raise_exception(vm, EXCEPTION_TYPE, "Frame list not an array");
+
+		return NULL;
+	}
+
+	fd = ucv_int64_get(fdval);
+	count = ucv_array_length(batch);
+
+	/* each entry is a [ ifindex, frame ] tuple, where frame is either a
+	 * string or an array of strings to be sent as one scattered frame */
+	for (size_t i = 0; i < count; i++) {
+		uc_value_t *entry = ucv_array_get(batch, i);
+		uc_value_t *frame = ucv_array_get(entry, 1);
+		bool valid = (ucv_type(entry) == UC_ARRAY &&
+		              ucv_type(ucv_array_get(entry, 0)) == UC_INTEGER);
+
+		if (valid && ucv_type(frame) == UC_ARRAY) {
+			for (size_t j = 0; valid && j < ucv_array_length(frame); j++)
+				valid = (ucv_type(ucv_array_get(frame, j)) == UC_STRING);
+
+			niov += ucv_array_length(frame);
+		}
+		else if (valid) {
+			valid = (ucv_type(frame) == UC_STRING);
+			niov++;
+		}
+
+		if (!valid) {
+			uc_vm_raise_exception(vm, EXCEPTION_TYPE,
+				"Frame list entry %zu is not an [ ifindex, frame ] tuple", i);
+
+			return NULL;
+		}
+	}
+
+	if (count == 0)
+		return ucv_int64_new(0);
+
+	msgs = xcalloc(count, sizeof(*msgs));
+	addrs = xcalloc(count, sizeof(*addrs));
+	iov = xcalloc(niov, sizeof(*iov));
+	niov = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		uc_value_t *entry = ucv_array_get(batch, i);
+		uc_value_t *frame = ucv_array_get(entry, 1);
+
+		addrs[i].sll_family = AF_PACKET;
+		addrs[i].sll_ifindex = ucv_int64_get(ucv_array_get(entry, 0));
+
+		msgs[i].msg_hdr.msg_name = &addrs[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+		msgs[i].msg_hdr.msg_iov = &iov[niov];
+
+		/* short strings are stored inline in the value itself, take the
+		 * buffer pointers from the array slots, not from local copies */
+		if (ucv_type(frame) == UC_ARRAY) {
+			for (size_t j = 0; j < ucv_array_length(frame); j++) {
+				uc_value_t **part = ((uc_array_t *)frame)->entries + j;
+
+				iov[niov].iov_base = _ucv_string_get(part);
+				iov[niov].iov_len = ucv_string_length(*part);
+				niov++;
+			}
+
+			msgs[i].msg_hdr.msg_iovlen = ucv_array_length(frame);
+		}
+		else {
+			iov[niov].iov_base = _ucv_string_get(((uc_array_t *)entry)->entries + 1);
+			iov[niov].iov_len = ucv_string_length(frame);
+			niov++;
+
+			msgs[i].msg_hdr.msg_iovlen = 1;
+		}
+	}
+
+	while (sent < count) {
+		rv = sendmmsg(fd, msgs + sent, count - sent, 0);
+
+		if (rv == -1) {
+			if (errno == EINTR)
+				continue;
+
+			last_error = errno;
+			break;
+		}
+
+		sent += rv;
+	}
+
+	free(iov);
+	free(addrs);
+	free(msgs);
+
+	if (sent == 0)
+		return NULL;
+
+	return ucv_int64_new(sent);
+}
+
+/* return and reset the errno value of the last failed sendmmsg() call */
+static uc_value_t *
+uc_error(uc_vm_t *vm, size_t nargs)
+{
+	int err = last_error;
+
+	if (err == 0)
+		return NULL;
+
+	last_error = 0;
+
+	return ucv_int64_new(err);
+}
+
+static const uc_function_list_t rxring_fns[] = {
+	{ "recv",		uc_rxring_recv },
+	{ "close",		uc_rxring_close },
+};
+
 static const uc_function_list_t getopt_fns[] = {
 	{ "getopt", 	uc_getopt },
 	{ "spawn",		uc_spawn },
 	{ "kill",		uc_kill },
 	{ "waitpid",	uc_waitpid },
+	{ "rxring",		uc_rxring },
+	{ "sendmmsg",	uc_sendmmsg },
+	{ "error",		uc_error },
+	{ "ether_ntoa",	uc_ether_ntoa },
+	{ "ether_aton",	uc_ether_aton },
 };
 
 void uc_module_init(uc_vm_t *vm, uc_value_t *scope)
 {
 	uc_function_list_register(scope, getopt_fns);
+
+	rxring_type = uc_type_declare(vm, "umap.rxring", rxring_fns, rxring_free);
 }
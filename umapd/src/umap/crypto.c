@@ -1,4 +1,10 @@
 #include <string.h>
+#include <stdbool.h>
+#include <endian.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <inttypes.h>
+#include <sys/eventfd.h>
 
 #include <openssl/sha.h>
 #include <openssl/hmac.h>
@@ -64,80 +70,127 @@ uc_crypto_hmac_sha256(uc_vm_t *vm, size_t nargs)
 	return ucv_string_new_length((char *)digest, len);
 }
 
+static EVP_CIPHER *aes_cipher;
+static EVP_CIPHER_CTX *aes_ctx;
+
 static uc_value_t *
-uc_crypto_aes_encrypt(uc_vm_t *vm, size_t nargs)
+aes_crypt(uc_vm_t *vm, size_t nargs, int enc)
 {
-	uc_value_t *key = uc_fn_arg(0), *iv = uc_fn_arg(1), *text = uc_fn_arg(2);
-	unsigned char encr[128], *keyp, *ivp, *textp;
-	int encrlen, encrfinlen, textlen;
-	EVP_CIPHER_CTX *ctx = NULL;
-	EVP_CIPHER *cipher = NULL;
-	uc_value_t *result = NULL;
+	uc_value_t *key = uc_fn_arg(0), *iv = uc_fn_arg(1), *input = uc_fn_arg(2);
+	int outlen, outfinlen, inputlen;
+	unsigned char *keyp, *ivp, *inputp;
+	uc_string_t *us;
 
 	if (ucv_type(key) != UC_STRING ||
-	    ucv_type(text) != UC_STRING ||
+	    ucv_type(input) != UC_STRING ||
 	    (iv != NULL && ucv_type(iv) != UC_STRING))
 		return NULL;
 
-	textlen = ucv_string_length(text);
-	textp = (unsigned char *)ucv_string_get(text);
+	if (!aes_cipher && !(aes_cipher = EVP_CIPHER_fetch(NULL, "AES-128-CBC", NULL)))
+		return NULL;
+
+	if (!aes_ctx && !(aes_ctx = EVP_CIPHER_CTX_new()))
+		return NULL;
+
+	inputlen = ucv_string_length(input);
+	inputp = (unsigned char *)ucv_string_get(input);
 
 	keyp = (unsigned char *)ucv_string_get(key);
 	ivp = (unsigned char *)ucv_string_get(iv);
 
-	if (!(cipher = EVP_CIPHER_fetch(NULL, "AES-128-CBC", NULL)) ||
-	    !(ctx = EVP_CIPHER_CTX_new()) ||
-	    !EVP_EncryptInit_ex2(ctx, cipher, keyp, ivp, NULL) ||
-		!EVP_CIPHER_CTX_set_padding(ctx, 0) ||
-		!EVP_EncryptUpdate(ctx, encr, &encrlen, textp, textlen) ||
-		!EVP_EncryptFinal_ex(ctx, encr + encrlen, &encrfinlen))
-		goto out;
+	us = xalloc(sizeof(uc_string_t) + inputlen + EVP_MAX_BLOCK_LENGTH + 1);
+	us->header.type = UC_STRING;
+	us->header.refcount = 1;
 
-	result = ucv_string_new_length((char *)encr, encrlen + encrfinlen);
+	if (!EVP_CipherInit_ex2(aes_ctx, aes_cipher, keyp, ivp, enc, NULL) ||
+	    !EVP_CIPHER_CTX_set_padding(aes_ctx, 0) ||
+	    !EVP_CipherUpdate(aes_ctx, (unsigned char *)us->str, &outlen, inputp, inputlen) ||
+	    !EVP_CipherFinal_ex(aes_ctx, (unsigned char *)us->str + outlen, &outfinlen)) {
+		EVP_CIPHER_CTX_reset(aes_ctx);
+		free(us);
 
-out:
-	EVP_CIPHER_CTX_free(ctx);
-	EVP_CIPHER_free(cipher);
+		return NULL;
+	}
 
-	return result;
+	EVP_CIPHER_CTX_reset(aes_ctx);
+
+	us->length = outlen + outfinlen;
+	us->str[us->length] = 0;
+
+	return &us->header;
+}
+
+static uc_value_t *
+uc_crypto_aes_encrypt(uc_vm_t *vm, size_t nargs)
+{
+	return aes_crypt(vm, nargs, 1);
 }
 
 static uc_value_t *
 uc_crypto_aes_decrypt(uc_vm_t *vm, size_t nargs)
 {
-	uc_value_t *key = uc_fn_arg(0), *iv = uc_fn_arg(1), *encr = uc_fn_arg(2);
-	unsigned char text[128], *keyp, *ivp, *encrp;
-	int textlen, textfinlen, encrlen;
-	EVP_CIPHER_CTX *ctx = NULL;
-	EVP_CIPHER *cipher = NULL;
-	uc_value_t *result = NULL;
+	return aes_crypt(vm, nargs, 0);
+}
+
+/*
+ * WSC key derivation function as specified in the Wi-Fi Simple Configuration
+ * technical specification section 7.6: HMAC-SHA256 in counter mode over the
+ * personalization string and the requested key length in bits.
+ */
+static uc_value_t *
+uc_crypto_kdf(uc_vm_t *vm, size_t nargs)
+{
+	uc_value_t *key = uc_fn_arg(0), *label = uc_fn_arg(1), *len = uc_fn_arg(2);
+	unsigned char digest[SHA256_DIGEST_LENGTH], *keyp, *data;
+	size_t keylen, labellen, datalen, outlen, off;
+	uint32_t i, bits;
+	uc_string_t *us;
 
 	if (ucv_type(key) != UC_STRING ||
-	    ucv_type(encr) != UC_STRING ||
-	    (iv != NULL && ucv_type(iv) != UC_STRING))
+	    ucv_type(label) != UC_STRING ||
+	    ucv_type(len) != UC_INTEGER)
 		return NULL;
 
-	encrlen = ucv_string_length(encr);
-	encrp = (unsigned char *)ucv_string_get(encr);
+	outlen = ucv_uint64_get(len);
+
+	if (outlen == 0 || outlen > 0x1fffffff)
+		return NULL;
 
+	keylen = ucv_string_length(key);
 	keyp = (unsigned char *)ucv_string_get(key);
-	ivp = (unsigned char *)ucv_string_get(iv);
 
-	if (!(cipher = EVP_CIPHER_fetch(NULL, "AES-128-CBC", NULL)) ||
-	    !(ctx = EVP_CIPHER_CTX_new()) ||
-	    !EVP_DecryptInit_ex2(ctx, cipher, keyp, ivp, NULL) ||
-		!EVP_CIPHER_CTX_set_padding(ctx, 0) ||
-		!EVP_DecryptUpdate(ctx, text, &textlen, encrp, encrlen) ||
-		!EVP_DecryptFinal_ex(ctx, text + textlen, &textfinlen))
-		goto out;
+	labellen = ucv_string_length(label);
+	datalen = sizeof(uint32_t) + labellen + sizeof(uint32_t);
+	data = xalloc(datalen);
 
-	result = ucv_string_new_length((char *)text, textlen + textfinlen);
+	bits = htobe32(outlen * 8);
+	memcpy(data + sizeof(uint32_t), ucv_string_get(label), labellen);
+	memcpy(data + sizeof(uint32_t) + labellen, &bits, sizeof(bits));
 
-out:
-	EVP_CIPHER_CTX_free(ctx);
-	EVP_CIPHER_free(cipher);
+	us = xalloc(sizeof(uc_string_t) + outlen + 1);
+	us->header.type = UC_STRING;
+	us->header.refcount = 1;
+	us->length = outlen;
 
-	return result;
+	for (i = 1, off = 0; off < outlen; i++, off += SHA256_DIGEST_LENGTH) {
+		uint32_t n = htobe32(i);
+
+		memcpy(data, &n, sizeof(n));
+
+		if (!HMAC(EVP_sha256(), keyp, keylen, data, datalen, digest, NULL)) {
+			free(data);
+			free(us);
+
+			return NULL;
+		}
+
+		memcpy(us->str + off, digest,
+			(outlen - off < SHA256_DIGEST_LENGTH) ? outlen - off : SHA256_DIGEST_LENGTH);
+	}
+
+	free(data);
+
+	return &us->header;
 }
 
 static unsigned char dh1536_p[] = {
@@ -161,21 +214,55 @@ static unsigned char dh1536_p[] = {
 
 static unsigned char dh1536_g[] = { 0x02 };
 
+#define DH_POOL_SIZE 8
+
+static BIGNUM *dh_p, *dh_g;
+static EVP_PKEY *dh_params;
+static EVP_PKEY *dh_pool[DH_POOL_SIZE];
+static size_t dh_pool_len;
+
+static bool
+dh_group_init(void)
+{
+	OSSL_PARAM_BLD *bld = NULL;
+	OSSL_PARAM *params = NULL;
+	EVP_PKEY_CTX *ctx = NULL;
+
+	if (dh_params)
+		return true;
+
+	if ((dh_p || (dh_p = BN_bin2bn(dh1536_p, sizeof(dh1536_p), NULL))) &&
+	    (dh_g || (dh_g = BN_bin2bn(dh1536_g, sizeof(dh1536_g), NULL))) &&
+	    (bld = OSSL_PARAM_BLD_new()) != NULL &&
+	    OSSL_PARAM_BLD_push_BN(bld, OSSL_PKEY_PARAM_FFC_P, dh_p) &&
+	    OSSL_PARAM_BLD_push_BN(bld, OSSL_PKEY_PARAM_FFC_G, dh_g) &&
+	    (params = OSSL_PARAM_BLD_to_param(bld)) != NULL &&
+	    (ctx = EVP_PKEY_CTX_new_from_name(NULL, "DH", NULL)) != NULL &&
+	    EVP_PKEY_fromdata_init(ctx) > 0 &&
+	    EVP_PKEY_fromdata(ctx, &dh_params, EVP_PKEY_KEY_PARAMETERS, params) > 0)
+		;
+
+	OSSL_PARAM_BLD_free(bld);
+	OSSL_PARAM_free(params);
+
+	EVP_PKEY_CTX_free(ctx);
+
+	return (dh_params != NULL);
+}
+
 static EVP_PKEY *
 pkey_create(const char *key, BIGNUM *val)
 {
-	BIGNUM *p = NULL, *g = NULL;
 	OSSL_PARAM_BLD *bld = NULL;
 	OSSL_PARAM *params = NULL;
 	EVP_PKEY_CTX *ctx = NULL;
 	EVP_PKEY *pkey = NULL;
 
-	if (!(p = BN_bin2bn(dh1536_p, sizeof(dh1536_p), NULL)) ||
-	    !(g = BN_bin2bn(dh1536_g, sizeof(dh1536_g), NULL)) ||
+	if (!dh_group_init() ||
 	    !(bld = OSSL_PARAM_BLD_new()) ||
-	    !OSSL_PARAM_BLD_push_BN(bld, OSSL_PKEY_PARAM_FFC_P, p) ||
-	    !OSSL_PARAM_BLD_push_BN(bld, OSSL_PKEY_PARAM_FFC_G, g) ||
-	    !(key == NULL || OSSL_PARAM_BLD_push_BN(bld, key, val)) ||
+	    !OSSL_PARAM_BLD_push_BN(bld, OSSL_PKEY_PARAM_FFC_P, dh_p) ||
+	    !OSSL_PARAM_BLD_push_BN(bld, OSSL_PKEY_PARAM_FFC_G, dh_g) ||
+	    !OSSL_PARAM_BLD_push_BN(bld, key, val) ||
 	    !(params = OSSL_PARAM_BLD_to_param(bld)) ||
 	    !(ctx = EVP_PKEY_CTX_new_from_name(NULL, "DH", NULL)) ||
 	    EVP_PKEY_fromdata_init(ctx) < 1 ||
@@ -187,8 +274,22 @@ pkey_create(const char *key, BIGNUM *val)
 
 	EVP_PKEY_CTX_free(ctx);
 
-	BN_free(p);
-	BN_free(g);
+	return pkey;
+}
+
+static EVP_PKEY *
+dh_generate(void)
+{
+	EVP_PKEY_CTX *ctx = NULL;
+	EVP_PKEY *pkey = NULL;
+
+	if (!dh_group_init() ||
+	    !(ctx = EVP_PKEY_CTX_new_from_pkey(NULL, dh_params, NULL)) ||
+	    EVP_PKEY_keygen_init(ctx) < 1 ||
+	    EVP_PKEY_generate(ctx, &pkey) < 1)
+		;
+
+	EVP_PKEY_CTX_free(ctx);
 
 	return pkey;
 }
@@ -217,13 +318,14 @@ static uc_value_t *
 uc_crypto_dh_keypair(uc_vm_t *vm, size_t nargs)
 {
 	uc_value_t *result = NULL, *pubkey = NULL, *privkey = NULL;
-	EVP_PKEY_CTX *ctx = NULL;
-	EVP_PKEY *pkey = NULL;
+	EVP_PKEY *pkey;
 
-	if (!(pkey = pkey_create(NULL, NULL)) ||
-	    !(ctx = EVP_PKEY_CTX_new_from_pkey(NULL, pkey, NULL)) ||
-	    EVP_PKEY_keygen_init(ctx) < 1 ||
-	    EVP_PKEY_generate(ctx, &pkey) < 1 ||
+	if (dh_pool_len > 0)
+		pkey = dh_pool[--dh_pool_len];
+	else
+		pkey = dh_generate();
+
+	if (!pkey ||
 	    !(privkey = pkey_get_key(pkey, OSSL_PKEY_PARAM_PRIV_KEY)) ||
 	    !(pubkey = pkey_get_key(pkey, OSSL_PKEY_PARAM_PUB_KEY)))
 		goto out;
@@ -233,7 +335,6 @@ uc_crypto_dh_keypair(uc_vm_t *vm, size_t nargs)
 	ucv_array_push(result, ucv_get(pubkey));
 
 out:
-	EVP_PKEY_CTX_free(ctx);
 	EVP_PKEY_free(pkey);
 
 	ucv_put(privkey);
@@ -242,26 +343,39 @@ out:
 	return result;
 }
 
+/*
+ * Generate up to the given number of keypairs (default 1) ahead of time and
+ * return the number of free pool slots remaining, so that callers can spread
+ * refilling over multiple event loop iterations.
+ */
 static uc_value_t *
-uc_crypto_dh_sharedkey(uc_vm_t *vm, size_t nargs)
+uc_crypto_dh_pool_fill(uc_vm_t *vm, size_t nargs)
 {
-	uc_value_t *privkey = uc_fn_arg(0), *peerkey = uc_fn_arg(1);
-	EVP_PKEY *pkey_priv = NULL, *pkey_peer = NULL;
-	BIGNUM *privbn = NULL, *peerbn = NULL;
-	size_t privlen, peerlen, sharedlen;
-	unsigned char *privp, *peerp;
-	EVP_PKEY_CTX *ctx = NULL;
-	uc_string_t *us = NULL;
+	uc_value_t *count = uc_fn_arg(0);
+	size_t n = 1;
+	EVP_PKEY *pkey;
 
-	if (ucv_type(privkey) != UC_STRING ||
-	    ucv_type(peerkey) != UC_STRING)
-		return NULL;
+	if (ucv_type(count) == UC_INTEGER)
+		n = ucv_uint64_get(count);
+
+	while (n-- > 0 && dh_pool_len < DH_POOL_SIZE) {
+		if (!(pkey = dh_generate()))
+			return NULL;
 
-	privlen = ucv_string_length(privkey);
-	privp = (unsigned char *)ucv_string_get(privkey);
+		dh_pool[dh_pool_len++] = pkey;
+	}
 
-	peerlen = ucv_string_length(peerkey);
-	peerp = (unsigned char *)ucv_string_get(peerkey);
+	return ucv_int64_new(DH_POOL_SIZE - dh_pool_len);
+}
+
+static unsigned char *
+dh_derive(const unsigned char *privp, size_t privlen,
+          const unsigned char *peerp, size_t peerlen, size_t *sharedlen)
+{
+	EVP_PKEY *pkey_priv = NULL, *pkey_peer = NULL;
+	BIGNUM *privbn = NULL, *peerbn = NULL;
+	unsigned char *shared = NULL;
+	EVP_PKEY_CTX *ctx = NULL;
 
 	if (!(privbn = BN_bin2bn(privp, privlen, NULL)) ||
 	    !(pkey_priv = pkey_create(OSSL_PKEY_PARAM_PRIV_KEY, privbn)) ||
@@ -270,17 +384,14 @@ uc_crypto_dh_sharedkey(uc_vm_t *vm, size_t nargs)
 	    !(ctx = EVP_PKEY_CTX_new_from_pkey(NULL, pkey_priv, NULL)) ||
 	    EVP_PKEY_derive_init(ctx) < 1 ||
 	    EVP_PKEY_derive_set_peer(ctx, pkey_peer) < 1 ||
-	    EVP_PKEY_derive(ctx, NULL, &sharedlen) < 1)
+	    EVP_PKEY_derive(ctx, NULL, sharedlen) < 1)
 		goto out;
 
-	us = xalloc(sizeof(uc_string_t) + sharedlen + 1);
-	us->header.type = UC_STRING;
-	us->header.refcount = 1;
-	us->length = sharedlen;
+	shared = xalloc(*sharedlen);
 
-	if (EVP_PKEY_derive(ctx, (unsigned char *)us->str, &sharedlen) < 1) {
-		free(us);
-		us = NULL;
+	if (EVP_PKEY_derive(ctx, shared, sharedlen) < 1) {
+		free(shared);
+		shared = NULL;
 	}
 
 out:
@@ -291,17 +402,437 @@ out:
 	BN_free(peerbn);
 	BN_free(privbn);
 
-	return us ? &us->header : NULL;
+	return shared;
+}
+
+static uc_value_t *
+uc_crypto_dh_sharedkey(uc_vm_t *vm, size_t nargs)
+{
+	uc_value_t *privkey = uc_fn_arg(0), *peerkey = uc_fn_arg(1), *result;
+	unsigned char *shared;
+	size_t sharedlen;
+
+	if (ucv_type(privkey) != UC_STRING ||
+	    ucv_type(peerkey) != UC_STRING)
+		return NULL;
+
+	shared = dh_derive(
+		(unsigned char *)ucv_string_get(privkey), ucv_string_length(privkey),
+		(unsigned char *)ucv_string_get(peerkey), ucv_string_length(peerkey),
+		&sharedlen);
+
+	if (!shared)
+		return NULL;
+
+	result = ucv_string_new_length((char *)shared, sharedlen);
+	free(shared);
+
+	return result;
+}
+
+
+/*
+ * Asynchronous DH operations. Jobs are executed by a small pool of worker
+ * threads which never touch ucode values; completed jobs are collected on a
+ * list and signalled through an eventfd which the script side watches in
+ * uloop, calling async_complete() to invoke the pending callbacks in the
+ * main thread.
+ */
+
+#define ASYNC_MAX_THREADS 4
+#define REGISTRY_JOBS_KEY "umap.crypto.jobs"
+
+typedef enum {
+	ASYNC_DH_KEYPAIR,
+	ASYNC_DH_SHAREDKEY,
+	ASYNC_DH_POOL_FILL,
+} async_type_t;
+
+typedef struct async_job {
+	struct async_job *next;
+	async_type_t type;
+	char id[sizeof("18446744073709551615")];
+	unsigned char *privp, *peerp, *shared;
+	size_t privlen, peerlen, sharedlen;
+	EVP_PKEY *pkey;
+} async_job_t;
+
+typedef struct {
+	async_job_t *head, **tail;
+} async_list_t;
+
+static struct {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	async_list_t pending, done;
+	size_t nthreads;
+	uint64_t seq;
+	size_t refilling;
+	int efd;
+} async = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.cond = PTHREAD_COND_INITIALIZER,
+	.pending = { NULL, &async.pending.head },
+	.done = { NULL, &async.done.head },
+	.efd = -1
+};
+
+static void
+async_list_push(async_list_t *list, async_job_t *job)
+{
+	job->next = NULL;
+	*list->tail = job;
+	list->tail = &job->next;
+}
+
+static async_job_t *
+async_list_take(async_list_t *list)
+{
+	async_job_t *head = list->head;
+
+	list->head = NULL;
+	list->tail = &list->head;
+
+	return head;
 }
 
+static void
+async_signal(void)
+{
+	uint64_t one = 1;
+
+	if (write(async.efd, &one, sizeof(one)) < 0)
+		fprintf(stderr, "Unable to signal crypto job completion: %m\n");
+}
+
+static void *
+async_worker(void *arg)
+{
+	async_job_t *job;
+
+	while (true) {
+		pthread_mutex_lock(&async.lock);
+
+		while (!async.pending.head)
+			pthread_cond_wait(&async.cond, &async.lock);
+
+		job = async.pending.head;
+		async.pending.head = job->next;
+
+		if (!async.pending.head)
+			async.pending.tail = &async.pending.head;
+
+		pthread_mutex_unlock(&async.lock);
+
+		switch (job->type) {
+		case ASYNC_DH_KEYPAIR:
+		case ASYNC_DH_POOL_FILL:
+			job->pkey = dh_generate();
+			break;
+
+		case ASYNC_DH_SHAREDKEY:
+			job->shared = dh_derive(job->privp, job->privlen,
+				job->peerp, job->peerlen, &job->sharedlen);
+			break;
+		}
+
+		pthread_mutex_lock(&async.lock);
+		async_list_push(&async.done, job);
+		pthread_mutex_unlock(&async.lock);
+
+		async_signal();
+	}
+
+	return NULL;
+}
+
+static void
+async_job_free(async_job_t *job)
+{
+	EVP_PKEY_free(job->pkey);
+	free(job->privp);
+	free(job->peerp);
+	free(job->shared);
+	free(job);
+}
+
+static uc_value_t *
+async_job_result(uc_vm_t *vm, async_job_t *job)
+{
+	uc_value_t *result = NULL, *privkey = NULL, *pubkey = NULL;
+
+	switch (job->type) {
+	case ASYNC_DH_KEYPAIR:
+		if (!job->pkey ||
+		    !(privkey = pkey_get_key(job->pkey, OSSL_PKEY_PARAM_PRIV_KEY)) ||
+		    !(pubkey = pkey_get_key(job->pkey, OSSL_PKEY_PARAM_PUB_KEY))) {
+			ucv_put(privkey);
+
+			return NULL;
+		}
+
+		result = ucv_array_new_length(vm, 2);
+		ucv_array_push(result, privkey);
+		ucv_array_push(result, pubkey);
+		break;
+
+	case ASYNC_DH_SHAREDKEY:
+		if (job->shared)
+			result = ucv_string_new_length((char *)job->shared, job->sharedlen);
+
+		break;
+
+	case ASYNC_DH_POOL_FILL:
+		break;
+	}
+
+	return result;
+}
+
+static uc_value_t *
+async_submit(uc_vm_t *vm, async_job_t *job, uc_value_t *cb, bool completed)
+{
+	uc_value_t *jobs = uc_vm_registry_get(vm, REGISTRY_JOBS_KEY);
+
+	if (!jobs) {
+		jobs = ucv_object_new(vm);
+		uc_vm_registry_set(vm, REGISTRY_JOBS_KEY, jobs);
+	}
+
+	snprintf(job->id, sizeof(job->id), "%" PRIu64, async.seq++);
+	ucv_object_add(jobs, job->id, ucv_get(cb));
+
+	pthread_mutex_lock(&async.lock);
+
+	if (completed) {
+		async_list_push(&async.done, job);
+	}
+	else {
+		async_list_push(&async.pending, job);
+		pthread_cond_signal(&async.cond);
+	}
+
+	pthread_mutex_unlock(&async.lock);
+
+	if (completed)
+		async_signal();
+
+	return ucv_boolean_new(true);
+}
+
+/*
+ * Start the given number of worker threads (default 2) and return the
+ * eventfd descriptor to watch for job completions.
+ */
+static uc_value_t *
+uc_crypto_async_init(uc_vm_t *vm, size_t nargs)
+{
+	uc_value_t *threads = uc_fn_arg(0);
+	size_t n = 2;
+	pthread_t tid;
+
+	if (async.efd != -1)
+		return ucv_int64_new(async.efd);
+
+	if (ucv_type(threads) == UC_INTEGER)
+		n = ucv_uint64_get(threads);
+
+	if (n < 1 || n > ASYNC_MAX_THREADS)
+		n = (n < 1) ? 1 : ASYNC_MAX_THREADS;
+
+	/* group parameters are shared read-only by the workers */
+	if (!dh_group_init())
+		return NULL;
+
+	async.efd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+	if (async.efd == -1)
+		return NULL;
+
+	for (async.nthreads = 0; async.nthreads < n; async.nthreads++) {
+		if (pthread_create(&tid, NULL, async_worker, NULL) != 0)
+			break;
+
+		pthread_detach(tid);
+	}
+
+	if (async.nthreads == 0) {
+		close(async.efd);
+		async.efd = -1;
+
+		return NULL;
+	}
+
+	return ucv_int64_new(async.efd);
+}
+
+/*
+ * Invoke the callbacks of all completed jobs, returns the number of
+ * callbacks invoked. Should a callback throw an exception, the remaining
+ * jobs are retained for the next invocation.
+ */
+static uc_value_t *
+uc_crypto_async_complete(uc_vm_t *vm, size_t nargs)
+{
+	uc_value_t *jobs = uc_vm_registry_get(vm, REGISTRY_JOBS_KEY), *cb;
+	async_job_t *job, *next;
+	size_t count = 0;
+	uint64_t val;
+
+	if (async.efd == -1)
+		return NULL;
+
+	while (read(async.efd, &val, sizeof(val)) > 0)
+		;
+
+	pthread_mutex_lock(&async.lock);
+	job = async_list_take(&async.done);
+	pthread_mutex_unlock(&async.lock);
+
+	for (; job; job = next) {
+		next = job->next;
+
+		/* background pool refills have no callback, stash the key */
+		if (job->type == ASYNC_DH_POOL_FILL) {
+			if (job->pkey && dh_pool_len < DH_POOL_SIZE) {
+				dh_pool[dh_pool_len++] = job->pkey;
+				job->pkey = NULL;
+			}
+
+			async.refilling--;
+			async_job_free(job);
+			continue;
+		}
+
+		cb = ucv_get(ucv_object_get(jobs, job->id, NULL));
+		ucv_object_delete(jobs, job->id);
+
+		uc_vm_stack_push(vm, cb);
+		uc_vm_stack_push(vm, async_job_result(vm, job));
+
+		async_job_free(job);
+		count++;
+
+		if (uc_vm_call(vm, false, 1) != EXCEPTION_NONE) {
+			if (next) {
+				pthread_mutex_lock(&async.lock);
+
+				for (job = next; job->next; job = job->next)
+					;
+
+				job->next = async.done.head;
+
+				if (!async.done.head)
+					async.done.tail = &job->next;
+
+				async.done.head = next;
+				pthread_mutex_unlock(&async.lock);
+
+				async_signal();
+			}
+
+			return NULL;
+		}
+
+		ucv_put(uc_vm_stack_pop(vm));
+	}
+
+	return ucv_uint64_new(count);
+}
+
+static uc_value_t *
+uc_crypto_dh_keypair_async(uc_vm_t *vm, size_t nargs)
+{
+	uc_value_t *cb = uc_fn_arg(0);
+	async_job_t *job;
+
+	if (!ucv_is_callable(cb) || async.efd == -1)
+		return NULL;
+
+	job = xalloc(sizeof(*job));
+	job->type = ASYNC_DH_KEYPAIR;
+
+	/* serve from the pool if possible, the callback is still deferred */
+	if (dh_pool_len > 0) {
+		job->pkey = dh_pool[--dh_pool_len];
+
+		return async_submit(vm, job, cb, true);
+	}
+
+	return async_submit(vm, job, cb, false);
+}
+
+/*
+ * Queue keypair generation jobs for all pool slots which are neither filled
+ * nor already being refilled. The keys are added to the pool by
+ * async_complete(), returns the number of queued jobs.
+ */
+static uc_value_t *
+uc_crypto_dh_pool_fill_async(uc_vm_t *vm, size_t nargs)
+{
+	size_t n = 0;
+	async_job_t *job;
+
+	if (async.efd == -1)
+		return NULL;
+
+	pthread_mutex_lock(&async.lock);
+
+	while (dh_pool_len + async.refilling < DH_POOL_SIZE) {
+		job = xalloc(sizeof(*job));
+		job->type = ASYNC_DH_POOL_FILL;
+		async_list_push(&async.pending, job);
+		async.refilling++;
+		n++;
+	}
+
+	if (n > 0)
+		pthread_cond_broadcast(&async.cond);
+
+	pthread_mutex_unlock(&async.lock);
+
+	return ucv_uint64_new(n);
+}
+
+static uc_value_t *
+uc_crypto_dh_sharedkey_async(uc_vm_t *vm, size_t nargs)
+{
+	uc_value_t *privkey = uc_fn_arg(0), *peerkey = uc_fn_arg(1), *cb = uc_fn_arg(2);
+	async_job_t *job;
+
+	if (ucv_type(privkey) != UC_STRING ||
+	    ucv_type(peerkey) != UC_STRING ||
+	    !ucv_is_callable(cb) || async.efd == -1)
+		return NULL;
+
+	job = xalloc(sizeof(*job));
+	job->type = ASYNC_DH_SHAREDKEY;
+
+	job->privlen = ucv_string_length(privkey);
+	job->privp = xalloc(job->privlen);
+	memcpy(job->privp, ucv_string_get(privkey), job->privlen);
+
+	job->peerlen = ucv_string_length(peerkey);
+	job->peerp = xalloc(job->peerlen);
+	memcpy(job->peerp, ucv_string_get(peerkey), job->peerlen);
+
+	return async_submit(vm, job, cb, false);
+}
 
 static const uc_function_list_t crypto_functions[] = {
 	{ "sha256",       uc_crypto_sha256       },
 	{ "hmac_sha256",  uc_crypto_hmac_sha256  },
 	{ "aes_encrypt",  uc_crypto_aes_encrypt  },
 	{ "aes_decrypt",  uc_crypto_aes_decrypt  },
+	{ "kdf",          uc_crypto_kdf          },
 	{ "dh_keypair",   uc_crypto_dh_keypair   },
+	{ "dh_pool_fill", uc_crypto_dh_pool_fill },
 	{ "dh_sharedkey", uc_crypto_dh_sharedkey },
+	{ "dh_keypair_async",   uc_crypto_dh_keypair_async   },
+	{ "dh_sharedkey_async", uc_crypto_dh_sharedkey_async },
+	{ "dh_pool_fill_async", uc_crypto_dh_pool_fill_async },
+	{ "async_init",         uc_crypto_async_init         },
+	{ "async_complete",     uc_crypto_async_complete     },
 };
 
 void uc_module_init(uc_vm_t *vm, uc_value_t *scope) {
@@ -71,10 +71,10 @@ export default {
 	send: function (socket) {
 		return socket.send(socket.address, defs.LLDP_NEAREST_BRIDGE_MAC, pack('!3B6s 3B6s 2BH H',
 			(0x1 << 1), 7, 4,			// Chassis ID TLV, subtype 4 (LL address)
-			hexdec(this.chassis, ':'),	// Chassis ID TLV MAC
+			utils.ether_aton(this.chassis),	// Chassis ID TLV MAC
 
 			(0x2 << 1), 7, 3,			// Port ID TLV, subtype 3 (MAC)
-			hexdec(this.port, ':'),		// Port ID TLV MAC
+			utils.ether_aton(this.port),	// Port ID TLV MAC
 
 			(0x3 << 1), 2,				// TTL TLV
 			this.ttl, 					// TTL TLV value
@@ -22,11 +22,14 @@ import * as udebug from 'udebug';
 import * as sys from 'umap.core';
 import socket from 'umap.socket';
 import cmdu from 'umap.cmdu';
+import requests from 'umap.requests';
 import lldp from 'umap.lldp';
 import utils from 'umap.utils';
 import model from 'umap.model';
+import netcache from 'umap.netcache';
 import defs from 'umap.defs';
 import ubus from 'umap.ubus';
+import stats from 'umap.stats';
 import log from 'umap.log';
 
 import proto_topology from 'umap.proto.topology';
@@ -34,8 +37,27 @@ import proto_autoconf from 'umap.proto.autoconf';
 import proto_capab from 'umap.proto.capabilities';
 import proto_scanning from 'umap.proto.scanning';
 
+const SNAPSHOT_INTERVAL = 30000;
+
 const relayed_messages = utils.AgingDict(60000);
 
+const cmdu_handlers = {
+	requests: { handle_cmdu: (i1905lif, dstmac, srcmac, msg, al_mac) => requests.handle_reply(msg, srcmac, al_mac) },
+	topology: proto_topology,
+	autoconf: proto_autoconf,
+	capabilities: proto_capab,
+	scanning: proto_scanning
+};
+
+function run_handler(name, i1905lif, dstmac, srcmac, msg, al_mac) {
+	const start = stats.now();
+	const handled = cmdu_handlers[name].handle_cmdu(i1905lif, dstmac, srcmac, msg, al_mac);
+
+	stats.record('handler', name, start);
+
+	return handled;
+}
+
 function handle_i1905_cmdu(i1905lif, dstmac, srcmac, msg) {
 	let al_mac = msg.get_tlv(defs.TLV_IEEE1905_AL_MAC_ADDRESS);
 
@@ -56,35 +78,84 @@ function handle_i1905_cmdu(i1905lif, dstmac, srcmac, msg) {
 	// ignore packets looped back to us
 	if (al_mac == model.address) {
 		log.warn(`Ignoring CMDU originating from our AL MAC (network loop?)`);
+		stats.count('rx_dropped');
 		return;
 	}
 
+	const start = stats.now();
+
+	stats.count('rx_messages');
+	model.lookupDevice(al_mac ?? srcmac)?.updateSeenOn(i1905lif);
+
 	try {
-		const handled = msg.run_handler()
-		        || proto_topology.handle_cmdu(i1905lif, dstmac, srcmac, msg)
-		        || proto_autoconf.handle_cmdu(i1905lif, dstmac, srcmac, msg)
-		        || proto_capab.handle_cmdu(i1905lif, dstmac, srcmac, msg)
-		        || proto_scanning.handle_cmdu(i1905lif, dstmac, srcmac, msg)
+		const handled = run_handler('requests', i1905lif, dstmac, srcmac, msg, al_mac)
+		        || run_handler('topology', i1905lif, dstmac, srcmac, msg)
+		        || run_handler('autoconf', i1905lif, dstmac, srcmac, msg)
+		        || run_handler('capabilities', i1905lif, dstmac, srcmac, msg)
+		        || run_handler('scanning', i1905lif, dstmac, srcmac, msg)
 		        ;
 
-		if (!handled)
+		if (!handled) {
 			log.warn(`Not handling CMDU [${msg.mid}] ${utils.cmdu_type_ntoa(msg.type)}`);
+			stats.count('rx_unhandled');
+		}
 	} catch(e) {
 		log.exception(e);
+		stats.count('rx_errors');
 	}
 
-	if (msg.flags & defs.CMDU_F_ISRELAY) {
-		const key = `${al_mac}-${msg.mid}`;
+	stats.record('message', msg.type, start);
+}
+
+/*
+ * Relayed multicast CMDUs are forwarded fragment by fragment as they arrive,
+ * without waiting for reassembly. Fragments are sanity checked first and
+ * duplicates are detected using the source address and the CMDU header
+ * fields; once a message is found to loop, none of its remaining fragments
+ * are forwarded anymore.
+ */
+function relay_i1905_fragment(i1905lif, srcmac, payload) {
+	const hdr = cmdu.header(payload);
+
+	if (!hdr || !(hdr.flags & defs.CMDU_F_ISRELAY))
+		return;
+
+	// ignore packets looped back to us
+	if (srcmac == model.address || model.lookupLocalInterface(srcmac))
+		return;
+
+	if (!cmdu.relay_check(payload, hdr))
+		return log.debug(`Not relaying malformed CMDU [${hdr.mid}] fragment #${hdr.fid} from ${srcmac}`);
 
-		if (relayed_messages.has(key))
-			return log.warn(`Already relayed CMDU [${msg.mid}] from ${al_mac} (network loop?)`);
+	const msgkey = `${srcmac}-${hdr.type}-${hdr.mid}`;
+	const key = `${msgkey}-${hdr.fid}`;
 
-		for (let i1905lif2 in model.getLocalInterfaces())
-			if (i1905lif2.ieee1905 && i1905lif2.i1905sock != i1905lif.i1905sock)
-				msg.send(i1905lif2.i1905sock, srcmac, defs.IEEE1905_MULTICAST_MAC, defs.CMDU_F_ISRELAY);
+	// message originates from our own AL (network loop?)
+	if (hdr.al_mac == model.address)
+		relayed_messages.set(msgkey, false);
 
-		relayed_messages.set(key, true);
+	if (relayed_messages.get(msgkey) === false) {
+		stats.count('relay_duplicates');
+		return;
 	}
+
+	if (relayed_messages.has(key)) {
+		relayed_messages.set(msgkey, false);
+		stats.count('relay_duplicates');
+		return log.debug(`Already relayed CMDU [${hdr.mid}] fragment #${hdr.fid} from ${srcmac} (network loop?)`);
+	}
+
+	relayed_messages.set(msgkey, true);
+	relayed_messages.set(key, true);
+
+	let sockets = [];
+
+	for (let i1905lif2 in model.getLocalInterfaces())
+		if (i1905lif2.ieee1905 && i1905lif2.i1905sock != i1905lif.i1905sock)
+			push(sockets, i1905lif2.i1905sock);
+
+	if (length(sockets))
+		cmdu.relay(sockets, srcmac, defs.IEEE1905_MULTICAST_MAC, payload);
 }
 
 function handle_i1905_input(payload) {
@@ -93,13 +164,22 @@ function handle_i1905_input(payload) {
 	let i1905lif = model.lookupLocalInterface(sock);
 	if (!i1905lif) {
 		log.warn(`Received CMDU on unknown interface (${sock.ifname})`);
+		stats.count('rx_dropped');
 		return;
 	}
 
+	stats.count('rx_fragments');
+	relay_i1905_fragment(i1905lif, payload[1], payload[3]);
+
+	const start = stats.now();
 	let msg = cmdu.parse(payload[1], payload[3]);
 
-	if (!msg)
+	stats.record('parse', msg?.type ?? 'invalid', start);
+
+	if (!msg) {
 		log.debug('RX %-8s: %s > %s : Invalid CMDU', sock.ifname, payload[1], payload[0]);
+		stats.count('rx_invalid');
+	}
 	else if (msg.is_complete())
 		handle_i1905_cmdu(i1905lif, payload[0], payload[1], msg);
 }
@@ -150,6 +230,8 @@ export default function () {
 		'radio|phy|r=s*',
 		'controller',
 		'mac=s',
+		'rx-ring',
+		'snapshot=s',
 		'v+',
 		'help'
 	]);
@@ -173,7 +255,13 @@ export default function () {
 			'  Act as Multi-AP controller\n',
 			'\n',
 			'--mac MACADDR\n',
-			'  Specify the AL MAC address to use. If omitted, a suitable address is generated\n'
+			'  Specify the AL MAC address to use. If omitted, a suitable address is generated\n',
+			'\n',
+			'--rx-ring\n',
+			'  Receive frames through a memory mapped packet ring instead of one syscall per frame\n',
+			'\n',
+			'--snapshot PATH\n',
+			'  Periodically save the learned topology to the given file and resume from it on startup\n'
 		);
 	}
 
@@ -200,7 +288,10 @@ export default function () {
 	// FIXME: rework this
 	model.ubus = ubus;
 
+	netcache.init();
+
 	model.isController = !!opts.controller;
+	model.rxRing = !!opts['rx-ring'];
 	model.initializeAddress();
 
 	for (let ifname in opts.interface) {
@@ -254,10 +345,22 @@ export default function () {
 	if (!ubus.publish())
 		log.warn(`Unable to publish umap object: ${ubus.error()}`);
 
+	if (opts.snapshot) {
+		model.restoreSnapshot(opts.snapshot);
+
+		uloop.interval(SNAPSHOT_INTERVAL, () => {
+			if (model.snapshotGeneration !== model.topologyGeneration)
+				model.saveSnapshot(opts.snapshot);
+		});
+	}
+
 	if (length(model.interfaces) > 0)
 		proto_topology.start();
 
 	uloop.run();
 
+	if (opts.snapshot)
+		model.saveSnapshot(opts.snapshot);
+
 	return 0;
 };
@@ -14,10 +14,10 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
-import { request as wlrequest, 'const' as wlconst } from 'nl80211';
-import { request as rtrequest, listener as rtlistener, error as rterror, 'const' as rtconst } from 'rtnl';
+import { request as rtrequest, error as rterror, 'const' as rtconst } from 'rtnl';
 import { pack, unpack, buffer } from 'struct';
-import { access, open, readfile, lsdir } from 'fs';
+import { access, open, readfile, writefile, rename, lsdir } from 'fs';
+import { timer } from 'uloop';
 
 import socket from 'umap.socket';
 import brsocket from 'umap.socket-bridge';
@@ -26,9 +26,23 @@ import log from 'umap.log';
 import defs from 'umap.defs';
 import ubus from 'umap.ubusclient';
 import utils from 'umap.utils';
+import stats from 'umap.stats';
+import events from 'umap.events';
+import netcache from 'umap.netcache';
 
 import wireless from 'umap.wireless';
 
+const SELF_UPDATE_DELAY = 250;
+const STALE_TIMEOUT = 180000;
+const STALE_GRANULARITY = 5000;
+const TOPOLOGY_NOTIFY_DELAY = 500;
+const TOPOLOGY_MAX_TOMBSTONES = 256;
+const RUNTIME_INFO_MAX_AGE = 1000;
+const ROUTE_DEFAULT_COST = 100;
+const ROUTE_COST_SCALE = 1000;
+const ROUTE_COST_INTERVAL = 5000;
+const SNAPSHOT_VERSION = 1;
+
 function timems() {
 	let tv = clock(true) ?? clock(false);
 	return tv[0] * 1000 + tv[1] / 1000000;
@@ -36,14 +50,14 @@ function timems() {
 
 function decode_tlv(type, payload) {
 	if (type !== defs.TLV_EXTENDED) {
-		const decode = codec.decoder[type];
+		const decode = codec.find_decoder(type);
 
 		return decode?.(buffer(payload), length(payload));
 	}
 	else {
 		const buf = buffer(payload);
 		const subtype = buf.get('!H');
-		const decode = codec.extended_decoder[subtype];
+		const decode = codec.find_extended_decoder(subtype);
 
 		return decode?.(buf, length(payload));
 	}
@@ -53,13 +67,13 @@ function encode_tlv(type, ...args) {
 	let encode, payload;
 
 	if (type !== defs.TLV_EXTENDED) {
-		encode = codec.encoder[type];
+		encode = codec.find_encoder(type);
 		payload = encode?.(buffer(), ...args)?.pull?.();
 	}
 	else {
 		const subtype = shift(args);
 
-		encode = codec.extended_encoder[subtype];
+		encode = codec.find_extended_encoder(subtype);
 		payload = encode?.(buffer(), ...args)?.pull?.();
 	}
 
@@ -147,7 +161,7 @@ function encode_local_interface(i1905lif) {
 		if (info.wifi.interface.center_freq2)
 			chan2 = wireless.frequencyToChannel(info.wifi.interface.center_freq2) ?? 0;
 
-		media_info = pack('!6sBBBB', hexdec(info.wifi.interface.mac, ':'), role, chanbw, chan1, chan2);
+		media_info = pack('!6sBBBB', utils.ether_aton(info.wifi.interface.mac), role, chanbw, chan1, chan2);
 	}
 
 	return {
@@ -157,6 +171,13 @@ function encode_local_interface(i1905lif) {
 	};
 }
 
+/* path cost of a link, inversely proportional to its throughput in Mbit/s */
+function link_cost(metric) {
+	const throughput = metric?.throughput || metric?.speed;
+
+	return (throughput > 0) ? max(1, int(ROUTE_COST_SCALE / throughput)) : ROUTE_DEFAULT_COST;
+}
+
 function decode_media_info(tlv_local_interface) {
 	const ieee80211_roles = {
 		[0b00000000]: 'AP',
@@ -315,6 +336,13 @@ function check_non_ieee1905_bss(ifname) {
 const I1905Entity = {
 	update: function () {
 		this.seen = timems();
+		this.getExpiryWheel?.()?.touch(this, this.seen);
+
+		/* entries restored from a snapshot are confirmed by any fresh update */
+		if (this.unconfirmed) {
+			this.unconfirmed = false;
+			this.markChanged?.();
+		}
 	}
 };
 
@@ -353,6 +381,10 @@ const I1905RemoteInterface = proto({
 
 	getDevice: function () {
 		return this.dev;
+	},
+
+	getExpiryWheel: function () {
+		return model.expiry.interfaces;
 	}
 }, I1905Entity);
 
@@ -364,7 +396,9 @@ const I1905LocalInterface = proto({
 			sockbr,
 			pending: true,
 			ieee1905: false,
-			neighbors: []
+			neighbors: [],
+			neighborsByAddress: {},
+			neighborsByDevice: {}
 		}, this);
 
 		ifc.init();
@@ -385,47 +419,62 @@ const I1905LocalInterface = proto({
 
 		let socktype = this.sockbr ?? socket;
 
-		if (!(this.i1905sock = socktype.create(link.ifname, socket.const.ETH_P_1905, this.vlan)))
+		if (!(this.i1905sock = socktype.create(link.ifname, socket.const.ETH_P_1905, this.vlan, model.rxRing)))
 			die(`Unable to spawn IEEE 1905 TX socket on ${link.ifname}: ${socket.error()}`);
 
-		if (!(this.lldpsock = socktype.create(link.ifname, socket.const.ETH_P_LLDP, this.vlan)))
+		if (!(this.lldpsock = socktype.create(link.ifname, socket.const.ETH_P_LLDP, this.vlan, model.rxRing)))
 			die(`Unable to spawn LLDP TX socket on ${link.ifname}: ${socket.error()}`);
 
 		this.ieee1905 = !check_non_ieee1905_bss(this.ifname);
 		this.address = link.address;
 		this.pending = false;
 
+		model.localInterfacesByAddress[this.address] = this;
+
 		return true;
 	},
 
 	addNeighbor: function (i1905if) {
-		if (!(i1905if in this.neighbors)) {
+		if (this.neighborsByAddress[i1905if.address] !== i1905if) {
 			log.debug('Adding new link %s/%s -> %s', this.ifname, this.address, i1905if.address);
 			push(this.neighbors, i1905if);
+			this.neighborsByAddress[i1905if.address] = i1905if;
+			this.neighborsByDevice[i1905if.dev.al_address] ??= i1905if;
 			model.topologyChanged = true;
+			model.routesGeneration = null;
+			model.markSelfDirty(`neigh:${this.ifname}`);
 		}
 
 		return i1905if;
 	},
 
+	reindexNeighbors: function () {
+		this.neighborsByAddress = {};
+		this.neighborsByDevice = {};
+
+		for (let i1905if in this.neighbors) {
+			this.neighborsByAddress[i1905if.address] = i1905if;
+			this.neighborsByDevice[i1905if.dev.al_address] ??= i1905if;
+		}
+	},
+
 	getNeighbors: function () {
 		return [...this.neighbors];
 	},
 
 	lookupNeighbor: function (lookup) {
 		if (proto(lookup) === I1905Device) {
-			for (let i1905rif in this.neighbors)
-				if (i1905rif.dev === lookup)
-					return i1905rif;
+			const i1905rif = this.neighborsByDevice[lookup.al_address];
+
+			if (i1905rif?.dev === lookup)
+				return i1905rif;
 		}
 		else if (proto(lookup) === I1905RemoteInterface) {
-			if (lookup in this.neighbors)
+			if (this.neighborsByAddress[lookup.address] === lookup)
 				return lookup;
 		}
 		else if (type(lookup) == 'string') {
-			for (let i1905rif in this.neighbors)
-				if (i1905rif.address == lookup || i1905rif.dev?.al_address == lookup)
-					return i1905rif;
+			return this.neighborsByAddress[lookup] ?? this.neighborsByDevice[lookup];
 		}
 	},
 
@@ -639,28 +688,26 @@ const I1905LocalInterface = proto({
 			return this.info;
 
 		let ifname = this.i1905sock?.ifname ?? this.ifname,
-			link = rtrequest(rtconst.RTM_GETLINK, 0, { dev: ifname }),
-			wifi = wlrequest(wlconst.NL80211_CMD_GET_INTERFACE, 0, { dev: ifname }),
-			wphy = wlrequest(wlconst.NL80211_CMD_GET_WIPHY, 0, { dev: ifname }),
-			wsta = wlrequest(wlconst.NL80211_CMD_GET_STATION, wlconst.NLM_F_DUMP, { dev: ifname });
+			link = netcache.getLink(ifname, RUNTIME_INFO_MAX_AGE),
+			wifi = netcache.getWifi(ifname);
 
 		return (this.info = link ? {
 			ifname,
 			address: link.address,
 			statistics: link.stats64,
 			bridge: (link.linkinfo?.slave?.type == 'bridge') ? link.master : null,
-			speed: +readfile(`/sys/class/net/${ifname}/speed`),
-			mtu: +readfile(`/sys/class/net/${ifname}/mtu`),
-			wifi: (wifi && wphy) ? {
-				phy: wphy,
-				interface: wifi,
-				stations: wsta ?? []
+			speed: +netcache.getSysfs(ifname, 'speed'),
+			mtu: +netcache.getSysfs(ifname, 'mtu'),
+			wifi: wifi ? {
+				phy: wifi.phy,
+				interface: wifi.interface,
+				stations: netcache.getStations(ifname, RUNTIME_INFO_MAX_AGE)
 			} : null
 		} : { ifname });
 	},
 
 	getLinkMetrics: function (remote_address) {
-		let ifinfo = this.getRuntimeInformation();
+		let ifinfo = this.getRuntimeInformation(true);
 
 		let res = {
 			tx_errors: 0,
@@ -709,22 +756,24 @@ const I1905LocalInterface = proto({
 		return res;
 	},
 
-	collectGarbage: function (now) {
-		let changed = 0;
+	removeNeighbor: function (i1905if) {
+		if (!(i1905if.address in this.neighborsByAddress))
+			return false;
 
-		now ??= timems();
+		let count = length(this.neighbors);
 
-		for (let i = 0; i < length(this.neighbors);) {
-			if (now - this.neighbors[i].seen > 180000) {
-				log.debug('Removing stale link %s/%s -> %s', this.ifname, this.address, this.neighbors[i].address);
-				changed |= !!splice(this.neighbors, i, 1);
-			}
-			else {
-				changed |= this.neighbors[i++].collectGarbage(now);
-			}
-		}
+		this.neighbors = filter(this.neighbors, neigh => neigh !== i1905if);
 
-		return (changed != 0);
+		if (length(this.neighbors) == count)
+			return false;
+
+		log.debug('Removing stale link %s/%s -> %s', this.ifname, this.address, i1905if.address);
+
+		this.reindexNeighbors();
+		model.markSelfDirty(`neigh:${this.ifname}`);
+		model.routesGeneration = null;
+
+		return true;
 	}
 }, I1905Entity);
 
@@ -777,7 +826,7 @@ const I1905LocalBridge = proto({
 		this.link = link;
 		this.pending = false;
 		if (!model.sockbr[bridge]) {
-			let sockbr = brsocket.create(bridge + '-umap', model.address);
+			let sockbr = brsocket.create(bridge + '-umap', model.address, model.rxRing);
 			if (!sockbr)
 				return log.error(`Error creating bridge socket: ${brsocket.error()}`);
 			model.sockbr[bridge] = sockbr;
@@ -835,13 +884,37 @@ I1905Device = proto({
 		return proto({
 			al_address,
 			tlvs: {},
+			decoded: {},
 			interfaces: [],
+			interfacesByAddress: {},
+			tlvExpiry: {},
+			seenOn: null,
+			generation: 0,
 			seen: timems()
 		}, this);
 	},
 
+	markChanged: function () {
+		this.generation = model.bumpTopologyGeneration();
+	},
+
+	updateSeenOn: function (i1905lif) {
+		this.seenOn = i1905lif;
+	},
+
+	getSeenOn: function () {
+		const i1905lif = this.seenOn;
+
+		if (!i1905lif?.ieee1905 || model.lookupLocalInterface(i1905lif.ifname) !== i1905lif)
+			return null;
+
+		return i1905lif;
+	},
+
 	updateTLVs: function (tlvs) {
 		let updated = false;
+		let changed = false;
+		let replaced = {};
 		let now = timems();
 
 		for (let tlv in tlvs) {
@@ -875,13 +948,17 @@ I1905Device = proto({
 				case defs.TLV_AP_HE_CAPABILITIES:
 					if (!this.tlvs[tlv.type]) {
 						this.tlvs[tlv.type] = [now];
+						changed = true;
 					}
 					else if (this.tlvs[tlv.type][0] < now) {
+						replaced[tlv.type] = join('', slice(this.tlvs[tlv.type], 1));
 						splice(this.tlvs[tlv.type], 0);
 						this.tlvs[tlv.type][0] = now;
+						delete this.decoded[tlv.type];
 					}
 
 					push(this.tlvs[tlv.type], tlv.payload);
+					model.expiry.tlvs.touch(this.tlvExpiry[tlv.type] ??= { dev: this, type: tlv.type }, now);
 					updated = true;
 					break;
 			}
@@ -890,6 +967,26 @@ I1905Device = proto({
 		if (updated)
 			this.update();
 
+		for (let type, payload in replaced) {
+			if (changed)
+				break;
+
+			changed = (payload != join('', slice(this.tlvs[type], 1)));
+		}
+
+		if (changed)
+			this.markChanged();
+
+		/* our own neighbor TLVs list addresses learned behind remote interfaces */
+		if (this !== model.getLocalDevice()) {
+			for (let type in [ defs.TLV_L2_NEIGHBOR_DEVICE, defs.TLV_NON_IEEE1905_NEIGHBOR_DEVICES, defs.TLV_IEEE1905_RECEIVER_LINK_METRIC ]) {
+				if (replaced[type] != null && replaced[type] != join('', slice(this.tlvs[type], 1))) {
+					model.markSelfDirty('neighbors');
+					break;
+				}
+			}
+		}
+
 		return updated;
 	},
 
@@ -901,24 +998,50 @@ I1905Device = proto({
 		}
 		else {
 			iface = push(this.interfaces, I1905RemoteInterface.new(address, this));
+			iface.update();
+			this.interfacesByAddress[address] = iface;
+			model.remoteInterfacesByAddress[address] = iface;
 			log.debug('Adding new interface %s to device %s', address, this.al_address);
+			this.markChanged();
+
+			if (this !== model.getLocalDevice())
+				model.markSelfDirty('neighbors');
 		}
 
 		return iface;
 	},
 
 	lookupInterface: function (address) {
-		for (let iface in this.interfaces)
-			if (iface.address == address)
-				return iface;
-
-		return null;
+		return this.interfacesByAddress[address];
 	},
 
 	getInterfaces: function () {
 		return [...this.interfaces];
 	},
 
+	unindexInterface: function (iface) {
+		if (this.interfacesByAddress[iface.address] === iface)
+			delete this.interfacesByAddress[iface.address];
+
+		if (model.remoteInterfacesByAddress[iface.address] === iface)
+			delete model.remoteInterfacesByAddress[iface.address];
+	},
+
+	decodeTLV: function (type, index) {
+		const payloads = this.tlvs[type];
+
+		if (index < 1 || index >= length(payloads))
+			return null;
+
+		// reuse cached decode results while the receive timestamp is unchanged
+		let cache = this.decoded[type];
+
+		if (cache?.[0] !== payloads[0])
+			cache = this.decoded[type] = [ payloads[0] ];
+
+		return (cache[index] ??= decode_tlv(+type, payloads[index]));
+	},
+
 	isBridged: function () {
 		for (let iface in this.interfaces)
 			if (iface.isBridged())
@@ -942,10 +1065,10 @@ I1905Device = proto({
 	},
 
 	getInterfaceInformation: function () {
-		let d = this.tlvs[defs.TLV_IEEE1905_DEVICE_INFORMATION]?.[1];
+		let d = this.decodeTLV(defs.TLV_IEEE1905_DEVICE_INFORMATION, 1);
 		let interfaces = {};
 
-		for (let iface in decode_tlv(defs.TLV_IEEE1905_DEVICE_INFORMATION, d)?.local_interfaces) {
+		for (let iface in d?.local_interfaces) {
 			interfaces[iface.local_if_mac_address] ??= {
 				...iface,
 				media_specific_information: decode_media_info(iface)
@@ -964,14 +1087,14 @@ I1905Device = proto({
 	},
 
 	getIdentification: function () {
-		let d = this.tlvs[defs.TLV_DEVICE_IDENTIFICATION]?.[1];
+		let d = this.decodeTLV(defs.TLV_DEVICE_IDENTIFICATION, 1);
 
 		if (!d)
 			return null;
 
-		const id = decode_tlv(defs.TLV_DEVICE_IDENTIFICATION, d);
+		const id = {};
 
-		for (let k, v in id)
+		for (let k, v in d)
 			id[k] = trim(v);
 
 		return id;
@@ -982,7 +1105,7 @@ I1905Device = proto({
 
 		for (let type in [defs.TLV_IEEE1905_RECEIVER_LINK_METRIC, defs.TLV_IEEE1905_TRANSMITTER_LINK_METRIC]) {
 			for (let i = 1; i < length(this.tlvs[type]); i++) {
-				let d = decode_tlv(+type, this.tlvs[type][i]);
+				let d = this.decodeTLV(type, i);
 
 				for (let link in d?.link_metrics) {
 					links[link.local_if_mac_address] ??= {};
@@ -1022,12 +1145,39 @@ I1905Device = proto({
 		return links;
 	},
 
+	/*
+	 * Returns the path costs towards the neighbor AL addresses and remote
+	 * interface addresses reported by this device, cached until the device
+	 * TLVs change.
+	 */
+	getAdjacency: function () {
+		if (this.adjacency?.generation === this.generation)
+			return this.adjacency;
+
+		const adj = { generation: this.generation, devices: {}, interfaces: {} };
+		const type = defs.TLV_IEEE1905_NEIGHBOR_DEVICES;
+
+		for (let i = 1; i < length(this.tlvs[type]); i++)
+			for (let neighbor in this.decodeTLV(type, i)?.ieee1905_neighbors)
+				adj.devices[neighbor.neighbor_al_mac_address] = ROUTE_DEFAULT_COST;
+
+		for (let local_address, remotes in this.getLinks())
+			for (let remote_address, metric in remotes)
+				adj.interfaces[remote_address] = min(adj.interfaces[remote_address] ?? ROUTE_DEFAULT_COST, link_cost(metric));
+
+		/* let route computation tell link changes apart from cost changes */
+		adj.links = join(',', [ ...keys(adj.devices), ...keys(adj.interfaces) ]);
+		adj.costs = join(',', values(adj.interfaces));
+
+		return (this.adjacency = adj);
+	},
+
 	getIPAddrs: function () {
 		let interfaces = {};
 
 		for (let type in [defs.TLV_IPV4, defs.TLV_IPV6]) {
 			for (let i = 1; i < length(this.tlvs[type]); i++) {
-				for (let d in decode_tlv(type, this.tlvs[type][i])) {
+				for (let d in this.decodeTLV(type, i)) {
 					let ifc = (interfaces[d.address] ??= {
 						ipaddrs: [],
 						ip6addrs: [],
@@ -1051,23 +1201,23 @@ I1905Device = proto({
 
 	getBackhaulSTACapability: function (radio_unique_identifier) {
 		const type = defs.TLV_BACKHAUL_STA_RADIO_CAPABILITIES;
-		const ruid = hexdec(radio_unique_identifier, ':');
+		const ruid = utils.ether_aton(radio_unique_identifier);
 
 		for (let i = 1; i < length(this.tlvs[type]); i++)
 			if (ruid != null && substr(this.tlvs[type][i], 0, 6) === ruid)
-				return decode_tlv(type, this.tlvs[type][i]);
+				return this.decodeTLV(type, i);
 	},
 
 	getBasicAPCapability: function (radio_unique_identifier) {
 		const type = defs.TLV_AP_RADIO_BASIC_CAPABILITIES;
-		const ruid = hexdec(radio_unique_identifier, ':');
+		const ruid = utils.ether_aton(radio_unique_identifier);
 		let rv;
 
 		for (let i = 1; i < length(this.tlvs[type]); i++)
 			if (ruid != null && substr(this.tlvs[type][i], 0, 6) === ruid)
-				return decode_tlv(type, this.tlvs[type][i]);
+				return this.decodeTLV(type, i);
 			else if (ruid == null)
-				push(rv ??= [], decode_tlv(type, this.tlvs[type][i]));
+				push(rv ??= [], this.decodeTLV(type, i));
 
 		return rv;
 	},
@@ -1080,11 +1230,11 @@ I1905Device = proto({
 				//let neighbor, addresses;
 				switch (+type) {
 					//case defs.TLV_IEEE1905_DEVICE_INFORMATION:
-					//	res.info = decode_tlv(+type, tlvs[i]);
+					//	res.info = this.decodeTLV(type, i);
 					//	break;
 
 					case defs.TLV_IEEE1905_NEIGHBOR_DEVICES:
-						let neighbor = decode_tlv(+type, tlvs[i]);
+						let neighbor = this.decodeTLV(type, i);
 						if (neighbor) {
 							res.neighbors ??= {};
 							push(res.neighbors.ieee1905 ??= [], neighbor);
@@ -1092,7 +1242,7 @@ I1905Device = proto({
 						break;
 
 					case defs.TLV_NON_IEEE1905_NEIGHBOR_DEVICES:
-						let addresses = decode_tlv(+type, tlvs[i]);
+						let addresses = this.decodeTLV(type, i);
 						if (addresses) {
 							res.neighbors ??= {};
 
@@ -1105,50 +1255,50 @@ I1905Device = proto({
 
 					//case defs.TLV_IEEE1905_TRANSMITTER_LINK_METRIC:
 					//	res.metrics ??= {};
-					//	push(res.metrics.tx ??= [], decode_tlv(+type, tlvs[i]));
+					//	push(res.metrics.tx ??= [], this.decodeTLV(type, i));
 					//	break;
 
 					//case defs.TLV_IEEE1905_RECEIVER_LINK_METRIC:
 					//	res.metrics ??= {};
-					//	push(res.metrics.rx ??= [], decode_tlv(+type, tlvs[i]));
+					//	push(res.metrics.rx ??= [], this.decodeTLV(type, i));
 					//	break;
 
 					case defs.TLV_L2_NEIGHBOR_DEVICE:
-						res.l2 = decode_tlv(+type, tlvs[i]);
+						res.l2 = this.decodeTLV(type, i);
 						break;
 
 					case defs.TLV_IPV4:
 						res.ipv4 ??= [];
-						push(res.ipv4, ...decode_tlv(+type, tlvs[i]));
+						push(res.ipv4, ...this.decodeTLV(type, i));
 						break;
 
 					case defs.TLV_IPV6:
 						res.ipv6 ??= [];
-						push(res.ipv6, ...decode_tlv(+type, tlvs[i]));
+						push(res.ipv6, ...this.decodeTLV(type, i));
 						break;
 
 					case defs.TLV_SUPPORTED_SERVICE:
 						res.map ??= {};
-						res.map.supported_services = decode_tlv(+type, tlvs[i]);
+						res.map.supported_services = this.decodeTLV(type, i);
 						break;
 
 					case defs.TLV_SUPPORTED_SERVICE:
 						res.map ??= {};
-						res.map.searched_services = decode_tlv(+type, tlvs[i]);
+						res.map.searched_services = this.decodeTLV(type, i);
 						break;
 
 					case defs.TLV_AP_OPERATIONAL_BSS:
 						res.map ??= {};
-						res.map.ap_operational_bss = decode_tlv(+type, tlvs[i]);
+						res.map.ap_operational_bss = this.decodeTLV(type, i);
 						break;
 
 					case defs.TLV_AP_RADIO_IDENTIFIER:
 						res.map ??= {};
-						res.map.ap_radio_identifier = decode_tlv(+type, tlvs[i]);
+						res.map.ap_radio_identifier = this.decodeTLV(type, i);
 						break;
 
 					case defs.TLV_ASSOCIATED_CLIENTS:
-						for (let bss in decode_tlv(+type, tlvs[i])) {
+						for (let bss in this.decodeTLV(type, i)) {
 							for (let client in bss.clients) {
 								res.neighbors ??= {};
 								res.neighbors.others ??= {};
@@ -1164,18 +1314,18 @@ I1905Device = proto({
 
 					case defs.TLV_AP_METRICS:
 						res.map ??= {};
-						res.map.ap_metrics = decode_tlv(+type, tlvs[i]);
+						res.map.ap_metrics = this.decodeTLV(type, i);
 						break;
 
 					case defs.TLV_MULTI_AP_PROFILE:
 						res.map ??= {};
-						for (let k, v in decode_tlv(+type, tlvs[i]))
+						for (let k, v in this.decodeTLV(type, i))
 							res.map[k] = v;
 						break;
 
 					case defs.TLV_PROFILE_2_AP_CAPABILITY:
 						res.map ??= {};
-						res.map.capabilities = decode_tlv(+type, tlvs[i]);
+						res.map.capabilities = this.decodeTLV(type, i);
 						break;
 				}
 			}
@@ -1203,26 +1353,8 @@ I1905Device = proto({
 		return res;
 	},
 
-	collectGarbage: function (now) {
-		let changed = 0;
-
-		now ??= timems();
-
-		for (let i = 0; i < length(this.interfaces);) {
-			if (now - this.interfaces[i].seen > 180000) {
-				log.debug('Removing stale interface %s from device %s', this.interfaces[i].address, this.al_address);
-				changed |= !!splice(this.interfaces, i, 1);
-			}
-			else {
-				i++;
-			}
-		}
-
-		for (let k, v in this.tlvs)
-			if (now - v[0] > 180000)
-				changed |= delete this.tlvs[k];
-
-		return (changed != 0);
+	getExpiryWheel: function () {
+		return model.expiry.devices;
 	}
 }, I1905Entity);
 
@@ -1232,9 +1364,33 @@ model = proto({
 	bridges: {},
 	sockbr: {},
 	devices: [],
+	devicesByAddress: {},
+	remoteInterfacesByAddress: {},
+	localInterfacesByAddress: {},
 	radios: [],
 	topologyChanged: false,
 	isController: false,
+	rxRing: false,
+	selfTLVs: {},
+	selfDirty: {},
+	selfUpdatePending: false,
+	selfLinkMetricsUpdated: 0,
+	topologyGeneration: 0,
+	/* identifies this daemon instance, generations restart with every run */
+	topologyEpoch: trim(readfile('/proc/sys/kernel/random/uuid') ?? '') || sprintf('%08x', time()),
+	topologyHorizon: 0,
+	topologyRemoved: {},
+	topologyNotifyPending: false,
+	snapshotGeneration: null,
+	routes: {},
+	routesGeneration: null,
+	routesComputed: 0,
+	routesSignatures: {},
+	expiry: {
+		devices: utils.ExpiryWheel(STALE_TIMEOUT, STALE_GRANULARITY),
+		interfaces: utils.ExpiryWheel(STALE_TIMEOUT, STALE_GRANULARITY),
+		tlvs: utils.ExpiryWheel(STALE_TIMEOUT, STALE_GRANULARITY)
+	},
 	seen: timems(),
 
 	initializeAddress: function () {
@@ -1263,7 +1419,7 @@ model = proto({
 		}
 
 		/* ... hash its bytes ... */
-		mac = unpack('!6B', hexdec(mac, ':'));
+		mac = unpack('!6B', utils.ether_aton(mac));
 
 		hash = ((hash << 5) - hash) + mac[0];
 		hash = ((hash << 5) - hash) + mac[1];
@@ -1274,11 +1430,11 @@ model = proto({
 		hash = ((hash << 5) - hash) + this.isController;
 
 		/* ... and turn result into a locally administered MAC */
-		this.address = sprintf('%02x:%02x:%02x:%02x:%02x:%02x',
+		this.address = utils.ether_ntoa(pack('6B',
 			0x02 | ((hash >> 40) & 0xfe),
 			(hash >> 32) & 0xff, (hash >> 24) & 0xff,
 			(hash >> 16) & 0xff, (hash >> 8) & 0xff,
-			(hash >> 0) & 0xff);
+			(hash >> 0) & 0xff));
 
 		log.info(`Using AL MAC address: ${this.address}`);
 
@@ -1291,9 +1447,8 @@ model = proto({
 	observeDeviceChanges: function (port_change_cb) {
 		const interfaces = this.interfaces;
 		const bridges = this.bridges;
-		const ubus = this.ubus;
 
-		rtlistener(function (rtevent) {
+		events.register('netcache.link', function (rtevent) {
 			const ifname = rtevent.msg.ifname;
 
 			//try {
@@ -1319,7 +1474,7 @@ model = proto({
 				if (brvlan != null) {
 					/* attempt to find netdev name via ubus */
 					for (let name in bridges) {
-						let devstat = ubus.call('network.device', 'status', { name });
+						let devstat = netcache.getDeviceStatus(name);
 
 						if (devstat?.devtype != 'vlan' || devstat?.vid != brvlan)
 							continue;
@@ -1378,7 +1533,7 @@ model = proto({
 			//} catch (e) {
 			//	log.debug(`EXCEPTION IN LISTENER: ${e} ${{ ...e }}`)
 			//}
-		}, [rtconst.RTM_NEWLINK, rtconst.RTM_DELLINK]);
+		});
 	},
 
 	addLocalInterface: function (ifname) {
@@ -1386,14 +1541,26 @@ model = proto({
 	},
 
 	lookupLocalInterface: function (value) {
-		for (let k, ifc in this.interfaces) {
-			if (ifc.pending)
-				continue;
+		let ifc;
+
+		if (type(value) == 'string') {
+			ifc = this.interfaces[value];
+
+			if (ifc?.pending || ifc?.ifname != value) {
+				ifc = this.localInterfacesByAddress[value];
+
+				if (ifc?.address != value)
+					return null;
+			}
+		}
+		else {
+			ifc = this.interfaces[value?.ifname];
 
-			if (ifc.ifname == value || ifc.address == value ||
-				ifc.i1905sock == value || ifc.lldpsock == value)
-				return ifc;
+			if (ifc?.i1905sock != value && ifc?.lldpsock != value)
+				return null;
 		}
+
+		return ifc?.pending ? null : ifc;
 	},
 
 	getLocalInterfaces: function () {
@@ -1421,6 +1588,11 @@ model = proto({
 		}
 		else {
 			dev = push(this.devices, I1905Device.new(al_address));
+			dev.update();
+			dev.markChanged();
+			dev.created = dev.generation;
+			delete this.topologyRemoved[al_address];
+			this.devicesByAddress[al_address] = dev;
 			this.topologyChanged = true;
 			log.debug('Adding new neighbor device %s', al_address);
 		}
@@ -1429,11 +1601,8 @@ model = proto({
 	},
 
 	lookupDevice: function (address) {
-		for (let dev in this.devices)
-			if (dev.al_address == address || dev.lookupInterface(address))
-				return dev;
-
-		return null;
+		return this.devicesByAddress[address] ??
+			this.remoteInterfacesByAddress[address]?.dev;
 	},
 
 	getLocalDevice: function () {
@@ -1460,124 +1629,468 @@ model = proto({
 		return [...wireless.radios];
 	},
 
+	/*
+	 * Compute the egress interface towards each known device using
+	 * Dijkstra's algorithm over the neighbor and link metric information
+	 * held in the model. Routes are only recomputed when a device changed
+	 * its set of links; changes which only affect link costs are coalesced
+	 * and applied at most every ROUTE_COST_INTERVAL ms, the next hops
+	 * computed before remain usable meanwhile.
+	 */
+	updateRoutes: function () {
+		if (this.routesGeneration === this.topologyGeneration)
+			return this.routes;
+
+		const self = this.getLocalDevice();
+		const selfLinks = self?.getLinks() ?? {};
+		const dist = {}, via = {}, done = {};
+		let hopLinks = [], hopCosts = [];
+
+		for (let ifname, i1905lif in this.interfaces) {
+			if (!i1905lif.ieee1905 || i1905lif.pending)
+				continue;
+
+			for (let i1905rif in i1905lif.neighbors) {
+				const al = i1905rif.dev.al_address;
+				const cost = link_cost(selfLinks[i1905lif.address]?.[i1905rif.address]);
+
+				push(hopLinks, `${ifname}/${al}`);
+				push(hopCosts, cost);
+
+				if (al != this.address && (dist[al] == null || cost < dist[al])) {
+					dist[al] = cost;
+					via[al] = i1905lif;
+				}
+			}
+		}
+
+		hopLinks = join(',', hopLinks);
+		hopCosts = join(',', hopCosts);
+
+		let relink = (this.routesGeneration == null || this.routesSignatures[''][0] !== hopLinks);
+		let recost = (!relink && this.routesSignatures[''][1] !== hopCosts);
+
+		for (let al_address, gen in this.topologyRemoved)
+			if (gen > this.routesGeneration)
+				relink = true;
+
+		for (let i = 1; !relink && i < length(this.devices); i++) {
+			const dev = this.devices[i];
+
+			if (dev.generation <= this.routesGeneration)
+				continue;
+
+			const adj = dev.getAdjacency();
+			const prev = this.routesSignatures[dev.al_address];
+
+			if (prev?.[0] !== adj.links)
+				relink = true;
+			else if (prev[1] !== adj.costs)
+				recost = true;
+		}
+
+		// nothing route relevant changed
+		if (!relink && !recost) {
+			this.routesGeneration = this.topologyGeneration;
+
+			return this.routes;
+		}
+
+		// cost only changes, keep the current routes for now
+		if (!relink && timems() - this.routesComputed < ROUTE_COST_INTERVAL)
+			return this.routes;
+
+		while (true) {
+			let current = null;
+
+			for (let al, d in dist)
+				if (!done[al] && (current == null || d < dist[current]))
+					current = al;
+
+			if (current == null)
+				break;
+
+			done[current] = true;
+
+			const adj = this.devicesByAddress[current]?.getAdjacency();
+
+			if (!adj)
+				continue;
+
+			const relax = (al, cost) => {
+				if (al == null || al == this.address || done[al])
+					return;
+
+				if (dist[al] == null || dist[current] + cost < dist[al]) {
+					dist[al] = dist[current] + cost;
+					via[al] = via[current];
+				}
+			};
+
+			for (let address, cost in adj.interfaces)
+				relax(this.remoteInterfacesByAddress[address]?.dev.al_address, cost);
+
+			for (let al, cost in adj.devices)
+				relax(al, cost);
+		}
+
+		const signatures = { '': [ hopLinks, hopCosts ] };
+
+		for (let i = 1; i < length(this.devices); i++) {
+			const adj = this.devices[i].getAdjacency();
+
+			signatures[this.devices[i].al_address] = [ adj.links, adj.costs ];
+		}
+
+		this.routes = via;
+		this.routesSignatures = signatures;
+		this.routesGeneration = this.topologyGeneration;
+		this.routesComputed = timems();
+
+		return this.routes;
+	},
+
+	lookupRoute: function (al_address) {
+		const i1905lif = this.updateRoutes()[this.lookupDevice(al_address)?.al_address ?? al_address];
+
+		if (!i1905lif?.ieee1905 || this.lookupLocalInterface(i1905lif.ifname) !== i1905lif)
+			return null;
+
+		return i1905lif;
+	},
+
+	sendUnicast: function (cmdu, destination, flags) {
+		const i1905lif = this.lookupRoute(destination) ?? this.lookupDevice(destination)?.getSeenOn();
+
+		if (!i1905lif)
+			return this.sendMulticast(cmdu, destination, flags);
+
+		cmdu.send(i1905lif.i1905sock, this.address, destination, flags ?? 0);
+
+		return true;
+	},
+
 	sendController: function (cmdu, flags) {
 		if (!this.networkController)
 			return false;
 
-		cmdu.send(this.networkController.i1905lif.i1905sock,
+		const i1905lif = this.lookupRoute(this.networkController.address) ?? this.networkController.i1905lif;
+
+		cmdu.send(i1905lif.i1905sock,
 			this.address, this.networkController.address, flags ?? 0);
 
 		return true;
 	},
 
 	sendMulticast: function (cmdu, destination, flags) {
+		let sockets = [];
+
 		for (let ifname, i1905lif in this.interfaces)
 			if (i1905lif.ieee1905)
-				cmdu.send(i1905lif.i1905sock, this.address,
-					destination ?? defs.IEEE1905_MULTICAST_MAC, flags ?? 0);
+				push(sockets, i1905lif.i1905sock);
+
+		if (length(sockets))
+			cmdu.send_multi(sockets, this.address,
+				destination ?? defs.IEEE1905_MULTICAST_MAC, flags ?? 0);
 	},
 
-	updateSelf: function () {
-		let ifstatus = ubus.call('network.interface', 'dump')?.interface ?? [];
+	observeSelfChanges: function () {
+		const self = this;
+
+		events.register('netcache.neighbor', ev => self.markSelfDirty(`neigh:${ev.ifname}`));
+		events.register('netcache.station', ev => self.markSelfDirty(`if:${ev.ifname}`));
+		const linkUp = {};
+
+		events.register('netcache.address', () => self.markSelfDirty('ipaddr'));
+		events.register('netcache.link', rtevent => {
+			const msg = rtevent.msg;
+
+			self.markSelfDirty(`if:${msg.ifname}`);
+
+			/* bridge port notifications do not carry the link flags */
+			if (msg.family == rtconst.AF_BRIDGE)
+				return;
+
+			/* only links coming up, going down or vanishing affect the
+			 * L3 configuration, other link changes need no ubus dump */
+			const up = (rtevent.cmd == rtconst.RTM_NEWLINK && (msg.flags & rtconst.IFF_UP) != 0);
+
+			if (linkUp[msg.ifname] !== up)
+				self.markSelfDirty('ipaddr');
+
+			if (rtevent.cmd == rtconst.RTM_NEWLINK)
+				linkUp[msg.ifname] = up;
+			else
+				delete linkUp[msg.ifname];
+		});
+	},
+
+	/*
+	 * Advance the topology generation and schedule a coalesced notification,
+	 * devices record the generation they last changed in, removed devices
+	 * are remembered for a while to answer delta queries.
+	 */
+	bumpTopologyGeneration: function () {
+		this.topologyGeneration++;
+
+		if (!this.topologyNotifyPending) {
+			this.topologyNotifyPending = true;
+			this.topologyNotifyTimer ??= timer(TOPOLOGY_NOTIFY_DELAY, () => {
+				this.topologyNotifyPending = false;
+				events.dispatch('model.topology', this.topologyGeneration);
+			});
+
+			this.topologyNotifyTimer.set(TOPOLOGY_NOTIFY_DELAY);
+		}
+
+		return this.topologyGeneration;
+	},
+
+	forgetDevice: function (al_address) {
+		this.topologyRemoved[al_address] = this.bumpTopologyGeneration();
+
+		if (length(this.topologyRemoved) <= TOPOLOGY_MAX_TOMBSTONES)
+			return;
+
+		let oldest = null;
+
+		for (let addr, gen in this.topologyRemoved)
+			if (oldest == null || gen < this.topologyRemoved[oldest])
+				oldest = addr;
+
+		this.topologyHorizon = this.topologyRemoved[oldest];
+		delete this.topologyRemoved[oldest];
+	},
+
+	/*
+	 * Only devices which currently speak IEEE1905 are part of the exposed
+	 * topology. Since that state ages out without any message being
+	 * received, transitions are detected here and recorded as additions
+	 * and removals for delta queries.
+	 */
+	updateTopologyVisibility: function () {
+		let changed = 0;
+
+		for (let dev in this.devices) {
+			const visible = dev.isIEEE1905();
+
+			if (visible === !!dev.visible)
+				continue;
+
+			dev.visible = visible;
+
+			if (visible) {
+				dev.markChanged();
+				dev.created = dev.generation;
+				delete this.topologyRemoved[dev.al_address];
+			}
+			else {
+				this.forgetDevice(dev.al_address);
+			}
+
+			changed++;
+		}
+
+		return changed;
+	},
+
+	markSelfDirty: function (what) {
+		this.selfDirty[what] = true;
+
+		if (this.selfUpdatePending)
+			return;
+
+		this.selfUpdatePending = true;
+		this.selfUpdateTimer ??= timer(SELF_UPDATE_DELAY, () => {
+			this.selfUpdatePending = false;
+			this.updateSelf();
+		});
+
+		this.selfUpdateTimer.set(SELF_UPDATE_DELAY);
+	},
+
+	updateLinkMetrics: function (max_age) {
+		const now = timems();
+
+		if (now - this.selfLinkMetricsUpdated < max_age)
+			return;
+
+		/* link metric TLVs carry interface counters, refresh them on demand */
+		for (let i1905lif in this.getLocalInterfaces())
+			if (length(i1905lif.neighbors))
+				this.selfDirty[`if:${i1905lif.ifname}`] = true;
+
+		this.selfDirty.links = true;
+		this.selfLinkMetricsUpdated = now;
+		this.updateSelf();
+	},
+
+	updateSelf: function (full) {
+		const dirty = this.selfDirty;
+		const cache = this.selfTLVs;
+
+		if (!full && !length(dirty))
+			return false;
+
+		const start = stats.now();
+
+		this.selfDirty = {};
+
 		let i1905dev = this.addDevice(this.address);
+		let i1905lifs = this.getLocalInterfaces();
+		let present = {};
 		let bridges = {};
-		let tlvs = [];
-
-		let i1905neighs = [];
-		let i1905macs = [];
 
-		let neightbl = rtrequest(rtconst.RTM_GETNEIGH, rtconst.NLM_F_DUMP) ?? [];
+		if (full)
+			netcache.resyncNeighbors();
 
-		for (let i1905neigh in this.devices)
-			if (i1905neigh.isIEEE1905())
-				for (let i1905if in i1905neigh.interfaces)
-					push(i1905macs, i1905if.address);
+		for (let i1905lif in i1905lifs) {
+			const key = `neigh:${i1905lif.ifname}`;
+			const refresh = full || dirty[`if:${i1905lif.ifname}`] ||
+				dirty[`if:${i1905lif.i1905sock?.ifname}`];
 
-		for (let i1905if in this.getLocalInterfaces()) {
-			let info = i1905if.getRuntimeInformation(true);
+			let info = i1905lif.getRuntimeInformation(refresh);
 
 			if (!info)
 				continue;
 
-			let i1905rif = i1905dev.addInterface(info.address);
+			present[key] = true;
 
-			i1905rif.updateCMDUTimestamp();
-			i1905rif.updateLLDPTimestamp();
+			if (refresh) {
+				let i1905rif = i1905dev.addInterface(info.address);
+
+				i1905rif.updateCMDUTimestamp();
+				i1905rif.updateLLDPTimestamp();
+
+				dirty.device = true;
+			}
 
 			if (info.bridge)
 				push(bridges[info.bridge] ??= [], info.address);
 
-			let others, neighs, l2devs;
+			if (refresh || dirty.neighbors || dirty[key] || dirty[`neigh:${info.ifname}`] || !cache[key]) {
+				cache[key] = this.encode_local_neighbor_tlvs(i1905lif, info);
+				dirty.links = true;
+			}
+		}
 
-			if (info.wifi) {
-				for (let station in info.wifi.stations) {
-					if (!(station.mac in l2devs))
-						push(l2devs ??= [], station.mac);
+		for (let key in keys(cache)) {
+			if (index(key, 'neigh:') === 0 && !present[key]) {
+				delete cache[key];
+				dirty.device = dirty.links = dirty.ipaddr = true;
+			}
+		}
 
-					if (station.mac in i1905macs)
-						continue;
+		if (full || dirty.links)
+			cache.links = this.encode_local_link_metric_tlvs();
 
-					if (!(station.mac in others))
-						push(others ??= [], station.mac);
-				}
-			}
-			else {
-				for (let neigh in neightbl) {
-					if (neigh.dev != info.ifname)
-						continue;
+		if (full || dirty.ipaddr) {
+			let ifstatus = ubus.call('network.interface', 'dump')?.interface ?? [];
 
-					if (neigh.type != rtconst.RTN_UNICAST)
-						continue;
+			cache.ipaddr = [
+				this.encode_ipv4_tlv(i1905lifs, ifstatus),
+				this.encode_ipv6_tlv(i1905lifs, ifstatus)
+			];
+		}
 
-					if (neigh.state != rtconst.NUD_REACHABLE && neigh.state != rtconst.NUD_PERMANENT)
-						continue;
+		if (full || dirty.device) {
+			cache.device = [
+				this.encode_ieee1905_device_information_tlv(i1905lifs),
+				this.encode_device_bridging_capability_tlv(bridges)
+			];
+		}
 
-					if (!(neigh.lladdr in l2devs))
-						push(l2devs ??= [], neigh.lladdr);
+		if (full) {
+			cache.static = [
+				this.encode_device_identification_tlv(),
+				this.encode_control_url_tlv(),
+				this.encode_ieee1905_profile_version_tlv()
+			];
+		}
 
-					if (neigh.lladdr in neighs)
-						continue;
+		for (let i1905rif in i1905dev.interfaces) {
+			i1905rif.updateCMDUTimestamp();
+			i1905rif.updateLLDPTimestamp();
+		}
 
-					if (neigh.lladdr in i1905macs)
-						continue;
+		let tlvs = [];
 
-					if (!(neigh.lladdr in others))
-						push(others ??= [], neigh.lladdr);
-				}
-			}
+		for (let key, list in cache)
+			push(tlvs, ...list);
 
-			for (let i1905rif in i1905if.neighbors) {
-				if (!i1905rif.dev.isIEEE1905())
-					continue;
+		const changed = i1905dev.updateTLVs(tlvs);
 
-				push(neighs ??= [], i1905rif);
+		stats.record('model', full ? 'update_self_full' : 'update_self', start);
 
-				if (!(i1905rif.dev in i1905neighs))
-					push(i1905neighs ??= [], i1905rif.dev);
-			}
+		return changed;
+	},
 
-			if (neighs) {
-				push(tlvs, this.encode_ieee1905_neighbor_devices_tlv(info.address, neighs));
-			}
+	encode_local_neighbor_tlvs: function (i1905lif, info) {
+		const remotes = this.remoteInterfacesByAddress;
+		let tlvs = [];
+		let others, neighs, l2devs;
 
-			if (others) {
-				push(tlvs, this.encode_non1905_neighbor_devices_tlv(info.address, others));
+		if (info.wifi) {
+			for (let station in info.wifi.stations) {
+				if (!(station.mac in l2devs))
+					push(l2devs ??= [], station.mac);
+
+				if (remotes[station.mac]?.dev.isIEEE1905())
+					continue;
+
+				if (!(station.mac in others))
+					push(others ??= [], station.mac);
 			}
+		}
+		else {
+			const neightbl = netcache.getNeighbors(info.ifname);
+
+			for (let lladdr in neightbl) {
+				if (!length(neightbl[lladdr]))
+					continue;
+
+				if (!(lladdr in l2devs))
+					push(l2devs ??= [], lladdr);
 
-			if (l2devs) {
-				push(tlvs, this.encode_l2_neighbor_device_tlv(info.address, l2devs));
+				if (remotes[lladdr]?.dev.isIEEE1905())
+					continue;
+
+				if (!(lladdr in others))
+					push(others ??= [], lladdr);
 			}
 		}
 
-		for (let i1905neigh in i1905neighs) {
-			if (!i1905neigh.isIEEE1905())
-				continue;
+		for (let i1905rif in i1905lif.neighbors)
+			if (i1905rif.dev.isIEEE1905())
+				push(neighs ??= [], i1905rif);
 
+		if (neighs)
+			push(tlvs, this.encode_ieee1905_neighbor_devices_tlv(info.address, neighs));
+
+		if (others)
+			push(tlvs, this.encode_non1905_neighbor_devices_tlv(info.address, others));
+
+		if (l2devs)
+			push(tlvs, this.encode_l2_neighbor_device_tlv(info.address, l2devs));
+
+		return tlvs;
+	},
+
+	encode_local_link_metric_tlvs: function () {
+		let i1905neighs = [];
+		let tlvs = [];
+
+		for (let ifname, i1905lif in this.interfaces)
+			for (let i1905rif in i1905lif.neighbors)
+				if (i1905rif.dev.isIEEE1905() && !(i1905rif.dev in i1905neighs))
+					push(i1905neighs, i1905rif.dev);
+
+		for (let i1905neigh in i1905neighs) {
 			let links;
 
 			for (let i1905rif in i1905neigh.interfaces) {
 				for (let ifname, i1905lif in this.interfaces) {
-					if (!(i1905rif in i1905lif.neighbors))
+					if (!i1905lif.lookupNeighbor(i1905rif))
 						continue;
 
 					push(links ??= [], [i1905lif, i1905rif]);
@@ -1592,24 +2105,7 @@ model = proto({
 			}
 		}
 
-		let i1905lifs = this.getLocalInterfaces();
-
-		push(tlvs,
-			this.encode_ipv4_tlv(i1905lifs, ifstatus),
-			this.encode_ipv6_tlv(i1905lifs, ifstatus),
-			this.encode_ieee1905_device_information_tlv(i1905lifs),
-			this.encode_device_identification_tlv(),
-			this.encode_device_bridging_capability_tlv(bridges),
-			this.encode_control_url_tlv(),
-			this.encode_ieee1905_profile_version_tlv()
-		);
-
-		for (let i1905rif in i1905dev.interfaces) {
-			i1905rif.updateCMDUTimestamp();
-			i1905rif.updateLLDPTimestamp();
-		}
-
-		i1905dev.updateTLVs(tlvs);
+		return tlvs;
 	},
 
 	encode_ieee1905_neighbor_devices_tlv: function (address, neighs) {
@@ -1778,23 +2274,223 @@ model = proto({
 		return encode_tlv(defs.TLV_IEEE1905_PROFILE_VERSION, 0x01);
 	},
 
+	/* Persist learned remote devices, their raw TLVs and the neighbor links
+	 * of local interfaces. Ages are stored relative to the time of writing
+	 * since the monotonic clock does not carry over into a new process. */
+	saveSnapshot: function (path) {
+		const self = this.getLocalDevice();
+		const now = timems();
+		const age = (ts) => ts ? int(now - ts) : null;
+
+		let snapshot = {
+			version: SNAPSHOT_VERSION,
+			time: time(),
+			address: this.address,
+			controller: this.isController,
+			devices: [],
+			links: {}
+		};
+
+		for (let dev in this.devices) {
+			if (dev === self)
+				continue;
+
+			let rec = {
+				al_address: dev.al_address,
+				age: age(dev.seen),
+				seen_on: dev.seenOn?.ifname,
+				sta_capabilities: !!dev.haveStaCapabilities,
+				interfaces: [],
+				tlvs: {}
+			};
+
+			for (let iface in dev.interfaces)
+				push(rec.interfaces, [ iface.address, age(iface.seen), age(iface.seen_lldp), age(iface.seen_cmdu) ]);
+
+			for (let type, tlvs in dev.tlvs)
+				rec.tlvs[type] = [ age(tlvs[0]), ...map(slice(tlvs, 1), hexenc) ];
+
+			push(snapshot.devices, rec);
+		}
+
+		for (let ifname, i1905lif in this.interfaces) {
+			const neighbors = filter(i1905lif.neighbors, (i1905rif) => i1905rif.dev !== self);
+
+			if (length(neighbors))
+				snapshot.links[ifname] = map(neighbors, (i1905rif) => i1905rif.address);
+		}
+
+		const tmppath = `${path}.tmp`;
+
+		if (writefile(tmppath, sprintf('%J', snapshot)) == null || !rename(tmppath, path)) {
+			log.warn(`Unable to write topology snapshot to ${path}`);
+			return false;
+		}
+
+		this.snapshotGeneration = this.topologyGeneration;
+
+		return true;
+	},
+
+	/* Load a snapshot written by saveSnapshot(), entries which expired in
+	 * the meantime are skipped. Restored devices are flagged unconfirmed
+	 * until they are heard from again and announced through the
+	 * "model.restored" event to trigger verification queries. */
+	restoreSnapshot: function (path) {
+		let snapshot;
+
+		try {
+			snapshot = json(readfile(path) ?? 'null');
+		}
+		catch (e) {
+			log.warn(`Ignoring malformed topology snapshot ${path}: ${e}`);
+			return null;
+		}
+
+		if (snapshot?.version != SNAPSHOT_VERSION || snapshot.address != this.address ||
+		    snapshot.controller != this.isController)
+			return null;
+
+		const now = timems();
+		const elapsed = max(0, time() - snapshot.time) * 1000;
+		const since = (age) => (age != null && age + elapsed < STALE_TIMEOUT) ? now - (age + elapsed) : null;
+		const restored = [];
+
+		for (let rec in snapshot.devices) {
+			const seen = since(rec.age);
+
+			if (seen == null || rec.al_address == this.address || this.lookupDevice(rec.al_address))
+				continue;
+
+			const dev = this.addDevice(rec.al_address);
+
+			dev.seen = seen;
+			dev.unconfirmed = true;
+			dev.haveStaCapabilities = rec.sta_capabilities;
+			this.expiry.devices.touch(dev, seen);
+
+			for (let ifrec in rec.interfaces) {
+				const ifseen = since(ifrec[1]);
+
+				if (ifseen == null)
+					continue;
+
+				const iface = dev.addInterface(ifrec[0]);
+
+				iface.seen = ifseen;
+				iface.seen_lldp = since(ifrec[2]) ?? 0;
+				iface.seen_cmdu = since(ifrec[3]) ?? 0;
+				this.expiry.interfaces.touch(iface, ifseen);
+			}
+
+			for (let type, tlvrec in rec.tlvs) {
+				const ts = since(tlvrec[0]);
+
+				if (ts == null)
+					continue;
+
+				dev.tlvs[type] = [ ts, ...map(slice(tlvrec, 1), hexdec) ];
+				this.expiry.tlvs.touch(dev.tlvExpiry[type] ??= { dev, type: +type }, ts);
+			}
+
+			if (rec.seen_on && this.interfaces[rec.seen_on])
+				dev.updateSeenOn(this.interfaces[rec.seen_on]);
+
+			push(restored, dev.al_address);
+		}
+
+		for (let ifname, addresses in snapshot.links) {
+			const i1905lif = this.interfaces[ifname];
+
+			if (!i1905lif || i1905lif.pending)
+				continue;
+
+			for (let address in addresses)
+				if (this.remoteInterfacesByAddress[address])
+					i1905lif.addNeighbor(this.remoteInterfacesByAddress[address]);
+		}
+
+		this.snapshotGeneration = this.topologyGeneration;
+
+		log.info(`Restored ${length(restored)} devices from topology snapshot ${path}`);
+
+		if (length(restored))
+			events.dispatch('model.restored', restored);
+
+		return restored;
+	},
+
 	collectGarbage: function (now) {
-		let changed = 0;
+		const self = this.getLocalDevice();
+		const start = stats.now();
+		let stale = 0, changed = 0;
 
 		now ??= timems();
 
-		for (let i = 1 /* skip self */; i < length(this.devices);) {
-			if (now - this.devices[i].seen > 180000) {
-				log.debug('Removing stale neighbor device %s', this.devices[i].al_address);
-				changed |= !!splice(this.devices, i, 1);
-			}
-			else {
-				changed |= this.devices[i++].collectGarbage(now);
+		changed += this.expiry.tlvs.expire(now, (rec) => {
+			if (rec.dev.tlvExpiry[rec.type] !== rec)
+				return;
+
+			delete rec.dev.tlvs[rec.type];
+			delete rec.dev.decoded[rec.type];
+			delete rec.dev.tlvExpiry[rec.type];
+
+			rec.dev.markChanged();
+		});
+
+		changed += this.expiry.interfaces.expire(now, (iface) => {
+			const dev = iface.dev;
+
+			if (dev === self || dev.interfacesByAddress[iface.address] !== iface)
+				return;
+
+			log.debug('Removing stale interface %s from device %s', iface.address, dev.al_address);
+
+			dev.interfaces = filter(dev.interfaces, i => i !== iface);
+			dev.unindexInterface(iface);
+			dev.markChanged();
+
+			for (let ifname, i1905lif in this.interfaces)
+				i1905lif.removeNeighbor(iface);
+
+			this.markSelfDirty('neighbors');
+		});
+
+		this.expiry.devices.expire(now, (dev) => {
+			if (dev === self || this.devicesByAddress[dev.al_address] !== dev)
+				return;
+
+			log.debug('Removing stale neighbor device %s', dev.al_address);
+
+			for (let iface in dev.interfaces) {
+				this.expiry.interfaces.remove(iface);
+				dev.unindexInterface(iface);
+
+				for (let ifname, i1905lif in this.interfaces)
+					i1905lif.removeNeighbor(iface);
 			}
+
+			for (let type, rec in dev.tlvExpiry)
+				this.expiry.tlvs.remove(rec);
+
+			delete this.devicesByAddress[dev.al_address];
+			this.forgetDevice(dev.al_address);
+			dev.stale = true;
+			stale++;
+		});
+
+		if (stale > 0) {
+			this.devices = filter(this.devices, dev => !dev.stale);
+			this.markSelfDirty('neighbors');
+			changed += stale;
 		}
 
+		changed += this.updateTopologyVisibility();
+
 		this.topologyChanged ||= (changed != 0);
 
+		stats.record('model', 'collect_garbage', start);
+
 		return (changed != 0);
 	}
 }, I1905Entity);
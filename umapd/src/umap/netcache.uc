@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2025 Jo-Philipp Wich <jo@mein.io>.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+import { request as rtrequest, listener as rtlistener, 'const' as rtconst } from 'rtnl';
+import { request as wlrequest, listener as wllistener, 'const' as wlconst } from 'nl80211';
+import { readfile } from 'fs';
+
+import events from 'umap.events';
+import ubus from 'umap.ubusclient';
+
+/*
+ * Cache of kernel link, wireless, station and neighbor state. Tables are
+ * populated by batched dumps and kept current by netlink notifications,
+ * which are forwarded as "netcache.*" events once the cache got updated.
+ *
+ * Link and station counters change without notification, callers needing
+ * them pass a maximum age after which the table is dumped again.
+ */
+
+let links = null, links_updated = 0;
+let neighbors = null;
+let sysfs = {};
+let devstatus = {};
+let wifi = {};
+let wiphys = {};
+let stations = {};
+let listeners = null;
+
+function timems() {
+	let tv = clock(true) ?? clock(false);
+	return tv[0] * 1000 + tv[1] / 1000000;
+}
+
+function neighbor_reachable(neigh) {
+	return (neigh.type == rtconst.RTN_UNICAST &&
+		(neigh.state == rtconst.NUD_REACHABLE || neigh.state == rtconst.NUD_PERMANENT));
+}
+
+function dump_links() {
+	links = {};
+	links_updated = timems();
+
+	for (let link in rtrequest(rtconst.RTM_GETLINK, rtconst.NLM_F_DUMP))
+		links[link.ifname] = link;
+}
+
+function dump_neighbors() {
+	neighbors = {};
+
+	for (let neigh in rtrequest(rtconst.RTM_GETNEIGH, rtconst.NLM_F_DUMP))
+		if (neigh.dev && neigh.lladdr && neighbor_reachable(neigh))
+			((neighbors[neigh.dev] ??= {})[neigh.lladdr] ??= {})[neigh.dst] = true;
+}
+
+function invalidate_link(ifname) {
+	delete sysfs[ifname];
+	delete devstatus[ifname];
+	delete wifi[ifname];
+	delete stations[ifname];
+}
+
+function handle_link_event(rtevent) {
+	const msg = rtevent.msg;
+
+	invalidate_link(msg.ifname);
+
+	if (rtevent.cmd == rtconst.RTM_NEWLINK) {
+		/* bridge port notifications only carry the bridge specific attributes */
+		if (links && msg.family != rtconst.AF_BRIDGE)
+			links[msg.ifname] = msg;
+	}
+	else if (msg.change?.[0] == 0xffffffff) {
+		if (links)
+			delete links[msg.ifname];
+
+		if (neighbors)
+			delete neighbors[msg.ifname];
+	}
+
+	events.dispatch('netcache.link', rtevent);
+}
+
+function handle_neigh_event(rtevent) {
+	const msg = rtevent.msg;
+
+	if (!neighbors || !msg.dev || !msg.lladdr)
+		return;
+
+	const neighs = (neighbors[msg.dev] ??= {});
+	const known = length(neighs[msg.lladdr]) > 0;
+
+	if (rtevent.cmd == rtconst.RTM_NEWNEIGH && neighbor_reachable(msg))
+		(neighs[msg.lladdr] ??= {})[msg.dst] = true;
+	else if (neighs[msg.lladdr])
+		delete neighs[msg.lladdr][msg.dst];
+
+	if (known != (length(neighs[msg.lladdr]) > 0))
+		events.dispatch('netcache.neighbor', { ifname: msg.dev, address: msg.lladdr });
+}
+
+export default {
+	init: function () {
+		if (listeners)
+			return true;
+
+		dump_links();
+		dump_neighbors();
+
+		listeners = [
+			rtlistener(function (rtevent) {
+				switch (rtevent.cmd) {
+					case rtconst.RTM_NEWLINK:
+					case rtconst.RTM_DELLINK:
+						handle_link_event(rtevent);
+						break;
+
+					case rtconst.RTM_NEWNEIGH:
+					case rtconst.RTM_DELNEIGH:
+						handle_neigh_event(rtevent);
+						break;
+
+					case rtconst.RTM_NEWADDR:
+					case rtconst.RTM_DELADDR:
+						events.dispatch('netcache.address', rtevent);
+						break;
+				}
+			}, [
+				rtconst.RTM_NEWLINK, rtconst.RTM_DELLINK,
+				rtconst.RTM_NEWNEIGH, rtconst.RTM_DELNEIGH,
+				rtconst.RTM_NEWADDR, rtconst.RTM_DELADDR
+			]),
+
+			wllistener(function (wlevent) {
+				const ifname = wlevent.msg?.dev;
+
+				switch (wlevent.cmd) {
+					case wlconst.NL80211_CMD_NEW_STATION:
+					case wlconst.NL80211_CMD_DEL_STATION:
+						delete stations[ifname];
+						events.dispatch('netcache.station', { ifname, address: wlevent.msg?.mac });
+						break;
+
+					case wlconst.NL80211_CMD_NEW_WIPHY:
+					case wlconst.NL80211_CMD_DEL_WIPHY:
+						wiphys = {};
+						wifi = {};
+						break;
+
+					default:
+						delete wifi[ifname];
+						break;
+				}
+			}, [
+				wlconst.NL80211_CMD_NEW_STATION, wlconst.NL80211_CMD_DEL_STATION,
+				wlconst.NL80211_CMD_NEW_INTERFACE, wlconst.NL80211_CMD_DEL_INTERFACE,
+				wlconst.NL80211_CMD_SET_INTERFACE,
+				wlconst.NL80211_CMD_NEW_WIPHY, wlconst.NL80211_CMD_DEL_WIPHY
+			])
+		];
+
+		return true;
+	},
+
+	getLink: function (ifname, max_age) {
+		if (!links || (max_age != null && timems() - links_updated > max_age))
+			dump_links();
+
+		return (links[ifname] ??= rtrequest(rtconst.RTM_GETLINK, 0, { dev: ifname }));
+	},
+
+	getWifi: function (ifname) {
+		if (!exists(wifi, ifname)) {
+			const iface = wlrequest(wlconst.NL80211_CMD_GET_INTERFACE, 0, { dev: ifname });
+			const phy = iface ? (wiphys[iface.wiphy] ??= wlrequest(wlconst.NL80211_CMD_GET_WIPHY, 0, { dev: ifname })) : null;
+
+			wifi[ifname] = (iface && phy) ? { interface: iface, phy } : null;
+		}
+
+		return wifi[ifname];
+	},
+
+	getStations: function (ifname, max_age) {
+		let entry = stations[ifname];
+
+		if (!entry || (max_age != null && timems() - entry.updated > max_age)) {
+			entry = stations[ifname] = {
+				updated: timems(),
+				list: wlrequest(wlconst.NL80211_CMD_GET_STATION, wlconst.NLM_F_DUMP, { dev: ifname }) ?? []
+			};
+		}
+
+		return entry.list;
+	},
+
+	getNeighbors: function (ifname) {
+		if (!neighbors)
+			dump_neighbors();
+
+		return neighbors[ifname] ?? {};
+	},
+
+	resyncNeighbors: function () {
+		dump_neighbors();
+	},
+
+	getSysfs: function (ifname, attribute) {
+		const attrs = (sysfs[ifname] ??= {});
+
+		if (!exists(attrs, attribute))
+			attrs[attribute] = readfile(`/sys/class/net/${ifname}/${attribute}`);
+
+		return attrs[attribute];
+	},
+
+	getDeviceStatus: function (name) {
+		if (!exists(devstatus, name))
+			devstatus[name] = ubus.call('network.device', 'status', { name });
+
+		return devstatus[name];
+	},
+};
@@ -19,6 +19,7 @@ import { process, timer } from 'uloop';
 import utils from 'umap.utils';
 import model from 'umap.model';
 import cmdu from 'umap.cmdu';
+import requests from 'umap.requests';
 import defs from 'umap.defs';
 import ubus from 'umap.ubus';
 import log from 'umap.log';
@@ -28,8 +29,10 @@ import * as wconst from 'umap.wireless';
 import configuration from 'umap.configuration';
 
 
-const callbacks = {};
+const renew_requests = {};
 const MAX_RETRIES = 5;
+const RENEW_TIMEOUT = 1000;
+const RENEW_RETRIES = 3;
 
 const IAgentSession = {
 	state: 'init',
@@ -176,35 +179,64 @@ const IAgentSession = {
 				break;
 
 			case 'config_apply':
-				const bssConfigs = [];
+				this.transitionState('config_process');
+				this.processM2();
+				break;
 
-				for (let m2 in this.m2) {
-					const settings = wsc.wscProcessM2(this.key, this.m1, m2);
+			case 'config_process':
+				// waiting for M2 processing to complete
+				break;
+		}
+	},
 
-					if (!settings) {
-						this.error('failed to process M2');
-						this.transitionState('config_request');
-						return;
-					}
+	processM2: function () {
+		const m2s = this.m2;
+		const bssConfigs = [];
+		let pending = length(m2s);
+		let failed = false;
 
-					this.info(`got settings: ${settings}`);
-					push(bssConfigs, settings);
-				}
+		const collect = (index) => (settings) => {
+			// Ignore stale results if the session moved on meanwhile
+			if (this.state != 'config_process' || this.m2 !== m2s)
+				return;
 
-				process('/usr/libexec/umap/wifi-apply',
-					[sprintf('%J', bssConfigs)],
-					{
-						RADIO: this.radio.config,
-						PHY: this.radio.phyname,
-						NETWORK: 'easymesh' // FIXME: derive from local interface
-					},
-					function (exitcode) {
-						log.debug(`wifi-apply exited with code ${exitcode}`);
-					});
+			if (settings) {
+				this.info(`got settings: ${settings}`);
+				bssConfigs[index] = settings;
+			}
+			else {
+				failed = true;
+			}
 
-				this.transitionState('idle');
-				break;
-		}
+			if (--pending > 0)
+				return;
+
+			if (failed) {
+				this.error('failed to process M2');
+				this.transitionState('config_request');
+				return;
+			}
+
+			this.applySettings(bssConfigs);
+		};
+
+		for (let i, m2 in m2s)
+			wsc.wscProcessM2(this.key, this.m1, m2, collect(i));
+	},
+
+	applySettings: function (bssConfigs) {
+		process('/usr/libexec/umap/wifi-apply',
+			[sprintf('%J', bssConfigs)],
+			{
+				RADIO: this.radio.config,
+				PHY: this.radio.phyname,
+				NETWORK: 'easymesh' // FIXME: derive from local interface
+			},
+			function (exitcode) {
+				log.debug(`wifi-apply exited with code ${exitcode}`);
+			});
+
+		this.transitionState('idle');
 	},
 
 	handle_cmdu: function (i1905lif, dstmac, srcmac, msg) {
@@ -311,6 +343,8 @@ const IAgentSession = {
 
 const IProtoAutoConf = {
 	init: function () {
+		wsc.wscInit();
+
 		if (model.isController) {
 			configuration.reload();
 			ubus.register('renew_ap_autoconfig', {}, this.renew_ap_autoconfig);
@@ -359,28 +393,21 @@ const IProtoAutoConf = {
 
 			const dstmac = i1905dev.al_address;
 
-			callbacks[dstmac] = {
-				try: 0,
-				dstmac: dstmac,
-				timeout: timer(1000, () => {
-					const s = callbacks[dstmac];
-
-					if (s.try >= 3) {
-						log.warn(`autoconf: device ${s.dstmac} did not acknowledge reconfig - connection lost?`);
-						delete callbacks[s.dstmac];
-						return;
-					}
+			renew_requests[dstmac]?.cancel();
 
-					log.warn(`autoconf: no WSC M1 from ${s.dstmac} for renew CMDU [${renew.mid}], retrying`);
+			/* the agent answers with a WSC M1 using its own message ID,
+			 * so completion is signalled from the WSC handler below */
+			renew_requests[dstmac] = requests.submit(renew, dstmac, response => {
+				if (!response)
+					log.warn(`autoconf: device ${dstmac} did not acknowledge reconfig - connection lost?`);
 
-					model.sendMulticast(renew, s.dstmac, cmdu.CMDU_F_ISRELAY);
-
-					this.set(1000);
-					s.try++;
-				})
-			};
-
-			model.sendMulticast(renew, i1905dev.al_address, cmdu.CMDU_F_ISRELAY);
+				delete renew_requests[dstmac];
+			}, {
+				reply_type: false,
+				timeout: RENEW_TIMEOUT,
+				retries: RENEW_RETRIES,
+				flags: cmdu.CMDU_F_ISRELAY
+			});
 		}
 
 		return req.reply({ success: true });
@@ -481,13 +508,11 @@ const IProtoAutoConf = {
 			if (wscType != 1)
 				return log.warn(`autoconf: received AP Auto-Configuration WSC message with unxpected type (${wscType ?? 'unknown'})`);
 
-			const s = callbacks[srcmac];
-
-			if (s) {
-				log.info(`autoconfig: device ${s.dstmac} acknowledged renew request`);
+			const renew = renew_requests[srcmac];
 
-				s.timeout.cancel();
-				delete callbacks[srcmac];
+			if (renew) {
+				log.info(`autoconfig: device ${srcmac} acknowledged renew request`);
+				renew.complete(msg);
 			}
 
 			const wscDetails = wsc.wscProcessM1(wscFrame);
@@ -533,8 +558,26 @@ const IProtoAutoConf = {
 
 			let bssid = radioCapabilities.radio_unique_identifier;
 
+			/* M2 messages are built asynchronously by the crypto workers,
+			 * send the reply once all of them are complete. */
+			const m2s = [];
+			let pending = length(desiredBSSes);
+
+			const collect = (index) => (m2) => {
+				m2s[index] = m2;
+
+				if (--pending > 0)
+					return;
+
+				for (let m2 in m2s)
+					if (m2)
+						reply.add_tlv(defs.TLV_WSC, m2);
+
+				reply.send(i1905lif.i1905sock, model.address, sender.al_address);
+			};
+
 			for (let i, desiredBSS in desiredBSSes) {
-				const m2 = wsc.wscBuildM2(wscFrame, {
+				wsc.wscBuildM2(wscFrame, {
 					authentication_types: desiredBSS.auth_mask,
 					encryption_types: desiredBSS.cipher_mask,
 					band: desiredBSS.band_mask,
@@ -550,13 +593,9 @@ const IProtoAutoConf = {
 						multi_ap_profile1_backhaul_sta_assoc_dissallowed: false,
 						multi_ap_profile2_backhaul_sta_assoc_dissallowed: false
 					},
-				});
-
-				reply.add_tlv(defs.TLV_WSC, m2);
+				}, collect(i));
 			}
 
-			reply.send(i1905lif.i1905sock, model.address, sender.al_address);
-
 			return true;
 		}
 	},
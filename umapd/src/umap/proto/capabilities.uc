@@ -17,13 +17,15 @@
 import log from 'umap.log';
 import model from 'umap.model';
 import cmdu from 'umap.cmdu';
+import requests from 'umap.requests';
 import defs from 'umap.defs';
 import ubus from 'umap.ubus';
 import utils from 'umap.utils';
 import wireless from 'umap.wireless';
 
 
-const REPLY_HANDLER_TIMEOUT = 3000;
+const REPLY_HANDLER_TIMEOUT = 1000;
+const REPLY_HANDLER_RETRIES = 2;
 
 const IProtoCapabilities = {
 	init: function () {
@@ -44,7 +46,7 @@ const IProtoCapabilities = {
 
 		const query = cmdu.create(defs.MSG_AP_CAPABILITY_QUERY);
 
-		query.on_reply(response => {
+		requests.submit(query, i1905dev.al_address, response => {
 			if (!response)
 				return req.reply(null, 7 /* UBUS_STATUS_TIMEOUT */);
 
@@ -77,9 +79,7 @@ const IProtoCapabilities = {
 			}
 
 			return req.reply(ret);
-		}, REPLY_HANDLER_TIMEOUT);
-
-		model.sendMulticast(query, i1905dev.al_address);
+		}, { timeout: REPLY_HANDLER_TIMEOUT, retries: REPLY_HANDLER_RETRIES });
 
 		return req.defer();
 	},
@@ -92,7 +92,7 @@ const IProtoCapabilities = {
 
 		const query = cmdu.create(defs.MSG_BACKHAUL_STA_CAPABILITY_QUERY);
 
-		query.on_reply(response => {
+		requests.submit(query, i1905dev.al_address, response => {
 			if (!response)
 				return req.reply(null, 7 /* UBUS_STATUS_TIMEOUT */);
 
@@ -111,9 +111,7 @@ const IProtoCapabilities = {
 			}
 
 			return req.reply(ret);
-		}, REPLY_HANDLER_TIMEOUT);
-
-		model.sendMulticast(query, i1905dev.al_address);
+		}, { timeout: REPLY_HANDLER_TIMEOUT, retries: REPLY_HANDLER_RETRIES });
 
 		return req.defer();
 	},
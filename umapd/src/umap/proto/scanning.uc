@@ -17,6 +17,7 @@
 import log from 'umap.log';
 import model from 'umap.model';
 import cmdu from 'umap.cmdu';
+import requests from 'umap.requests';
 import defs from 'umap.defs';
 import wireless from 'umap.wireless';
 import ubus from 'umap.ubus';
@@ -30,6 +31,11 @@ wlconst.NL80211_CMD_ABORT_SCAN ??= wlconst.NL80211_CMD_TDLS_CANCEL_CHANNEL_SWITC
 
 const SCAN_FLAG_AP_SCAN = (1 << 2);
 
+// Agents may only acknowledge a channel scan request once the scan got
+// started, wait long for it and never retransmit, since every retransmission
+// would trigger another scan on the agent.
+const CHANNEL_SCAN_REQUEST_TIMEOUT = 60100;
+
 const scanTasks = [];
 const scanReports = {};
 
@@ -328,7 +334,8 @@ const IActiveScanTask = {
 
 	reply: function (aborted) {
 		/* finalize TLVs */
-		const msg = cmdu.create(defs.MSG_CHANNEL_SCAN_REPORT);
+		const msg = cmdu.create_stream(defs.MSG_CHANNEL_SCAN_REPORT,
+			[ this.i1905lif.i1905sock ], model.address, this.srcmac);
 
 		msg.add_tlv(defs.TLV_TIMESTAMP, getTimestamp());
 
@@ -359,7 +366,7 @@ const IActiveScanTask = {
 			scanReports[radio_unique_identifier] = report;
 		}
 
-		msg.send(this.i1905lif.i1905sock, model.address, this.srcmac);
+		msg.finish();
 
 		this.timeout.cancel();
 
@@ -476,14 +483,12 @@ const IProtoScanning = {
 		const msg = cmdu.create(defs.MSG_CHANNEL_SCAN_REQUEST);
 
 		msg.add_tlv(defs.TLV_CHANNEL_SCAN_REQUEST, scan_params);
-		msg.on_reply(response => {
+		requests.submit(msg, i1905dev.al_address, response => {
 			if (!response)
 				return req.reply(null, 7 /* UBUS_STATUS_TIMEOUT */);
 
 			return req.reply(scan_params);
-		}, 60100, defs.MSG_IEEE1905_ACK);
-
-		model.sendMulticast(msg, i1905dev.al_address);
+		}, { timeout: CHANNEL_SCAN_REQUEST_TIMEOUT, reply_type: defs.MSG_IEEE1905_ACK });
 
 		return req.defer();
 	},
@@ -511,7 +516,8 @@ const IProtoScanning = {
 
 			// requested cached results
 			if (!req.perform_fresh_scan) {
-				const msg = cmdu.create(defs.MSG_CHANNEL_SCAN_REPORT);
+				const msg = cmdu.create_stream(defs.MSG_CHANNEL_SCAN_REPORT,
+					[ i1905lif.i1905sock ], model.address, srcmac);
 
 				msg.add_tlv(defs.TLV_TIMESTAMP, getTimestamp());
 
@@ -530,7 +536,7 @@ const IProtoScanning = {
 					}
 				}
 
-				msg.send(i1905lif.i1905sock, model.address, srcmac);
+				msg.finish();
 			}
 			else {
 				IActiveScanTask.new(i1905lif, srcmac, req);
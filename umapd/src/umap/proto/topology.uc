@@ -25,14 +25,18 @@ import events from 'umap.events';
 import proto_autoconf from 'umap.proto.autoconf';
 
 import { timer, interval } from 'uloop';
+import { unpack } from 'struct';
 
 
 const TOPOLOGY_DISCOVERY_DELAY = 500;
 
 const TOPOLOGY_DISCOVERY_INTERVAL = 60000;
 const TOPOLOGY_SENDNOTIFY_INTERVAL = 1000;
-const TOPOLOGY_SELFUPDATE_INTERVAL = 5000;
+const TOPOLOGY_SELFRESYNC_INTERVAL = 60000;
+const TOPOLOGY_LINKMETRIC_MAX_AGE = 5000;
 const TOPOLOGY_NODEUPDATE_INTERVAL = 30000;
+const TOPOLOGY_NODEQUERY_TIMEOUT = 5000;
+const TOPOLOGY_NODEQUERY_MAX_OUTSTANDING = 2;
 const TOPOLOGY_CLEANUP_INTERVAL = 5000;
 
 let started = false;
@@ -75,6 +79,88 @@ function emit_topology_notification(assoc_event) {
 	model.topologyChanged = false;
 }
 
+/* query type, TLV type answering it, controller only */
+const node_queries = [
+	[ defs.MSG_TOPOLOGY_QUERY, defs.TLV_IEEE1905_DEVICE_INFORMATION, false ],
+	[ defs.MSG_LINK_METRIC_QUERY, defs.TLV_IEEE1905_TRANSMITTER_LINK_METRIC, false ],
+	[ defs.MSG_HIGHER_LAYER_QUERY, defs.TLV_DEVICE_IDENTIFICATION, true ],
+	[ defs.MSG_BACKHAUL_STA_CAPABILITY_QUERY, defs.TLV_BACKHAUL_STA_RADIO_CAPABILITIES, true ],
+];
+
+/* AL MAC -> { query type -> send timestamp } */
+const outstanding_queries = {};
+const deferred_queries = {};
+
+function timems() {
+	let tv = clock(true) ?? clock(false);
+	return tv[0] * 1000 + tv[1] / 1000000;
+}
+
+function query_node_information(al_address) {
+	const i1905dev = model.lookupDevice(al_address);
+
+	if (!i1905dev || i1905dev.al_address != al_address) {
+		delete outstanding_queries[al_address];
+		return;
+	}
+
+	const now = timems();
+	const pending = (outstanding_queries[al_address] ??= {});
+
+	/* forget queries which got answered or timed out */
+	for (let type, sent in pending)
+		if (now - sent > TOPOLOGY_NODEQUERY_TIMEOUT || i1905dev.tlvs[node_queries[+type]?.[1]]?.[0] > sent)
+			delete pending[type];
+
+	for (let i, query_spec in node_queries) {
+		const tlvs = i1905dev.tlvs[query_spec[1]];
+
+		if (query_spec[2] && !model.isController)
+			continue;
+
+		if (pending[i] != null)
+			continue;
+
+		// skip when fresh data arrived through a notification or response,
+		// data restored from a snapshot needs to be verified regardless
+		if (tlvs && !i1905dev.unconfirmed && now - tlvs[0] < TOPOLOGY_NODEUPDATE_INTERVAL / 2)
+			continue;
+
+		// retry remaining queries once outstanding ones got answered or timed out
+		if (length(pending) >= TOPOLOGY_NODEQUERY_MAX_OUTSTANDING) {
+			deferred_queries[al_address] ??= timer(TOPOLOGY_NODEQUERY_TIMEOUT, () => {
+				delete deferred_queries[al_address];
+				query_node_information(al_address);
+			});
+
+			break;
+		}
+
+		let query = cmdu.create(query_spec[0]);
+
+		if (query_spec[0] == defs.MSG_LINK_METRIC_QUERY)
+			query.add_tlv(defs.TLV_LINK_METRIC_QUERY, { query_type: 0x00, /* all neighbors */ link_metrics_requested: 0x02 /* both Rx and Tx */ });
+
+		// send along the forwarding table route, flood if no route is known
+		model.sendUnicast(query, al_address);
+
+		pending[i] = now;
+	}
+}
+
+// Derive a stable offset within the update interval from our own and the
+// peer AL MAC address, so that queries to different peers are spread out
+// and different nodes query the same peer at different times.
+function query_offset(al_address) {
+	const addrs = (utils.ether_aton(model.address) ?? '') + (utils.ether_aton(al_address) ?? '');
+	let hash = 5381;
+
+	for (let b in unpack(`${length(addrs)}B`, addrs) ?? [])
+		hash = ((hash << 5) + hash + b) & 0xffffffff;
+
+	return hash % TOPOLOGY_NODEUPDATE_INTERVAL;
+}
+
 function update_node_information() {
 	const i1905self = model.getLocalDevice();
 
@@ -82,26 +168,9 @@ function update_node_information() {
 		if (i1905dev === i1905self)
 			continue;
 
-		let query;
-
-		// query device information
-		query = cmdu.create(defs.MSG_TOPOLOGY_QUERY);
-		model.sendMulticast(query, i1905dev.al_address);
-
-		// query link metrics
-		query = cmdu.create(defs.MSG_LINK_METRIC_QUERY);
-		query.add_tlv(defs.TLV_LINK_METRIC_QUERY, { query_type: 0x00, /* all neighbors */ link_metrics_requested: 0x02 /* both Rx and Tx */ });
-		model.sendMulticast(query, i1905dev.al_address);
-
-		if (model.isController) {
-			// query higher layer info
-			query = cmdu.create(defs.MSG_HIGHER_LAYER_QUERY);
-			model.sendMulticast(query, i1905dev.al_address);
+		const al_address = i1905dev.al_address;
 
-			// query backhaul sta capability
-			query = cmdu.create(defs.MSG_BACKHAUL_STA_CAPABILITY_QUERY);
-			model.sendMulticast(query, i1905dev.al_address);
-		}
+		timer(query_offset(al_address), () => query_node_information(al_address));
 	}
 }
 
@@ -132,8 +201,15 @@ function send_information_queries(i1905lif, al_mac) {
 
 const IProtoTopology = {
 	init: function () {
-		model.updateSelf();
+		model.observeSelfChanges();
+		model.updateSelf(true);
 		events.register('wireless.association', emit_topology_notification);
+
+		// verify devices restored from a topology snapshot right away
+		events.register('model.restored', (al_addresses) => {
+			for (let al_address in al_addresses)
+				query_node_information(al_address);
+		});
 	},
 
 	start: function () {
@@ -145,7 +221,7 @@ const IProtoTopology = {
 			interval(TOPOLOGY_DISCOVERY_INTERVAL, emit_topology_discovery);
 		});
 
-		interval(TOPOLOGY_SELFUPDATE_INTERVAL, () => model.updateSelf());
+		interval(TOPOLOGY_SELFRESYNC_INTERVAL, () => model.updateSelf(true));
 		interval(TOPOLOGY_CLEANUP_INTERVAL, () => model.collectGarbage());
 
 		interval(TOPOLOGY_SENDNOTIFY_INTERVAL, emit_topology_notification);
@@ -243,6 +319,8 @@ const IProtoTopology = {
 
 			let reply = cmdu.create(defs.MSG_LINK_METRIC_RESPONSE, msg.mid);
 
+			model.updateLinkMetrics(TOPOLOGY_LINKMETRIC_MAX_AGE);
+
 			for (let tlv in model.getLocalDevice().getTLVs(
 				defs.TLV_IEEE1905_TRANSMITTER_LINK_METRIC,
 				defs.TLV_IEEE1905_RECEIVER_LINK_METRIC
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2025 Jo-Philipp Wich <jo@mein.io>.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+import { timer } from 'uloop';
+
+import log from 'umap.log';
+import model from 'umap.model';
+import utils from 'umap.utils';
+
+const WHEEL_RESOLUTION = 100;
+const WHEEL_SLOTS = 128;
+
+const REQUEST_DEFAULT_TIMEOUT = 1000;
+const REQUEST_MAX_INFLIGHT = 64;
+const REQUEST_MAX_INFLIGHT_PEER = 4;
+const REQUEST_MAX_QUEUED = 1024;
+
+/*
+ * Outstanding requests are indexed by an integer key combining the expected
+ * reply type and the message id, a reply is only accepted if it originates
+ * from the peer the request was sent to. Deadlines are kept in a timer wheel
+ * driven by a single uloop timer which only runs while requests are in
+ * flight; completed requests are skipped lazily when their slot comes up.
+ */
+
+const wheel = {
+	slots: [],
+	tick: 0,
+	timer: null
+};
+
+const pending = {};
+const peers = {};
+const queue = [];
+
+let inflight = 0;
+let wheel_advance;
+
+const stats = {
+	submitted: 0,
+	completed: 0,
+	timeouts: 0,
+	retries: 0,
+	cancelled: 0,
+	mismatched: 0,
+	queued: 0,
+	dropped: 0,
+	types: {}
+};
+
+function timems() {
+	let tv = clock(true) ?? clock(false);
+	return tv[0] * 1000 + tv[1] / 1000000;
+}
+
+function request_key(type, mid) {
+	return (type << 16) | mid;
+}
+
+function wheel_insert(req, delay) {
+	const ticks = max(1, int((delay + WHEEL_RESOLUTION - 1) / WHEEL_RESOLUTION));
+
+	req.rounds = int((ticks - 1) / WHEEL_SLOTS);
+	push(wheel.slots[(wheel.tick + ticks) % WHEEL_SLOTS] ??= [], req);
+
+	if (!wheel.timer)
+		wheel.timer = timer(WHEEL_RESOLUTION, wheel_advance);
+	else if (wheel.timer.remaining() < 0)
+		wheel.timer.set(WHEEL_RESOLUTION);
+}
+
+function type_stats(req) {
+	return (stats.types[utils.cmdu_type_ntoa(req.msg.type) ?? sprintf('0x%04x', req.msg.type)] ??= {
+		completed: 0,
+		timeouts: 0,
+		cancelled: 0,
+		retries: 0,
+		latency_total: 0,
+		latency_max: 0
+	});
+}
+
+function request_transmit(req) {
+	if (req.send) {
+		req.send(req.msg);
+		return;
+	}
+
+	model.sendUnicast(req.msg, req.peer, req.flags);
+}
+
+function request_start(req) {
+	req.state = 'inflight';
+	req.started = timems();
+	req.attempt = 0;
+
+	inflight++;
+	peers[req.peer] = (peers[req.peer] ?? 0) + 1;
+
+	if (req.key != null)
+		pending[req.key] = req;
+
+	request_transmit(req);
+	wheel_insert(req, req.timeout);
+}
+
+function request_dispatch() {
+	for (let i = 0; i < length(queue) && inflight < REQUEST_MAX_INFLIGHT;) {
+		const req = queue[i];
+
+		if ((peers[req.peer] ?? 0) >= REQUEST_MAX_INFLIGHT_PEER) {
+			i++;
+			continue;
+		}
+
+		splice(queue, i, 1);
+		request_start(req);
+	}
+}
+
+function request_finish(req, reply, cancelled) {
+	const tstats = type_stats(req);
+
+	req.state = reply ? 'completed' : (cancelled ? 'cancelled' : 'expired');
+
+	if (req.key != null && pending[req.key] === req)
+		delete pending[req.key];
+
+	inflight--;
+
+	if (--peers[req.peer] <= 0)
+		delete peers[req.peer];
+
+	if (reply) {
+		const latency = timems() - req.started;
+
+		stats.completed++;
+		tstats.completed++;
+		tstats.latency_total += latency;
+		tstats.latency_max = max(tstats.latency_max, latency);
+	}
+	else if (cancelled) {
+		stats.cancelled++;
+		tstats.cancelled++;
+	}
+	else {
+		stats.timeouts++;
+		tstats.timeouts++;
+	}
+
+	try {
+		req.callback?.(reply);
+	}
+	catch (e) {
+		log.exception(e);
+	}
+
+	request_dispatch();
+}
+
+function request_expire(req) {
+	if (req.attempt < req.retries) {
+		req.attempt++;
+		stats.retries++;
+		type_stats(req).retries++;
+
+		log.debug('Retrying request %s [%d] to %s (attempt %d)',
+			utils.cmdu_type_ntoa(req.msg.type), req.msg.mid, req.peer, req.attempt + 1);
+
+		request_transmit(req);
+		wheel_insert(req, req.timeout << req.attempt);
+
+		return;
+	}
+
+	request_finish(req, null);
+}
+
+wheel_advance = function () {
+	wheel.tick = (wheel.tick + 1) % WHEEL_SLOTS;
+
+	const slot = wheel.slots[wheel.tick];
+
+	wheel.slots[wheel.tick] = [];
+
+	for (let req in slot) {
+		if (req.state != 'inflight')
+			continue;
+
+		if (req.rounds-- > 0)
+			push(wheel.slots[wheel.tick], req);
+		else
+			request_expire(req);
+	}
+
+	if (inflight > 0)
+		wheel.timer.set(WHEEL_RESOLUTION);
+};
+
+const IRequest = {
+	complete: function (reply) {
+		if (this.state == 'inflight')
+			request_finish(this, reply);
+	},
+
+	cancel: function () {
+		if (this.state == 'queued') {
+			const i = index(queue, this);
+
+			if (i >= 0)
+				splice(queue, i, 1);
+
+			stats.cancelled++;
+			this.state = 'cancelled';
+		}
+		else if (this.state == 'inflight') {
+			this.callback = null;
+			request_finish(this, null, true);
+		}
+	}
+};
+
+export default {
+	/*
+	 * Submit a request CMDU to the given peer AL MAC. The callback is
+	 * invoked with the reply CMDU or with null once all retries timed out.
+	 *
+	 * Options:
+	 *  - reply_type: expected reply type, defaults to request type + 1,
+	 *    false to not match replies automatically (see complete())
+	 *  - timeout: initial reply timeout in ms, doubled on each retry
+	 *  - retries: number of retransmissions after the first attempt
+	 *  - flags: CMDU flags passed to the default send path
+	 *  - send: custom transmit function invoked with the CMDU
+	 */
+	submit: function (msg, peer, callback, options) {
+		const reply_type = options?.reply_type ?? (msg.type + 1);
+
+		const req = proto({
+			msg,
+			peer,
+			callback,
+			key: (reply_type !== false) ? request_key(reply_type, msg.mid) : null,
+			timeout: options?.timeout ?? REQUEST_DEFAULT_TIMEOUT,
+			retries: options?.retries ?? 0,
+			flags: options?.flags,
+			send: options?.send,
+			state: 'queued'
+		}, IRequest);
+
+		stats.submitted++;
+
+		if (inflight < REQUEST_MAX_INFLIGHT && (peers[peer] ?? 0) < REQUEST_MAX_INFLIGHT_PEER) {
+			request_start(req);
+		}
+		else if (length(queue) < REQUEST_MAX_QUEUED) {
+			stats.queued++;
+			push(queue, req);
+		}
+		else {
+			stats.dropped++;
+			req.state = 'dropped';
+			req.callback?.(null);
+		}
+
+		return req;
+	},
+
+	/*
+	 * Complete the request matching the given reply CMDU. The reply must
+	 * originate from the requested peer, either directly by source or AL MAC
+	 * address, or from an interface of the peer device.
+	 */
+	handle_reply: function (msg, srcmac, al_mac) {
+		const req = pending[request_key(msg.type, msg.mid)];
+
+		if (!req)
+			return false;
+
+		if (req.peer != srcmac && req.peer != al_mac &&
+		    model.lookupDevice(srcmac)?.al_address != req.peer) {
+			log.debug('Ignoring %s [%d] from %s, expected reply from %s',
+				utils.cmdu_type_ntoa(msg.type), msg.mid, al_mac ?? srcmac, req.peer);
+
+			stats.mismatched++;
+
+			return false;
+		}
+
+		request_finish(req, msg);
+
+		return true;
+	},
+
+	stats: function () {
+		let types = {};
+
+		for (let name, tstats in stats.types) {
+			types[name] = {
+				...tstats,
+				latency_avg: tstats.completed ? tstats.latency_total / tstats.completed : 0
+			};
+
+			delete types[name].latency_total;
+		}
+
+		return {
+			...stats,
+			inflight,
+			queue_length: length(queue),
+			types
+		};
+	}
+};
@@ -36,6 +36,7 @@ import * as bpf from 'bpf';
 import * as uloop from 'uloop';
 import defs from 'umap.defs';
 import utils from 'umap.utils';
+import { rxring, ether_ntoa, ether_aton } from 'umap.core';
 
 let err;
 const bpf_prio = 0x90;
@@ -47,14 +48,29 @@ const bpf_stats_keys = [
 	"multicast_bytes_received",
 	"broadcast_packets_received",
 	"broadcast_bytes_received",
+	"ieee1905_packets_received",
+	"ieee1905_bytes_received",
+	"lldp_packets_received",
+	"lldp_bytes_received",
 	"unicast_packets_sent",
 	"unicast_bytes_sent",
 	"multicast_packets_sent",
 	"multicast_bytes_sent",
 	"broadcast_packets_sent",
 	"broadcast_bytes_sent",
+	"ieee1905_packets_sent",
+	"ieee1905_bytes_sent",
+	"lldp_packets_sent",
+	"lldp_bytes_sent",
+	"relay_duplicates_dropped",
+	"cmdu_stats_dropped",
 ];
 
+const bpf_stats_format = sprintf('%dQ', length(bpf_stats_keys));
+
+/* number of possible CPUs, the BPF stats entries are sharded per CPU */
+const bpf_stats_cpus = +(match(readfile('/sys/devices/system/cpu/possible') ?? '', /(\d+)\s*$/)?.[1] ?? 0) + 1;
+
 function failure(msg) {
 	err = msg;
 
@@ -63,15 +79,31 @@ function failure(msg) {
 
 function bpf_map_stats_set(sockbr, ifindex, add) {
 	let map = sockbr.bpf_map_stats;
-	let key = pack('I', ifindex);
-	if (!add)
-		return map.delete(key);
+
+	if (!add) {
+		let stale = [];
+
+		sockbr.bpf_map_cmdu_stats.foreach((key) => {
+			if (unpack('I', key)[0] == ifindex)
+				push(stale, key);
+		});
+
+		for (let key in stale)
+			sockbr.bpf_map_cmdu_stats.delete(key);
+	}
 
 	let val = '';
-	for (let i = 0; i < 6; i++)
-		val += pack('QQ', 0, 0);
+	for (let i = 0; i < length(bpf_stats_keys); i++)
+		val += pack('Q', 0);
+
+	for (let cpu = 0; cpu < bpf_stats_cpus; cpu++) {
+		let key = pack('II', ifindex, cpu);
 
-	map.set(key, val, bpf.BPF_NOEXIST);
+		if (add)
+			map.set(key, val, bpf.BPF_NOEXIST);
+		else
+			map.delete(key);
+	}
 }
 
 function bpf_map_entry_set(sockbr, mac, proto, clone, add) {
@@ -82,7 +114,7 @@ function bpf_map_entry_set(sockbr, mac, proto, clone, add) {
 
 	addr_list[idx] = mac;
 
-	let key = pack('!H', proto) + utils.ether_aton(mac);
+	let key = pack('!H', proto) + ether_aton(mac);
 	if (!add)
 		return sockbr.bpf_map.delete(key);
 
@@ -109,6 +141,10 @@ function bpf_init(sockbr) {
 	if (!map)
 		return failure('Failed to get BPF stats map');
 
+	map = sockbr.bpf_map_cmdu_stats = mod.get_map('cmdu_stats_map');
+	if (!map)
+		return failure('Failed to get BPF CMDU stats map');
+
 	let prog = sockbr.bpf_prog_in = mod.get_program('ingress');
 	if (!prog)
 		return failure('Failed to get ingress BPF program');
@@ -144,7 +180,7 @@ function bridge_recv(sockbr, payload) {
 		proto = unpack('!H', payload[2])[0];
 	}
 
-	payload[1] = utils.ether_ntoa(payload[1]);
+	payload[1] = ether_ntoa(payload[1]);
 
 	for (let sock in sockbr.sockets) {
 		if (!sock.cb)
@@ -155,8 +191,8 @@ function bridge_recv(sockbr, payload) {
 		if (sock.debug_rx) {
 			let msg_data = [...payload];
 
-			msg_data[0] = utils.ether_aton(msg_data[0]);
-			msg_data[1] = utils.ether_aton(msg_data[1]);
+			msg_data[0] = ether_aton(msg_data[0]);
+			msg_data[1] = ether_aton(msg_data[1]);
 			msg_data[2] = pack('!H', proto);
 
 			sock.debug_rx.add(msg_data);
@@ -170,6 +206,16 @@ function uloop_handler(flags) {
 	let sockbr = this.handle();
 	let sock = sockbr.socket;
 
+	if (sockbr.ring) {
+		let frames;
+
+		while ((frames = sockbr.ring.recv(false)) != null)
+			for (let frame in frames)
+				bridge_recv(sockbr, frame);
+
+		return;
+	}
+
 	while (true) {
 		let msg = sock.recvmsg([6, 6, 2, 1504]);
 		if (!msg)
@@ -183,8 +229,8 @@ const socket_proto = {
 	const: usocket.const,
 
 	send: function(src, dest, data) {
-		let smac = hexdec(src ?? this.address, ':'),
-			dmac = hexdec(dest, ':'),
+		let smac = ether_aton(src ?? this.address),
+			dmac = ether_aton(dest),
 			frame;
 
 		if (this.vlan)
@@ -202,6 +248,32 @@ const socket_proto = {
 		});
 	},
 
+	frames: function(src, dest, payloads) {
+		let smac = ether_aton(src ?? this.address),
+			dmac = ether_aton(dest),
+			frames = [];
+
+		for (let data in payloads) {
+			let frame;
+
+			if (this.vlan)
+				frame = [dmac, smac, this.vlan, this.proto, data];
+			else
+				frame = [dmac, smac, this.proto, data];
+
+			if (this.debug_tx)
+				this.debug_tx.add(frame);
+
+			push(frames, [this.ifindex, frame]);
+		}
+
+		return frames;
+	},
+
+	transmitter: function() {
+		return this.bridge;
+	},
+
 	handler: function(cb) {
 		this.cb = cb;
 	},
@@ -236,20 +308,58 @@ const bridge_member_proto = {
 };
 
 const bridge_proto = {
+	transmit: function (frames) {
+		return usocket.send_frames(this.socket.fileno(), frames, this.sockets);
+	},
+
 	stats: function (ifname) {
-		let ifindex = +readfile(`/sys/class/net/${ifname}/ifindex`);
-		let key = pack('I', ifindex);
-		let val = this.bpf_map_stats.get(key);
-		if (!val)
-			return;
+		let ifindex = this.members[ifname]?.ifindex ?? +readfile(`/sys/class/net/${ifname}/ifindex`);
+		let stats;
+
+		for (let cpu = 0; cpu < bpf_stats_cpus; cpu++) {
+			let val = this.bpf_map_stats.get(pack('II', ifindex, cpu));
+			if (!val)
+				continue;
 
-		val = unpack('QQQQQQQQQQQQ', val);
-		if (!val)
+			val = unpack(bpf_stats_format, val);
+			if (!val)
+				continue;
+
+			stats ??= {};
+
+			for (let i = 0; i < length(bpf_stats_keys); i++)
+				stats[bpf_stats_keys[i]] = (stats[bpf_stats_keys[i]] ?? 0) + val[i];
+		}
+
+		if (!stats)
 			return;
 
-		let stats = {};
-		for (let i = 0; i < length(bpf_stats_keys); i++)
-			stats[bpf_stats_keys[i]] = val[i];
+		let cmdu_stats = stats.cmdu_types = {};
+
+		this.bpf_map_cmdu_stats.foreach((key) => {
+			let k = unpack('IIHB', key);
+			if (k?.[0] != ifindex)
+				return;
+
+			let val = unpack('QQ', this.bpf_map_cmdu_stats.get(key) ?? '');
+			if (!val)
+				return;
+
+			let name = utils.cmdu_type_ntoa(k[2]) ?? sprintf('0x%04x', k[2]);
+			let entry = cmdu_stats[name] ??= {
+				packets_received: 0, bytes_received: 0,
+				packets_sent: 0, bytes_sent: 0
+			};
+
+			if (k[3]) {
+				entry.packets_sent += val[0];
+				entry.bytes_sent += val[1];
+			}
+			else {
+				entry.packets_received += val[0];
+				entry.bytes_received += val[1];
+			}
+		});
 
 		return stats;
 	},
@@ -304,6 +414,7 @@ const bridge_proto = {
 
 		let sock = proto({
 			ifname, protocol, vlan, vlan_id,
+			ifindex: +readfile(`/sys/class/net/${ifname}/ifindex`),
 			proto: pack('!H', protocol),
 			bridge: this,
 		}, socket_proto);
@@ -325,6 +436,9 @@ const bridge_proto = {
 		if (this.handle)
 			this.handle.delete();
 
+		if (this.ring)
+			this.ring.close();
+
 		if (this.socket)
 			this.socket.close();
 
@@ -348,7 +462,7 @@ export default {
 		return msg;
 	},
 
-	create: function(ifname, macaddr) {
+	create: function(ifname, macaddr, rx_ring) {
 		let sockbr = proto({
 			ifname, macaddr,
 			addr_list: [],
@@ -412,6 +526,9 @@ export default {
 		if (!sock.setopt(SOL_PACKET, PACKET_ADD_MEMBERSHIP, mr))
 			return sockfail(sock, "Unable to enable promiscuous mode");
 
+		if (rx_ring && !(sockbr.ring = rxring(sock.fileno())))
+			return sockfail(sockbr, `Unable to set up receive ring`);
+
 		sockbr.handle = uloop.handle(sockbr, uloop_handler, uloop.ULOOP_READ | uloop.ULOOP_EDGE_TRIGGER);
 		if (!sockbr.handle)
 			return sockfail(sockbr, `Unable to create uloop handle`);
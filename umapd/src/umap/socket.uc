@@ -23,13 +23,17 @@ import {
 } from 'socket';
 
 import { request as rtrequest, 'const' as rtconst } from 'rtnl';
+import { readfile } from 'fs';
 import { pack } from 'struct';
+import { rxring, sendmmsg, error as core_error, ether_ntoa, ether_aton } from 'umap.core';
 import * as udebug from 'udebug';
 import * as uloop from 'uloop';
 
-import utils from 'umap.utils';
 import defs from 'umap.defs';
 
+const ENXIO = 6;
+const ENODEV = 19;
+
 let err;
 
 function failure(msg) {
@@ -50,6 +54,18 @@ function sockfail(sock, msg) {
 function uloop_handler(flags) {
 	let sock = this.handle();
 	while (sock.cb) {
+		if (sock.ring) {
+			let frames = sock.recv_block();
+			if (!frames)
+				break;
+
+			for (let payload in frames)
+				if (sock.cb)
+					call(sock.cb, sock, null, payload);
+
+			continue;
+		}
+
 		let payload = sock.recv();
 		if (!payload)
 			break;
@@ -58,6 +74,37 @@ function uloop_handler(flags) {
 	}
 }
 
+/*
+ * Send a batch of [ ifindex, frame ] tuples. Interfaces may have been deleted
+ * and re-created since the tuples were built, so when the kernel rejects the
+ * ifindex of a frame, the indexes of the given sockets are resolved again
+ * and the remaining frames are retried once with the updated indexes.
+ */
+function send_frames(fd, frames, sockets) {
+	let sent = sendmmsg(fd, frames) ?? 0;
+	let errno = core_error();
+
+	if (sent >= length(frames) || (errno != ENXIO && errno != ENODEV))
+		return sent;
+
+	let remap = {};
+
+	for (let sock in sockets) {
+		let ifindex = +readfile(`/sys/class/net/${sock.ifname}/ifindex`);
+
+		if (ifindex && ifindex != sock.ifindex) {
+			remap[sock.ifindex] = ifindex;
+			sock.ifindex = ifindex;
+		}
+	}
+
+	if (!length(remap))
+		return sent;
+
+	return sent + (sendmmsg(fd, map(slice(frames, sent),
+		(f) => [ remap[f[0]] ?? f[0], f[1] ])) ?? 0);
+}
+
 export default {
 	const: {
 		ETH_P_8021Q: 0x8100,
@@ -74,7 +121,7 @@ export default {
 		return msg;
 	},
 
-	create: function (ifname, ethproto, vlan) {
+	create: function (ifname, ethproto, vlan, rx_ring) {
 		let upper = ifname;
 		let address, bridge;
 
@@ -197,8 +244,16 @@ export default {
 				return sockfail(sock, "Unable to enable promiscuous mode");
 		}
 
+		/* Optionally receive through a TPACKET_V3 ring, the socket filter
+		 * installed above still applies to frames entering the ring. */
+		let ring;
+
+		if (rx_ring && !(ring = rxring(sock.fileno())))
+			return sockfail(sock, `Unable to set up receive ring`);
+
 		return proto({
-			address, ifname, bridge,
+			address, ifname, bridge, ring,
+			ifindex: +readfile(`/sys/class/net/${ifname}/ifindex`),
 			socket: sock,
 			protocol: pack('!H', ethproto),
 			vlan_id: vlan,
@@ -267,8 +322,8 @@ export default {
 	},
 
 	send: function (src, dest, data) {
-		let smac = hexdec(src ?? this.address, ':'),
-			dmac = hexdec(dest, ':'),
+		let smac = ether_aton(src ?? this.address),
+			dmac = ether_aton(dest),
 			frame;
 
 		if (this.vlan)
@@ -286,6 +341,38 @@ export default {
 		});
 	},
 
+	frames: function (src, dest, payloads) {
+		let smac = ether_aton(src ?? this.address),
+			dmac = ether_aton(dest),
+			frames = [];
+
+		for (let data in payloads) {
+			let frame;
+
+			if (this.vlan)
+				frame = [dmac, smac, this.vlan, this.protocol, data];
+			else
+				frame = [dmac, smac, this.protocol, data];
+
+			if (this.debug_tx)
+				this.debug_tx.add(frame);
+
+			push(frames, [this.ifindex, frame]);
+		}
+
+		return frames;
+	},
+
+	transmitter: function () {
+		return this;
+	},
+
+	transmit: function (frames) {
+		return send_frames(this.socket.fileno(), frames, [ this ]);
+	},
+
+	send_frames,
+
 	recv: function () {
 		let msg = this.socket.recvmsg([6, 6, 2, 1504]);
 
@@ -296,13 +383,31 @@ export default {
 			this.debug_rx.add(msg.data);
 
 		return [
-			utils.ether_ntoa(msg.data[0]),
-			utils.ether_ntoa(msg.data[1]),
+			ether_ntoa(msg.data[0]),
+			ether_ntoa(msg.data[1]),
 			(ord(msg.data[2], 0) << 8) | ord(msg.data[2], 1),
 			msg.data[3]
 		];
 	},
 
+	recv_block: function () {
+		let frames = this.ring.recv(true);
+
+		if (!frames)
+			return null;
+
+		if (this.debug_rx)
+			for (let frame in frames)
+				this.debug_rx.add([
+					ether_aton(frame[0]),
+					ether_aton(frame[1]),
+					pack('!H', frame[2]),
+					frame[3]
+				]);
+
+		return frames;
+	},
+
 	close: function () {
 		if (this.debug_tx)
 			this.debug_tx.close();
@@ -313,6 +418,9 @@ export default {
 		if (this.handle)
 			this.handle.delete();
 
+		if (this.ring)
+			this.ring.close();
+
 		return this.socket.close();
 	},
 
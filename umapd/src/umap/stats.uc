@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2025 Jo-Philipp Wich <jo@mein.io>.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+import utils from 'umap.utils';
+
+/*
+ * Runtime statistics. Instrumented code paths only bump counters and add
+ * monotonic time deltas to fixed bucket latency histograms keyed by plain
+ * names or CMDU type numbers; averages, percentiles and type names are only
+ * computed when the statistics are dumped.
+ */
+
+// upper bounds of the histogram buckets in ms, the last bucket is unbounded
+const LATENCY_BUCKETS = [ 0.1, 0.25, 0.5, 1, 2.5, 5, 10, 25, 50, 100, 250, 500, 1000 ];
+
+const sections = {
+	handler: {},
+	message: {},
+	parse: {},
+	send: {},
+	model: {}
+};
+
+const counters = {
+	rx_fragments: 0,
+	rx_messages: 0,
+	rx_invalid: 0,
+	rx_dropped: 0,
+	rx_unhandled: 0,
+	rx_errors: 0,
+	tx_messages: 0,
+	tx_frames: 0,
+	relayed: 0,
+	relay_duplicates: 0
+};
+
+function timems() {
+	let tv = clock(true) ?? clock(false);
+	return tv[0] * 1000 + tv[1] / 1000000;
+}
+
+const started = timems();
+
+function histogram_new() {
+	return {
+		count: 0,
+		total: 0,
+		max: 0,
+		buckets: map([ ...LATENCY_BUCKETS, null ], () => 0)
+	};
+}
+
+function histogram_percentile(hist, pct) {
+	let want = hist.count * pct / 100, seen = 0;
+
+	for (let i, n in hist.buckets) {
+		seen += n;
+
+		if (seen >= want)
+			return LATENCY_BUCKETS[i] ?? hist.max;
+	}
+
+	return hist.max;
+}
+
+function key_name(section, key) {
+	if (section != 'message' && section != 'parse' && section != 'send')
+		return key;
+
+	if (!match(key, /^[0-9]+$/))
+		return key;
+
+	return utils.cmdu_type_ntoa(+key) ?? sprintf('0x%04x', +key);
+}
+
+export default {
+	now: timems,
+
+	count: function (name, n) {
+		counters[name] += n ?? 1;
+	},
+
+	// add the time elapsed since `start` to the histogram `key` of `section`
+	record: function (section, key, start) {
+		this.add(section, key, timems() - start);
+	},
+
+	// add an already measured duration to the histogram `key` of `section`
+	add: function (section, key, elapsed) {
+		const hist = (sections[section][key] ??= histogram_new());
+		let i = 0;
+
+		while (i < length(LATENCY_BUCKETS) && elapsed > LATENCY_BUCKETS[i])
+			i++;
+
+		hist.buckets[i]++;
+		hist.count++;
+		hist.total += elapsed;
+
+		if (elapsed > hist.max)
+			hist.max = elapsed;
+	},
+
+	dump: function () {
+		let latency = {};
+
+		for (let section, hists in sections) {
+			latency[section] = {};
+
+			for (let key, hist in hists) {
+				latency[section][key_name(section, key)] = {
+					count: hist.count,
+					latency_avg: hist.count ? hist.total / hist.count : 0,
+					latency_max: hist.max,
+					latency_p50: histogram_percentile(hist, 50),
+					latency_p90: histogram_percentile(hist, 90),
+					latency_p99: histogram_percentile(hist, 99),
+					histogram: [ ...hist.buckets ]
+				};
+			}
+		}
+
+		return {
+			uptime: int((timems() - started) / 1000),
+			objects: gc('count'),
+			counters: { ...counters },
+			buckets: LATENCY_BUCKETS,
+			latency
+		};
+	}
+};
@@ -17,7 +17,7 @@
 import { readfile, open } from 'fs';
 import { pack, unpack } from 'struct';
 
-import { encoder, decoder, extended_encoder, extended_decoder } from 'umap.tlv.codec';
+import { find_encoder, find_decoder, find_extended_encoder, find_extended_decoder } from 'umap.tlv.codec';
 
 import utils from 'umap.utils';
 import defs from 'umap.defs';
@@ -55,9 +55,9 @@ export default {
 		payload ??= this.payload;
 
 		if (type === defs.TLV_EXTENDED)
-			return extended_decoder[unpack('!H', payload)]?.(payload);
+			return find_extended_decoder(unpack('!H', payload))?.(payload);
 
-		return decoder[type]?.(payload);
+		return find_decoder(type)?.(payload);
 	},
 
 	encode: function (type, ...args) {
@@ -67,10 +67,10 @@ export default {
 			let subtype = shift(args);
 
 			buf.put('!H', subtype);
-			buf = extended_encoder[subtype]?.(buf, ...args);
+			buf = find_extended_encoder(subtype)?.(buf, ...args);
 		}
 		else {
-			buf = encoder[type]?.(buf, ...args);
+			buf = find_encoder(type)?.(buf, ...args);
 		}
 
 		if (buf == null)
@@ -0,0 +1,1631 @@
+import { ether_ntoa, ether_aton } from 'umap.core';
+import defs from 'umap.defs';
+
+const encoder = [];
+const decoder = [];
+const extended_encoder = [];
+const extended_decoder = [];
+
+// -----------------------------------------------------------------------------
+// TLV ENCODER ROUTINES
+// -----------------------------------------------------------------------------
+
+// 0x00 - End of message
+// IEEE1905.1-2013
+encoder[0x00] = (buf) => buf;
+
+// 0x01 - 1905.1 AL MAC address
+// IEEE1905.1-2013
+encoder[0x01] = (buf, al_mac_address) => {
+	const _al_mac_address = ether_aton(al_mac_address);
+
+	if (_al_mac_address == null)
+		return null;
+
+	buf.put('6s', _al_mac_address);
+
+	return buf;
+};
+
+// 0x02 - MAC address
+// IEEE1905.1-2013
+encoder[0x02] = (buf, if_mac_address) => {
+	const _if_mac_address = ether_aton(if_mac_address);
+
+	if (_if_mac_address == null)
+		return null;
+
+	buf.put('6s', _if_mac_address);
+
+	return buf;
+};
+
+// 0x03 - 1905.1 device information
+// IEEE1905.1-2013
+encoder[0x03] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const al_mac_address = ether_aton(tlv.al_mac_address);
+
+	if (al_mac_address == null)
+		return null;
+
+	if (type(tlv.local_interfaces) != "array" || length(tlv.local_interfaces) > 0xff)
+		return null;
+
+	buf.put('6s', al_mac_address);
+	buf.put('B', length(tlv.local_interfaces));
+
+	for (let item in tlv.local_interfaces) {
+		if (type(item) != "object")
+			return null;
+
+		const local_if_mac_address = ether_aton(item.local_if_mac_address);
+
+		if (local_if_mac_address == null)
+			return null;
+
+		if (!(item.media_type in [ 0x0000, 0x0001, 0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0200, 0x0201, 0x0300, 0xffff ]))
+			return null;
+
+		if (type(item.media_specific_information) != "string" || length(item.media_specific_information) > 0xff)
+			return null;
+
+		buf.put('6s', local_if_mac_address);
+		buf.put('!H', item.media_type);
+		buf.put('B', length(item.media_specific_information));
+		buf.put('*', item.media_specific_information);
+	}
+
+	return buf;
+};
+
+// 0x04 - Device bridging capability
+// IEEE1905.1-2013
+encoder[0x04] = (buf, bridging_tuples) => {
+	if (type(bridging_tuples) != "array" || length(bridging_tuples) > 0xff)
+		return null;
+
+	buf.put('B', length(bridging_tuples));
+
+	for (let mac_addresses in bridging_tuples) {
+		if (type(mac_addresses) != "array" || length(mac_addresses) > 0xff)
+			return null;
+
+		buf.put('B', length(mac_addresses));
+
+		for (let mac_address in mac_addresses) {
+			const _mac_address = ether_aton(mac_address);
+
+			if (_mac_address == null)
+				return null;
+
+			buf.put('6s', _mac_address);
+		}
+	}
+
+	return buf;
+};
+
+// 0x06 - Non-1905 neighbor devices
+// IEEE1905.1-2013
+encoder[0x06] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const local_if_mac_address = ether_aton(tlv.local_if_mac_address);
+
+	if (local_if_mac_address == null)
+		return null;
+
+	if (type(tlv.non_ieee1905_neighbors) != "array")
+		return null;
+
+	buf.put('6s', local_if_mac_address);
+
+	for (let non_1905_neighbor_device_mac_address in tlv.non_ieee1905_neighbors) {
+		const _non_1905_neighbor_device_mac_address = ether_aton(non_1905_neighbor_device_mac_address);
+
+		if (_non_1905_neighbor_device_mac_address == null)
+			return null;
+
+		buf.put('6s', _non_1905_neighbor_device_mac_address);
+	}
+
+	return buf;
+};
+
+// 0x07 - 1905 neighbor devices
+// IEEE1905.1-2013
+encoder[0x07] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const local_if_mac_address = ether_aton(tlv.local_if_mac_address);
+
+	if (local_if_mac_address == null)
+		return null;
+
+	if (type(tlv.ieee1905_neighbors) != "array")
+		return null;
+
+	buf.put('6s', local_if_mac_address);
+
+	for (let item in tlv.ieee1905_neighbors) {
+		if (type(item) != "object")
+			return null;
+
+		const neighbor_al_mac_address = ether_aton(item.neighbor_al_mac_address);
+
+		if (neighbor_al_mac_address == null)
+			return null;
+
+		buf.put('6s', neighbor_al_mac_address);
+		buf.put('B', 0
+			| (item.bridges_present << 7)
+		);
+	}
+
+	return buf;
+};
+
+// 0x08 - Link metric query
+// IEEE1905.1-2013
+encoder[0x08] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (!(tlv.query_type in [ 0x00, 0x01 ]))
+		return null;
+
+	let al_mac_address = null;
+
+	if (tlv.al_mac_address != null) {
+		al_mac_address = ether_aton(tlv.al_mac_address);
+
+		if (al_mac_address == null)
+			return null;
+	}
+
+	if (!(tlv.link_metrics_requested in [ 0x00, 0x01, 0x02 ]))
+		return null;
+
+	tlv.query_type ??= (al_mac_address != null) && 1;
+
+	buf.put('B', tlv.query_type);
+
+	if (tlv.query_type == 1)
+		buf.put('6s', al_mac_address);
+
+	buf.put('B', tlv.link_metrics_requested);
+
+	return buf;
+};
+
+// 0x09 - 1905.1 transmitter link metric
+// IEEE1905.1-2013
+encoder[0x09] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const transmitter_al_mac_address = ether_aton(tlv.transmitter_al_mac_address);
+
+	if (transmitter_al_mac_address == null)
+		return null;
+
+	const neighbor_al_mac_address = ether_aton(tlv.neighbor_al_mac_address);
+
+	if (neighbor_al_mac_address == null)
+		return null;
+
+	if (type(tlv.link_metrics) != "array")
+		return null;
+
+	buf.put('6s', transmitter_al_mac_address);
+	buf.put('6s', neighbor_al_mac_address);
+
+	for (let item in tlv.link_metrics) {
+		if (type(item) != "object")
+			return null;
+
+		const local_if_mac_address = ether_aton(item.local_if_mac_address);
+
+		if (local_if_mac_address == null)
+			return null;
+
+		const remote_if_mac_address = ether_aton(item.remote_if_mac_address);
+
+		if (remote_if_mac_address == null)
+			return null;
+
+		if (!(item.media_type in [ 0x0000, 0x0001, 0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0200, 0x0201, 0x0300, 0xffff ]))
+			return null;
+
+		if (type(item.packet_errors) != "int" || item.packet_errors < 0 || item.packet_errors > 0xffffffff)
+			return null;
+
+		if (type(item.transmitted_packets) != "int" || item.transmitted_packets < 0 || item.transmitted_packets > 0xffffffff)
+			return null;
+
+		if (type(item.mac_throughput_capacity) != "int" || item.mac_throughput_capacity < 0 || item.mac_throughput_capacity > 0xffff)
+			return null;
+
+		if (type(item.link_availability) != "int" || item.link_availability < 0 || item.link_availability > 0xffff)
+			return null;
+
+		if (type(item.phy_rate) != "int" || item.phy_rate < 0 || item.phy_rate > 0xffff)
+			return null;
+
+		buf.put('6s', local_if_mac_address);
+		buf.put('6s', remote_if_mac_address);
+		buf.put('!H', item.media_type);
+		buf.put('?', item.bridges_present);
+		buf.put('!L', item.packet_errors);
+		buf.put('!L', item.transmitted_packets);
+		buf.put('!H', item.mac_throughput_capacity);
+		buf.put('!H', item.link_availability);
+		buf.put('!H', item.phy_rate);
+	}
+
+	return buf;
+};
+
+// 0x0a - 1905.1 receiver link metric
+// IEEE1905.1-2013
+encoder[0x0a] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const transmitter_al_mac_address = ether_aton(tlv.transmitter_al_mac_address);
+
+	if (transmitter_al_mac_address == null)
+		return null;
+
+	const neighbor_al_mac_address = ether_aton(tlv.neighbor_al_mac_address);
+
+	if (neighbor_al_mac_address == null)
+		return null;
+
+	if (type(tlv.link_metrics) != "array")
+		return null;
+
+	buf.put('6s', transmitter_al_mac_address);
+	buf.put('6s', neighbor_al_mac_address);
+
+	for (let item in tlv.link_metrics) {
+		if (type(item) != "object")
+			return null;
+
+		const local_if_mac_address = ether_aton(item.local_if_mac_address);
+
+		if (local_if_mac_address == null)
+			return null;
+
+		const remote_if_mac_address = ether_aton(item.remote_if_mac_address);
+
+		if (remote_if_mac_address == null)
+			return null;
+
+		if (!(item.media_type in [ 0x0000, 0x0001, 0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0200, 0x0201, 0x0300, 0xffff ]))
+			return null;
+
+		if (type(item.packet_errors) != "int" || item.packet_errors < 0 || item.packet_errors > 0xffffffff)
+			return null;
+
+		if (type(item.received_packets) != "int" || item.received_packets < 0 || item.received_packets > 0xffffffff)
+			return null;
+
+		if (type(item.rssi) != "int" || item.rssi < 0 || item.rssi > 0xff)
+			return null;
+
+		buf.put('6s', local_if_mac_address);
+		buf.put('6s', remote_if_mac_address);
+		buf.put('!H', item.media_type);
+		buf.put('!L', item.packet_errors);
+		buf.put('!L', item.received_packets);
+		buf.put('B', item.rssi);
+	}
+
+	return buf;
+};
+
+// 0x0b - Vendor specific
+// IEEE1905.1-2013
+encoder[0x0b] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.vendor_specific_oui) != "string" || length(tlv.vendor_specific_oui) > 3)
+		return null;
+
+	if (type(tlv.vendor_specific_information) != "string")
+		return null;
+
+	buf.put('3s', tlv.vendor_specific_oui);
+	buf.put('*', tlv.vendor_specific_information);
+
+	return buf;
+};
+
+// 0x0c - 1905.1 link metric result code
+// IEEE1905.1-2013
+encoder[0x0c] = (buf, result_code) => {
+	if (!(result_code in [ 0x00 ]))
+		return null;
+
+	buf.put('B', result_code);
+
+	return buf;
+};
+
+// 0x0d - Searched Role
+// IEEE1905.1-2013
+encoder[0x0d] = (buf, role) => {
+	if (!(role in [ 0x00 ]))
+		return null;
+
+	buf.put('B', role);
+
+	return buf;
+};
+
+// 0x0e - Autoconfig Frequency Band
+// IEEE1905.1-2013
+encoder[0x0e] = (buf, frequency_band) => {
+	if (!(frequency_band in [ 0x00, 0x01, 0x02 ]))
+		return null;
+
+	buf.put('B', frequency_band);
+
+	return buf;
+};
+
+// 0x0f - Supported Role
+// IEEE1905.1-2013
+encoder[0x0f] = (buf, role) => {
+	if (!(role in [ 0x00 ]))
+		return null;
+
+	buf.put('B', role);
+
+	return buf;
+};
+
+// 0x10 - Supported Frequency Band
+// IEEE1905.1-2013
+encoder[0x10] = (buf, frequency_band) => {
+	if (!(frequency_band in [ 0x00, 0x01, 0x02 ]))
+		return null;
+
+	buf.put('B', frequency_band);
+
+	return buf;
+};
+
+// 0x11 - WSC
+// IEEE1905.1-2013
+encoder[0x11] = (buf, payload) => buf.put('*', payload);
+
+// 0x12 - Push_Button_Event notification
+// IEEE1905.1-2013
+encoder[0x12] = (buf, media_types) => {
+	if (type(media_types) != "array" || length(media_types) > 0xff)
+		return null;
+
+	buf.put('B', length(media_types));
+
+	for (let item in media_types) {
+		if (type(item) != "object")
+			return null;
+
+		if (!(item.media_type in [ 0x0000, 0x0001, 0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0200, 0x0201, 0x0300, 0xffff ]))
+			return null;
+
+		if (type(item.media_specific_information) != "string" || length(item.media_specific_information) > 0xff)
+			return null;
+
+		buf.put('!H', item.media_type);
+		buf.put('B', length(item.media_specific_information));
+		buf.put('*', item.media_specific_information);
+	}
+
+	return buf;
+};
+
+// 0x13 - Push_Button_Join notification
+// IEEE1905.1-2013
+encoder[0x13] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const al_id = ether_aton(tlv.al_id);
+
+	if (al_id == null)
+		return null;
+
+	if (type(tlv.message_identifier) != "int" || tlv.message_identifier < 0 || tlv.message_identifier > 0xffff)
+		return null;
+
+	const transmitter_if_mac_address = ether_aton(tlv.transmitter_if_mac_address);
+
+	if (transmitter_if_mac_address == null)
+		return null;
+
+	const neighbor_if_mac_address = ether_aton(tlv.neighbor_if_mac_address);
+
+	if (neighbor_if_mac_address == null)
+		return null;
+
+	buf.put('6s', al_id);
+	buf.put('!H', tlv.message_identifier);
+	buf.put('6s', transmitter_if_mac_address);
+	buf.put('6s', neighbor_if_mac_address);
+
+	return buf;
+};
+
+// 0x14 - Generic Phy device information
+// IEEE1905.1a-2014
+encoder[0x14] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const al_mac_address = ether_aton(tlv.al_mac_address);
+
+	if (al_mac_address == null)
+		return null;
+
+	if (type(tlv.local_interfaces) != "array" || length(tlv.local_interfaces) > 0xff)
+		return null;
+
+	buf.put('6s', al_mac_address);
+	buf.put('B', length(tlv.local_interfaces));
+
+	for (let item in tlv.local_interfaces) {
+		if (type(item) != "object")
+			return null;
+
+		const local_if_mac_address = ether_aton(item.local_if_mac_address);
+
+		if (local_if_mac_address == null)
+			return null;
+
+		if (type(item.phy_oui) != "string" || length(item.phy_oui) > 3)
+			return null;
+
+		if (type(item.phy_variant) != "int" || item.phy_variant < 0 || item.phy_variant > 0xff)
+			return null;
+
+		if (type(item.phy_variant_name) != "string" || length(item.phy_variant_name) > 32)
+			return null;
+
+		if (type(item.phy_description_url) != "string" || length(item.phy_description_url) > 0xff)
+			return null;
+
+		if (type(item.media_specific_information) != "string" || length(item.media_specific_information) > 0xff)
+			return null;
+
+		buf.put('6s', local_if_mac_address);
+		buf.put('3s', item.phy_oui);
+		buf.put('B', item.phy_variant);
+		buf.put('32s', item.phy_variant_name);
+		buf.put('B', length(item.phy_description_url));
+		buf.put('B', length(item.media_specific_information));
+		buf.put('*', item.phy_description_url);
+		buf.put('*', item.media_specific_information);
+	}
+
+	return buf;
+};
+
+// 0x15 - Device identification
+// IEEE1905.1a-2014
+encoder[0x15] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.friendly_name) != "string" || length(tlv.friendly_name) > 64)
+		return null;
+
+	if (type(tlv.manufacturer_name) != "string" || length(tlv.manufacturer_name) > 64)
+		return null;
+
+	if (type(tlv.manufacturer_model) != "string" || length(tlv.manufacturer_model) > 64)
+		return null;
+
+	buf.put('64s', tlv.friendly_name);
+	buf.put('64s', tlv.manufacturer_name);
+	buf.put('64s', tlv.manufacturer_model);
+
+	return buf;
+};
+
+// 0x16 - Control URL
+// IEEE1905.1a-2014
+encoder[0x16] = (buf, payload) => buf.put('*', payload);
+
+// 0x17 - IPv4
+// IEEE1905.1a-2014
+encoder[0x17] = (buf, interfaces) => {
+	if (type(interfaces) != "array" || length(interfaces) > 0xff)
+		return null;
+
+	buf.put('B', length(interfaces));
+
+	for (let item in interfaces) {
+		if (type(item) != "object")
+			return null;
+
+		const if_mac_address = ether_aton(item.if_mac_address);
+
+		if (if_mac_address == null)
+			return null;
+
+		if (type(item.addresses) != "array" || length(item.addresses) > 0xff)
+			return null;
+
+		buf.put('6s', if_mac_address);
+		buf.put('B', length(item.addresses));
+
+		for (let item2 in item.addresses) {
+			if (type(item2) != "object")
+				return null;
+
+			if (!(item2.ipv4addr_type in [ 0, 1, 2, 3 ]))
+				return null;
+
+			const address = iptoarr(item2.address);
+
+			if (length(address) != 4)
+				return null;
+
+			const dhcp_server = iptoarr(item2.dhcp_server);
+
+			if (length(dhcp_server) != 4)
+				return null;
+
+			buf.put('B', item2.ipv4addr_type);
+			buf.put('4B', ...address);
+			buf.put('4B', ...dhcp_server);
+		}
+	}
+
+	return buf;
+};
+
+// 0x18 - IPv6
+// IEEE1905.1a-2014
+encoder[0x18] = (buf, interfaces) => {
+	if (type(interfaces) != "array" || length(interfaces) > 0xff)
+		return null;
+
+	buf.put('B', length(interfaces));
+
+	for (let item in interfaces) {
+		if (type(item) != "object")
+			return null;
+
+		const if_mac_address = ether_aton(item.if_mac_address);
+
+		if (if_mac_address == null)
+			return null;
+
+		const linklocal_address = iptoarr(item.linklocal_address);
+
+		if (length(linklocal_address) != 16)
+			return null;
+
+		if (type(item.other_addresses) != "array" || length(item.other_addresses) > 0xff)
+			return null;
+
+		buf.put('6s', if_mac_address);
+		buf.put('16B', ...linklocal_address);
+		buf.put('B', length(item.other_addresses));
+
+		for (let item2 in item.other_addresses) {
+			if (type(item2) != "object")
+				return null;
+
+			if (!(item2.ipv6addr_type in [ 0, 1, 2, 3 ]))
+				return null;
+
+			const address = iptoarr(item2.address);
+
+			if (length(address) != 16)
+				return null;
+
+			const origin = iptoarr(item2.origin);
+
+			if (length(origin) != 16)
+				return null;
+
+			buf.put('B', item2.ipv6addr_type);
+			buf.put('16B', ...address);
+			buf.put('16B', ...origin);
+		}
+	}
+
+	return buf;
+};
+
+// 0x19 - Push Button Generic Phy Event
+// IEEE1905.1a-2014
+encoder[0x19] = (buf, phy_media_types) => {
+	if (type(phy_media_types) != "array" || length(phy_media_types) > 0xff)
+		return null;
+
+	buf.put('B', length(phy_media_types));
+
+	for (let item in phy_media_types) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.phy_oui) != "string" || length(item.phy_oui) > 3)
+			return null;
+
+		if (type(item.phy_variant) != "int" || item.phy_variant < 0 || item.phy_variant > 0xff)
+			return null;
+
+		if (type(item.media_specific_information) != "string" || length(item.media_specific_information) > 0xff)
+			return null;
+
+		buf.put('3s', item.phy_oui);
+		buf.put('B', item.phy_variant);
+		buf.put('B', length(item.media_specific_information));
+		buf.put('*', item.media_specific_information);
+	}
+
+	return buf;
+};
+
+// 0x1a - 1905 profile version
+// IEEE1905.1a-2014
+encoder[0x1a] = (buf, ieee1905_profile) => {
+	if (!(ieee1905_profile in [ 0x00, 0x01 ]))
+		return null;
+
+	buf.put('B', ieee1905_profile);
+
+	return buf;
+};
+
+// 0x1b - Power off interface
+// IEEE1905.1a-2014
+encoder[0x1b] = (buf, interfaces) => {
+	if (type(interfaces) != "array" || length(interfaces) > 0xff)
+		return null;
+
+	buf.put('B', length(interfaces));
+
+	for (let item in interfaces) {
+		if (type(item) != "object")
+			return null;
+
+		const if_mac_address = ether_aton(item.if_mac_address);
+
+		if (if_mac_address == null)
+			return null;
+
+		if (!(item.media_type in [ 0x0000, 0x0001, 0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0200, 0x0201, 0x0300, 0xffff ]))
+			return null;
+
+		if (type(item.phy_oui) != "string" || length(item.phy_oui) > 3)
+			return null;
+
+		if (type(item.phy_variant) != "int" || item.phy_variant < 0 || item.phy_variant > 0xff)
+			return null;
+
+		if (type(item.media_specific_information) != "string" || length(item.media_specific_information) > 0xff)
+			return null;
+
+		buf.put('6s', if_mac_address);
+		buf.put('!H', item.media_type);
+		buf.put('3s', item.phy_oui);
+		buf.put('B', length(item.media_specific_information));
+		buf.put('B', item.media_specific_information_length);
+		buf.put('*', item.media_specific_information);
+	}
+
+	return buf;
+};
+
+// 0x1c - Interface power change information
+// IEEE1905.1a-2014
+encoder[0x1c] = (buf, interfaces) => {
+	if (type(interfaces) != "array" || length(interfaces) > 0xff)
+		return null;
+
+	buf.put('B', length(interfaces));
+
+	for (let item in interfaces) {
+		if (type(item) != "object")
+			return null;
+
+		const if_mac_address = ether_aton(item.if_mac_address);
+
+		if (if_mac_address == null)
+			return null;
+
+		if (!(item.power_state in [ 0x00, 0x01, 0x02 ]))
+			return null;
+
+		buf.put('6s', if_mac_address);
+		buf.put('B', item.power_state);
+	}
+
+	return buf;
+};
+
+// 0x1d - Interface power change status
+// IEEE1905.1a-2014
+encoder[0x1d] = (buf, interfaces) => {
+	if (type(interfaces) != "array" || length(interfaces) > 0xff)
+		return null;
+
+	buf.put('B', length(interfaces));
+
+	for (let item in interfaces) {
+		if (type(item) != "object")
+			return null;
+
+		const if_mac_address = ether_aton(item.if_mac_address);
+
+		if (if_mac_address == null)
+			return null;
+
+		if (!(item.change_state in [ 0x00, 0x01, 0x02 ]))
+			return null;
+
+		buf.put('6s', if_mac_address);
+		buf.put('B', item.change_state);
+	}
+
+	return buf;
+};
+
+// 0x1e - L2 neighbor device
+// IEEE1905.1a-2014
+encoder[0x1e] = (buf, interfaces) => {
+	if (type(interfaces) != "array" || length(interfaces) > 0xff)
+		return null;
+
+	buf.put('B', length(interfaces));
+
+	for (let item in interfaces) {
+		if (type(item) != "object")
+			return null;
+
+		const if_mac_address = ether_aton(item.if_mac_address);
+
+		if (if_mac_address == null)
+			return null;
+
+		if (type(item.neighbors) != "array" || length(item.neighbors) > 0xffff)
+			return null;
+
+		buf.put('6s', if_mac_address);
+		buf.put('!H', length(item.neighbors));
+
+		for (let item2 in item.neighbors) {
+			if (type(item2) != "object")
+				return null;
+
+			const neighbor_mac_address = ether_aton(item2.neighbor_mac_address);
+
+			if (neighbor_mac_address == null)
+				return null;
+
+			if (type(item2.behind_mac_addresses) != "array" || length(item2.behind_mac_addresses) > 0xffff)
+				return null;
+
+			buf.put('6s', neighbor_mac_address);
+			buf.put('!H', length(item2.behind_mac_addresses));
+
+			for (let behind_mac_address in item2.behind_mac_addresses) {
+				const _behind_mac_address = ether_aton(behind_mac_address);
+
+				if (_behind_mac_address == null)
+					return null;
+
+				buf.put('6s', _behind_mac_address);
+			}
+		}
+	}
+
+	return buf;
+};
+
+// -----------------------------------------------------------------------------
+// TLV DECODER ROUTINES
+// -----------------------------------------------------------------------------
+
+// 0x00 - End of message
+// IEEE1905.1-2013
+decoder[0x00] = (buf, end) => '';
+
+// 0x01 - 1905.1 AL MAC address
+// IEEE1905.1-2013
+decoder[0x01] = (buf, end) => {
+	if (buf.pos() + 6 > end)
+		return null;
+
+	const al_mac_address = ether_ntoa(buf.get('6s'));
+
+	return al_mac_address;
+};
+
+// 0x02 - MAC address
+// IEEE1905.1-2013
+decoder[0x02] = (buf, end) => {
+	if (buf.pos() + 6 > end)
+		return null;
+
+	const if_mac_address = ether_ntoa(buf.get('6s'));
+
+	return if_mac_address;
+};
+
+// 0x03 - 1905.1 device information
+// IEEE1905.1-2013
+decoder[0x03] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const al_mac_address = ether_ntoa(buf.get('6s'));
+	const local_interfaces_count = buf.get('B');
+	const local_interfaces = [];
+
+	for (let h = 0; h < local_interfaces_count; h++) {
+		if (buf.pos() + 9 > end)
+			return null;
+
+		const local_if_mac_address = ether_ntoa(buf.get('6s'));
+		const media_type = buf.get('!H');
+
+		if (!exists(defs.MEDIA_TYPE, media_type))
+			return null;
+
+		const octets_count = buf.get('B');
+
+		if (buf.pos() + octets_count > end)
+			return null;
+
+		const media_specific_information = buf.get(octets_count);
+
+		push(local_interfaces, {
+			local_if_mac_address,
+			media_type,
+			media_type_name: defs.MEDIA_TYPE[media_type],
+			media_specific_information,
+		});
+	}
+
+	return {
+		al_mac_address,
+		local_interfaces,
+	};
+};
+
+// 0x04 - Device bridging capability
+// IEEE1905.1-2013
+decoder[0x04] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const bridging_tuples_count = buf.get('B');
+	const bridging_tuples = [];
+
+	for (let h = 0; h < bridging_tuples_count; h++) {
+		if (buf.pos() + 1 > end)
+			return null;
+
+		const mac_addresses_count = ether_ntoa(buf.get('6s'));
+		const mac_addresses = [];
+
+		for (let i = 0; i < mac_addresses_count; i++) {
+			if (buf.pos() + 6 > end)
+				return null;
+
+			const mac_address = ether_ntoa(buf.get('6s'));
+
+			push(mac_addresses, mac_address);
+		}
+
+		push(bridging_tuples, mac_addresses);
+	}
+
+	return bridging_tuples;
+};
+
+// 0x06 - Non-1905 neighbor devices
+// IEEE1905.1-2013
+decoder[0x06] = (buf, end) => {
+	if (buf.pos() + 6 > end)
+		return null;
+
+	const local_if_mac_address = ether_ntoa(buf.get('6s'));
+	const non_ieee1905_neighbors = [];
+
+	while (buf.pos() + 6 <= end) {
+		const non_1905_neighbor_device_mac_address = ether_ntoa(buf.get('6s'));
+
+		push(non_ieee1905_neighbors, non_1905_neighbor_device_mac_address);
+	}
+
+	return {
+		local_if_mac_address,
+		non_ieee1905_neighbors,
+	};
+};
+
+// 0x07 - 1905 neighbor devices
+// IEEE1905.1-2013
+decoder[0x07] = (buf, end) => {
+	if (buf.pos() + 6 > end)
+		return null;
+
+	const local_if_mac_address = ether_ntoa(buf.get('6s'));
+	const ieee1905_neighbors = [];
+
+	while (buf.pos() + 7 <= end) {
+		const neighbor_al_mac_address = ether_ntoa(buf.get('6s'));
+
+		const bitfield = buf.get('B');
+		const bridges_present = ((bitfield & 0b10000000) == 0b10000000);
+
+		push(ieee1905_neighbors, {
+			neighbor_al_mac_address,
+			bridges_present,
+		});
+	}
+
+	return {
+		local_if_mac_address,
+		ieee1905_neighbors,
+	};
+};
+
+// 0x08 - Link metric query
+// IEEE1905.1-2013
+decoder[0x08] = (buf, end) => {
+	if (buf.pos() + 2 > end)
+		return null;
+
+	const query_type = buf.get('B');
+
+	if (!exists(defs.QUERY_TYPE, query_type))
+		return null;
+
+	let al_mac_address = null;
+
+	if (query_type == 1) {
+		al_mac_address = ether_ntoa(buf.get('6s'));
+	}
+
+	const link_metrics_requested = buf.get('B');
+
+	if (!exists(defs.LINK_METRICS_REQUESTED, link_metrics_requested))
+		return null;
+
+	return {
+		query_type,
+		query_type_name: defs.QUERY_TYPE[query_type],
+		al_mac_address,
+		link_metrics_requested,
+		link_metrics_requested_name: defs.LINK_METRICS_REQUESTED[link_metrics_requested],
+	};
+};
+
+// 0x09 - 1905.1 transmitter link metric
+// IEEE1905.1-2013
+decoder[0x09] = (buf, end) => {
+	if (buf.pos() + 12 > end)
+		return null;
+
+	const transmitter_al_mac_address = ether_ntoa(buf.get('6s'));
+	const neighbor_al_mac_address = ether_ntoa(buf.get('6s'));
+	const link_metrics = [];
+
+	while (buf.pos() + 29 <= end) {
+		const local_if_mac_address = ether_ntoa(buf.get('6s'));
+		const remote_if_mac_address = ether_ntoa(buf.get('6s'));
+		const media_type = buf.get('!H');
+
+		if (!exists(defs.MEDIA_TYPE, media_type))
+			return null;
+
+		const bridges_present = buf.get('?');
+		const packet_errors = buf.get('!L');
+		const transmitted_packets = buf.get('!L');
+		const mac_throughput_capacity = buf.get('!H');
+		const link_availability = buf.get('!H');
+		const phy_rate = buf.get('!H');
+
+		push(link_metrics, {
+			local_if_mac_address,
+			remote_if_mac_address,
+			media_type,
+			media_type_name: defs.MEDIA_TYPE[media_type],
+			bridges_present,
+			packet_errors,
+			transmitted_packets,
+			mac_throughput_capacity,
+			link_availability,
+			phy_rate,
+		});
+	}
+
+	return {
+		transmitter_al_mac_address,
+		neighbor_al_mac_address,
+		link_metrics,
+	};
+};
+
+// 0x0a - 1905.1 receiver link metric
+// IEEE1905.1-2013
+decoder[0x0a] = (buf, end) => {
+	if (buf.pos() + 12 > end)
+		return null;
+
+	const transmitter_al_mac_address = ether_ntoa(buf.get('6s'));
+	const neighbor_al_mac_address = ether_ntoa(buf.get('6s'));
+	const link_metrics = [];
+
+	while (buf.pos() + 23 <= end) {
+		const local_if_mac_address = ether_ntoa(buf.get('6s'));
+		const remote_if_mac_address = ether_ntoa(buf.get('6s'));
+		const media_type = buf.get('!H');
+
+		if (!exists(defs.MEDIA_TYPE, media_type))
+			return null;
+
+		const packet_errors = buf.get('!L');
+		const received_packets = buf.get('!L');
+		const rssi = buf.get('B');
+
+		push(link_metrics, {
+			local_if_mac_address,
+			remote_if_mac_address,
+			media_type,
+			media_type_name: defs.MEDIA_TYPE[media_type],
+			packet_errors,
+			received_packets,
+			rssi,
+		});
+	}
+
+	return {
+		transmitter_al_mac_address,
+		neighbor_al_mac_address,
+		link_metrics,
+	};
+};
+
+// 0x0b - Vendor specific
+// IEEE1905.1-2013
+decoder[0x0b] = (buf, end) => {
+	if (buf.pos() + 3 > end)
+		return null;
+
+	const vendor_specific_oui = buf.get(3);
+	const vendor_specific_information = buf.get('*');
+
+	return {
+		vendor_specific_oui,
+		vendor_specific_information,
+	};
+};
+
+// 0x0c - 1905.1 link metric result code
+// IEEE1905.1-2013
+decoder[0x0c] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const result_code = buf.get('B');
+
+	if (!exists(defs.LINK_METRIC_RESULT_CODE, result_code))
+		return null;
+
+	return {
+		result_code,
+		result_code_name: defs.LINK_METRIC_RESULT_CODE[result_code],
+	};
+};
+
+// 0x0d - Searched Role
+// IEEE1905.1-2013
+decoder[0x0d] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const role = buf.get('B');
+
+	if (!exists(defs.IEEE1905_ROLE, role))
+		return null;
+
+	return {
+		role,
+		role_name: defs.IEEE1905_ROLE[role],
+	};
+};
+
+// 0x0e - Autoconfig Frequency Band
+// IEEE1905.1-2013
+decoder[0x0e] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const frequency_band = buf.get('B');
+
+	if (!exists(defs.IEEE1905_FREQUENCY_BAND, frequency_band))
+		return null;
+
+	return {
+		frequency_band,
+		frequency_band_name: defs.IEEE1905_FREQUENCY_BAND[frequency_band],
+	};
+};
+
+// 0x0f - Supported Role
+// IEEE1905.1-2013
+decoder[0x0f] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const role = buf.get('B');
+
+	if (!exists(defs.IEEE1905_ROLE, role))
+		return null;
+
+	return {
+		role,
+		role_name: defs.IEEE1905_ROLE[role],
+	};
+};
+
+// 0x10 - Supported Frequency Band
+// IEEE1905.1-2013
+decoder[0x10] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const frequency_band = buf.get('B');
+
+	if (!exists(defs.IEEE1905_FREQUENCY_BAND, frequency_band))
+		return null;
+
+	return {
+		frequency_band,
+		frequency_band_name: defs.IEEE1905_FREQUENCY_BAND[frequency_band],
+	};
+};
+
+// 0x11 - WSC
+// IEEE1905.1-2013
+decoder[0x11] = (buf, end) => buf.get(end - buf.pos());
+
+// 0x12 - Push_Button_Event notification
+// IEEE1905.1-2013
+decoder[0x12] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const media_types_count = buf.get('B');
+	const media_types = [];
+
+	for (let h = 0; h < media_types_count; h++) {
+		if (buf.pos() + 3 > end)
+			return null;
+
+		const media_type = buf.get('!H');
+
+		if (!exists(defs.MEDIA_TYPE, media_type))
+			return null;
+
+		const octets_count = buf.get('B');
+
+		if (buf.pos() + octets_count > end)
+			return null;
+
+		const media_specific_information = buf.get(octets_count);
+
+		push(media_types, {
+			media_type,
+			media_type_name: defs.MEDIA_TYPE[media_type],
+			media_specific_information,
+		});
+	}
+
+	return media_types;
+};
+
+// 0x13 - Push_Button_Join notification
+// IEEE1905.1-2013
+decoder[0x13] = (buf, end) => {
+	if (buf.pos() + 20 > end)
+		return null;
+
+	const al_id = ether_ntoa(buf.get('6s'));
+	const message_identifier = buf.get('!H');
+	const transmitter_if_mac_address = ether_ntoa(buf.get('6s'));
+	const neighbor_if_mac_address = ether_ntoa(buf.get('6s'));
+
+	return {
+		al_id,
+		message_identifier,
+		transmitter_if_mac_address,
+		neighbor_if_mac_address,
+	};
+};
+
+// 0x14 - Generic Phy device information
+// IEEE1905.1a-2014
+decoder[0x14] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const al_mac_address = ether_ntoa(buf.get('6s'));
+	const local_interfaces_count = buf.get('B');
+	const local_interfaces = [];
+
+	for (let h = 0; h < local_interfaces_count; h++) {
+		if (buf.pos() + 44 > end)
+			return null;
+
+		const local_if_mac_address = ether_ntoa(buf.get('6s'));
+		const phy_oui = buf.get(3);
+		const phy_variant = buf.get('B');
+		const phy_variant_name = buf.get(32);
+		const phy_description_url_length = buf.get('B');
+		const media_specific_information_length = buf.get('B');
+
+		if (buf.pos() + phy_description_url_length > end)
+			return null;
+
+		const phy_description_url = buf.get(phy_description_url_length);
+
+		if (buf.pos() + media_specific_information_length > end)
+			return null;
+
+		const media_specific_information = buf.get(media_specific_information_length);
+
+		push(local_interfaces, {
+			local_if_mac_address,
+			phy_oui,
+			phy_variant,
+			phy_variant_name,
+			phy_description_url,
+			media_specific_information,
+		});
+	}
+
+	return {
+		al_mac_address,
+		local_interfaces,
+	};
+};
+
+// 0x15 - Device identification
+// IEEE1905.1a-2014
+decoder[0x15] = (buf, end) => {
+	if (buf.pos() + 192 > end)
+		return null;
+
+	const friendly_name = buf.get(64);
+	const manufacturer_name = buf.get(64);
+	const manufacturer_model = buf.get(64);
+
+	return {
+		friendly_name,
+		manufacturer_name,
+		manufacturer_model,
+	};
+};
+
+// 0x16 - Control URL
+// IEEE1905.1a-2014
+decoder[0x16] = (buf, end) => buf.get(end - buf.pos());
+
+// 0x17 - IPv4
+// IEEE1905.1a-2014
+decoder[0x17] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const num_interfaces = buf.get('B');
+	const interfaces = [];
+
+	for (let h = 0; h < num_interfaces; h++) {
+		if (buf.pos() + 7 > end)
+			return null;
+
+		const if_mac_address = ether_ntoa(buf.get('6s'));
+		const addresses_count = buf.get('B');
+
+		if (addresses_count > 0x0f)
+			return null;
+
+		const addresses = [];
+
+		for (let i = 0; i < addresses_count; i++) {
+			if (buf.pos() + 9 > end)
+				return null;
+
+			const ipv4addr_type = buf.get('B');
+
+			if (!exists(defs.IPV4ADDR_TYPE, ipv4addr_type))
+				return null;
+
+			const address = arrtoip(buf.read('4B'));
+			const dhcp_server = arrtoip(buf.read('4B'));
+
+			push(addresses, {
+				ipv4addr_type,
+				ipv4addr_type_name: defs.IPV4ADDR_TYPE[ipv4addr_type],
+				address,
+				dhcp_server,
+			});
+		}
+
+		push(interfaces, {
+			if_mac_address,
+			addresses,
+		});
+	}
+
+	return interfaces;
+};
+
+// 0x18 - IPv6
+// IEEE1905.1a-2014
+decoder[0x18] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const num_interfaces = buf.get('B');
+	const interfaces = [];
+
+	for (let h = 0; h < num_interfaces; h++) {
+		if (buf.pos() + 23 > end)
+			return null;
+
+		const if_mac_address = ether_ntoa(buf.get('6s'));
+		const linklocal_address = arrtoip(buf.read('16B'));
+		const other_addresses_count = buf.get('B');
+
+		if (other_addresses_count > 0x0f)
+			return null;
+
+		const other_addresses = [];
+
+		for (let i = 0; i < other_addresses_count; i++) {
+			if (buf.pos() + 33 > end)
+				return null;
+
+			const ipv6addr_type = buf.get('B');
+
+			if (!exists(defs.IPV6ADDR_TYPE, ipv6addr_type))
+				return null;
+
+			const address = arrtoip(buf.read('16B'));
+			const origin = arrtoip(buf.read('16B'));
+
+			push(other_addresses, {
+				ipv6addr_type,
+				ipv6addr_type_name: defs.IPV6ADDR_TYPE[ipv6addr_type],
+				address,
+				origin,
+			});
+		}
+
+		push(interfaces, {
+			if_mac_address,
+			linklocal_address,
+			other_addresses,
+		});
+	}
+
+	return interfaces;
+};
+
+// 0x19 - Push Button Generic Phy Event
+// IEEE1905.1a-2014
+decoder[0x19] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const num_phy_media_types = buf.get('B');
+	const phy_media_types = [];
+
+	for (let h = 0; h < num_phy_media_types; h++) {
+		if (buf.pos() + 5 > end)
+			return null;
+
+		const phy_oui = buf.get(3);
+		const phy_variant = buf.get('B');
+		const media_specific_information_length = buf.get('B');
+
+		if (buf.pos() + media_specific_information_length > end)
+			return null;
+
+		const media_specific_information = buf.get(media_specific_information_length);
+
+		push(phy_media_types, {
+			phy_oui,
+			phy_variant,
+			media_specific_information,
+		});
+	}
+
+	return phy_media_types;
+};
+
+// 0x1a - 1905 profile version
+// IEEE1905.1a-2014
+decoder[0x1a] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const ieee1905_profile = buf.get('B');
+
+	if (!exists(defs.IEEE1905_PROFILE, ieee1905_profile))
+		return null;
+
+	return {
+		ieee1905_profile,
+		ieee1905_profile_name: defs.IEEE1905_PROFILE[ieee1905_profile],
+	};
+};
+
+// 0x1b - Power off interface
+// IEEE1905.1a-2014
+decoder[0x1b] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const interface_count = buf.get('B');
+	const interfaces = [];
+
+	for (let h = 0; h < interface_count; h++) {
+		if (buf.pos() + 13 > end)
+			return null;
+
+		const if_mac_address = ether_ntoa(buf.get('6s'));
+		const media_type = buf.get('!H');
+
+		if (!exists(defs.MEDIA_TYPE, media_type))
+			return null;
+
+		const phy_oui = buf.get(3);
+		const phy_variant = buf.get('B');
+		const media_specific_information_length = buf.get('B');
+
+		if (buf.pos() + phy_variant > end)
+			return null;
+
+		const media_specific_information = buf.get(phy_variant);
+
+		push(interfaces, {
+			if_mac_address,
+			media_type,
+			media_type_name: defs.MEDIA_TYPE[media_type],
+			phy_oui,
+			phy_variant,
+			media_specific_information,
+		});
+	}
+
+	return interfaces;
+};
+
+// 0x1c - Interface power change information
+// IEEE1905.1a-2014
+decoder[0x1c] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const interface_count = buf.get('B');
+	const interfaces = [];
+
+	for (let h = 0; h < interface_count; h++) {
+		if (buf.pos() + 7 > end)
+			return null;
+
+		const if_mac_address = ether_ntoa(buf.get('6s'));
+		const power_state = buf.get('B');
+
+		if (!exists(defs.POWER_STATE, power_state))
+			return null;
+
+		push(interfaces, {
+			if_mac_address,
+			power_state,
+			power_state_name: defs.POWER_STATE[power_state],
+		});
+	}
+
+	return interfaces;
+};
+
+// 0x1d - Interface power change status
+// IEEE1905.1a-2014
+decoder[0x1d] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const interface_count = buf.get('B');
+	const interfaces = [];
+
+	for (let h = 0; h < interface_count; h++) {
+		if (buf.pos() + 7 > end)
+			return null;
+
+		const if_mac_address = ether_ntoa(buf.get('6s'));
+		const change_state = buf.get('B');
+
+		if (!exists(defs.CHANGE_STATE, change_state))
+			return null;
+
+		push(interfaces, {
+			if_mac_address,
+			change_state,
+			change_state_name: defs.CHANGE_STATE[change_state],
+		});
+	}
+
+	return interfaces;
+};
+
+// 0x1e - L2 neighbor device
+// IEEE1905.1a-2014
+decoder[0x1e] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const interface_count = buf.get('B');
+	const interfaces = [];
+
+	for (let h = 0; h < interface_count; h++) {
+		if (buf.pos() + 8 > end)
+			return null;
+
+		const if_mac_address = ether_ntoa(buf.get('6s'));
+		const neighbor_count = buf.get('!H');
+		const neighbors = [];
+
+		for (let i = 0; i < neighbor_count; i++) {
+			if (buf.pos() + 8 > end)
+				return null;
+
+			const neighbor_mac_address = ether_ntoa(buf.get('6s'));
+			const behind_mac_address_count = buf.get('!H');
+			const behind_mac_addresses = [];
+
+			for (let j = 0; j < behind_mac_address_count; j++) {
+				if (buf.pos() + 6 > end)
+					return null;
+
+				const behind_mac_address = ether_ntoa(buf.get('6s'));
+
+				push(behind_mac_addresses, behind_mac_address);
+			}
+
+			push(neighbors, {
+				neighbor_mac_address,
+				behind_mac_addresses,
+			});
+		}
+
+		push(interfaces, {
+			if_mac_address,
+			neighbors,
+		});
+	}
+
+	return interfaces;
+};
+
+return { encoder, decoder, extended_encoder, extended_decoder };
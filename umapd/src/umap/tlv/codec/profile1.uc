@@ -0,0 +1,2484 @@
+import { ether_ntoa, ether_aton } from 'umap.core';
+import defs from 'umap.defs';
+
+const encoder = [];
+const decoder = [];
+const extended_encoder = [];
+const extended_decoder = [];
+
+// -----------------------------------------------------------------------------
+// TLV ENCODER ROUTINES
+// -----------------------------------------------------------------------------
+
+// 0x80 - Supported Service
+// Wi-Fi EasyMesh
+encoder[0x80] = (buf, services) => {
+	if (type(services) != "array" || length(services) > 0xff)
+		return null;
+
+	buf.put('B', length(services));
+
+	for (let supported_service in services) {
+		if (!(supported_service in [ 0x00, 0x01 ]))
+			return null;
+
+		buf.put('B', supported_service);
+	}
+
+	return buf;
+};
+
+// 0x81 - Searched Service
+// Wi-Fi EasyMesh
+encoder[0x81] = (buf, services) => {
+	if (type(services) != "array" || length(services) > 0xff)
+		return null;
+
+	buf.put('B', length(services));
+
+	for (let searched_service in services) {
+		if (!(searched_service in [ 0x00, 0x01 ]))
+			return null;
+
+		buf.put('B', searched_service);
+	}
+
+	return buf;
+};
+
+// 0x82 - AP Radio Identifier
+// Wi-Fi EasyMesh
+encoder[0x82] = (buf, radio_unique_identifier) => {
+	const _radio_unique_identifier = ether_aton(radio_unique_identifier);
+
+	if (_radio_unique_identifier == null)
+		return null;
+
+	buf.put('6s', _radio_unique_identifier);
+
+	return buf;
+};
+
+// 0x83 - AP Operational BSS
+// Wi-Fi EasyMesh
+encoder[0x83] = (buf, radios) => {
+	if (type(radios) != "array" || length(radios) > 0xff)
+		return null;
+
+	buf.put('B', length(radios));
+
+	for (let item in radios) {
+		if (type(item) != "object")
+			return null;
+
+		const radio_unique_identifier = ether_aton(item.radio_unique_identifier);
+
+		if (radio_unique_identifier == null)
+			return null;
+
+		if (type(item.bss) != "array" || length(item.bss) > 0xff)
+			return null;
+
+		buf.put('6s', radio_unique_identifier);
+		buf.put('B', length(item.bss));
+
+		for (let item2 in item.bss) {
+			if (type(item2) != "object")
+				return null;
+
+			const mac_address = ether_aton(item2.mac_address);
+
+			if (mac_address == null)
+				return null;
+
+			if (type(item2.ssid) != "string" || length(item2.ssid) > 0xff)
+				return null;
+
+			buf.put('6s', mac_address);
+			buf.put('B', length(item2.ssid));
+			buf.put('*', item2.ssid);
+		}
+	}
+
+	return buf;
+};
+
+// 0x84 - Associated Clients
+// Wi-Fi EasyMesh
+encoder[0x84] = (buf, bss) => {
+	if (type(bss) != "array" || length(bss) > 0xff)
+		return null;
+
+	buf.put('B', length(bss));
+
+	for (let item in bss) {
+		if (type(item) != "object")
+			return null;
+
+		const bssid = ether_aton(item.bssid);
+
+		if (bssid == null)
+			return null;
+
+		if (type(item.clients) != "array" || length(item.clients) > 0xffff)
+			return null;
+
+		buf.put('6s', bssid);
+		buf.put('!H', length(item.clients));
+
+		for (let item2 in item.clients) {
+			if (type(item2) != "object")
+				return null;
+
+			const mac_address = ether_aton(item2.mac_address);
+
+			if (mac_address == null)
+				return null;
+
+			if (type(item2.last_association) != "int" || item2.last_association < 0 || item2.last_association > 65535)
+				return null;
+
+			buf.put('6s', mac_address);
+			buf.put('!H', item2.last_association);
+		}
+	}
+
+	return buf;
+};
+
+// 0x85 - AP Radio Basic Capabilities
+// Wi-Fi EasyMesh
+encoder[0x85] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (type(tlv.max_bss_supported) != "int" || tlv.max_bss_supported < 0 || tlv.max_bss_supported > 0xff)
+		return null;
+
+	if (type(tlv.opclasses_supported) != "array" || length(tlv.opclasses_supported) > 0xff)
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', tlv.max_bss_supported);
+	buf.put('B', length(tlv.opclasses_supported));
+
+	for (let item in tlv.opclasses_supported) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.opclass) != "int" || item.opclass < 0 || item.opclass > 0xff)
+			return null;
+
+		if (type(item.max_txpower_eirp) != "int" || item.max_txpower_eirp < 0 || item.max_txpower_eirp > 0xff)
+			return null;
+
+		if (type(item.statically_non_operable_channels) != "array" || length(item.statically_non_operable_channels) > 0xff)
+			return null;
+
+		buf.put('B', item.opclass);
+		buf.put('B', item.max_txpower_eirp);
+		buf.put('B', length(item.statically_non_operable_channels));
+
+		for (let channel in item.statically_non_operable_channels) {
+			if (type(channel) != "int" || channel < 0 || channel > 0xff)
+				return null;
+
+			buf.put('B', channel);
+		}
+	}
+
+	return buf;
+};
+
+// 0x86 - AP HT Capabilities
+// Wi-Fi EasyMesh
+encoder[0x86] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (!(tlv.max_supported_tx_spatial_streams in [ 0b00, 0b01, 0b10, 0b11 ]))
+		return null;
+
+	if (!(tlv.max_supported_rx_spatial_streams in [ 0b00, 0b01, 0b10, 0b11 ]))
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', 0
+		| ((tlv.max_supported_tx_spatial_streams & 0b00000011) << 6)
+		| ((tlv.max_supported_rx_spatial_streams & 0b00000011) << 4)
+		| (tlv.short_gi_support_20mhz << 3)
+		| (tlv.short_gi_support_40mhz << 2)
+		| (tlv.ht_support_40mhz << 1)
+	);
+
+	return buf;
+};
+
+// 0x87 - AP VHT Capabilities
+// Wi-Fi EasyMesh
+encoder[0x87] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (type(tlv.supported_vht_tx_mcs) != "int" || tlv.supported_vht_tx_mcs < 0 || tlv.supported_vht_tx_mcs > 0xffff)
+		return null;
+
+	if (type(tlv.supported_vht_rx_mcs) != "int" || tlv.supported_vht_rx_mcs < 0 || tlv.supported_vht_rx_mcs > 0xffff)
+		return null;
+
+	if (!(tlv.max_supported_tx_spatial_streams in [ 0b000, 0b001, 0b010, 0b011, 0b100, 0b101, 0b110, 0b111 ]))
+		return null;
+
+	if (!(tlv.max_supported_rx_spatial_streams in [ 0b000, 0b001, 0b010, 0b011, 0b100, 0b101, 0b110, 0b111 ]))
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('!H', tlv.supported_vht_tx_mcs);
+	buf.put('!H', tlv.supported_vht_rx_mcs);
+	buf.put('B', 0
+		| ((tlv.max_supported_tx_spatial_streams & 0b00000111) << 5)
+		| ((tlv.max_supported_rx_spatial_streams & 0b00000111) << 2)
+		| (tlv.short_gi_support_80mhz << 1)
+		| (tlv.short_gi_support_160mhz_8080mhz << 0)
+	);
+
+	buf.put('B', 0
+		| (tlv.vht_support_8080mhz << 7)
+		| (tlv.vht_support_160mhz << 6)
+		| (tlv.su_beamformer_capable << 5)
+		| (tlv.mu_beamformer_capable << 4)
+	);
+
+	return buf;
+};
+
+// 0x88 - AP HE Capabilities
+// Wi-Fi EasyMesh
+encoder[0x88] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (type(tlv.supported_he_mcs) != "string" || length(tlv.supported_he_mcs) > 0xff)
+		return null;
+
+	if (!(tlv.max_supported_tx_spatial_streams in [ 0b000, 0b001, 0b010, 0b011, 0b100, 0b101, 0b110, 0b111 ]))
+		return null;
+
+	if (!(tlv.max_supported_rx_spatial_streams in [ 0b000, 0b001, 0b010, 0b011, 0b100, 0b101, 0b110, 0b111 ]))
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', length(tlv.supported_he_mcs));
+	buf.put('*', tlv.supported_he_mcs);
+	buf.put('B', 0
+		| ((tlv.max_supported_tx_spatial_streams & 0b00000111) << 5)
+		| ((tlv.max_supported_rx_spatial_streams & 0b00000111) << 2)
+		| (tlv.he_support_8080mhz << 1)
+		| (tlv.he_support_160mhz << 0)
+	);
+
+	buf.put('B', 0
+		| (tlv.su_beamformer_capable << 7)
+		| (tlv.mu_beamformer_capable << 6)
+		| (tlv.ul_mu_mimo_capable << 5)
+		| (tlv.ul_mu_mimo_ofdma_capable << 4)
+		| (tlv.dl_mu_mimo_ofdma_capable << 3)
+		| (tlv.ul_ofdma_capable << 2)
+		| (tlv.dl_ofdma_capable << 1)
+	);
+
+	return buf;
+};
+
+// 0x89 - Steering Policy
+// Wi-Fi EasyMesh
+encoder[0x89] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.local_steering_disallowed_sta) != "array" || length(tlv.local_steering_disallowed_sta) > 0xff)
+		return null;
+
+	if (type(tlv.btm_steering_disallowed_sta) != "array" || length(tlv.btm_steering_disallowed_sta) > 0xff)
+		return null;
+
+	if (type(tlv.radios) != "array" || length(tlv.radios) > 0xff)
+		return null;
+
+	buf.put('B', length(tlv.local_steering_disallowed_sta));
+
+	for (let sta_mac_address in tlv.local_steering_disallowed_sta) {
+		const _sta_mac_address = ether_aton(sta_mac_address);
+
+		if (_sta_mac_address == null)
+			return null;
+
+		buf.put('6s', _sta_mac_address);
+	}
+
+	buf.put('B', length(tlv.btm_steering_disallowed_sta));
+
+	for (let sta_mac_address in tlv.btm_steering_disallowed_sta) {
+		const _sta_mac_address = ether_aton(sta_mac_address);
+
+		if (_sta_mac_address == null)
+			return null;
+
+		buf.put('6s', _sta_mac_address);
+	}
+
+	buf.put('B', length(tlv.radios));
+
+	for (let item in tlv.radios) {
+		if (type(item) != "object")
+			return null;
+
+		const radio_unique_identifier = ether_aton(item.radio_unique_identifier);
+
+		if (radio_unique_identifier == null)
+			return null;
+
+		if (!(item.steering_policy in [ 0x00, 0x01, 0x02 ]))
+			return null;
+
+		if (type(item.channel_utilization_threshold) != "int" || item.channel_utilization_threshold < 0 || item.channel_utilization_threshold > 0xff)
+			return null;
+
+		if (type(item.rcpi_steering_threshold) != "int" || item.rcpi_steering_threshold < 0 || item.rcpi_steering_threshold > 220)
+			return null;
+
+		buf.put('6s', radio_unique_identifier);
+		buf.put('B', item.steering_policy);
+		buf.put('B', item.channel_utilization_threshold);
+		buf.put('B', item.rcpi_steering_threshold);
+	}
+
+	return buf;
+};
+
+// 0x8a - Metric Reporting Policy
+// Wi-Fi EasyMesh
+encoder[0x8a] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.ap_metrics_reporting_interval) != "int" || tlv.ap_metrics_reporting_interval < 0 || tlv.ap_metrics_reporting_interval > 255)
+		return null;
+
+	if (type(tlv.radios) != "array" || length(tlv.radios) > 0xff)
+		return null;
+
+	buf.put('B', tlv.ap_metrics_reporting_interval);
+	buf.put('B', length(tlv.radios));
+
+	for (let item in tlv.radios) {
+		if (type(item) != "object")
+			return null;
+
+		const radio_unique_identifier = ether_aton(item.radio_unique_identifier);
+
+		if (radio_unique_identifier == null)
+			return null;
+
+		if (type(item.sta_metrics_reporting_rcpi_threshold) != "int" || item.sta_metrics_reporting_rcpi_threshold < 0 || item.sta_metrics_reporting_rcpi_threshold > 220)
+			return null;
+
+		if (type(item.sta_metrics_reporting_rcpi_hysteresis_margin_override) != "int" || item.sta_metrics_reporting_rcpi_hysteresis_margin_override < 0 || item.sta_metrics_reporting_rcpi_hysteresis_margin_override > 0xff)
+			return null;
+
+		if (type(item.ap_metrics_channel_utilization_reporting_threshold) != "int" || item.ap_metrics_channel_utilization_reporting_threshold < 0 || item.ap_metrics_channel_utilization_reporting_threshold > 0xff)
+			return null;
+
+		buf.put('6s', radio_unique_identifier);
+		buf.put('B', item.sta_metrics_reporting_rcpi_threshold);
+		buf.put('B', item.sta_metrics_reporting_rcpi_hysteresis_margin_override);
+		buf.put('B', item.ap_metrics_channel_utilization_reporting_threshold);
+		buf.put('B', 0
+			| (item.associated_sta_traffic_stats_inclusion_policy << 7)
+			| (item.associated_sta_link_metrics_inclusion_policy << 6)
+			| (item.associated_wifi6_sta_status_inclusion_policy << 5)
+		);
+	}
+
+	return buf;
+};
+
+// 0x8b - Channel Preference
+// Wi-Fi EasyMesh
+encoder[0x8b] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (type(tlv.opclasses) != "array" || length(tlv.opclasses) > 0xff)
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', length(tlv.opclasses));
+
+	for (let item in tlv.opclasses) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.opclass) != "int" || item.opclass < 0 || item.opclass > 0xff)
+			return null;
+
+		if (type(item.channels) != "array")
+			return null;
+
+		if (type(item.preference) != "int" || item.preference < 0 || item.preference > 15)
+			return null;
+
+		if (!(item.reason_code in [ 0b0000, 0b0001, 0b0010, 0b0011, 0b0100, 0b0101, 0b0110, 0b0111, 0b1000, 0b1001, 0b1010, 0b1011, 0b1100 ]))
+			return null;
+
+		buf.put('B', item.opclass);
+		buf.put('B', length(item.channels));
+
+		for (let item2 in item.channels) {
+			if (type(item2) != "int" || item2 < 0 || item2 > 0xff)
+				return null;
+
+			buf.put('B', item2);
+		}
+
+		buf.put('B', 0
+			| ((item.preference & 0b00001111) << 4)
+			| ((item.reason_code & 0b00001111) << 0)
+		);
+	}
+
+	return buf;
+};
+
+// 0x8c - Radio Operation Restriction
+// Wi-Fi EasyMesh
+encoder[0x8c] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (type(tlv.opclasses) != "array" || length(tlv.opclasses) > 0xff)
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', length(tlv.opclasses));
+
+	for (let item in tlv.opclasses) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.opclass) != "int" || item.opclass < 0 || item.opclass > 0xff)
+			return null;
+
+		if (type(item.channels) != "array" || length(item.channels) > 0xff)
+			return null;
+
+		buf.put('B', item.opclass);
+		buf.put('B', length(item.channels));
+
+		for (let item2 in item.channels) {
+			if (type(item2) != "object")
+				return null;
+
+			if (type(item2.channel) != "int" || item2.channel < 0 || item2.channel > 0xff)
+				return null;
+
+			if (type(item2.minimum_frequency_separation) != "int" || item2.minimum_frequency_separation < 0 || item2.minimum_frequency_separation > 0xff)
+				return null;
+
+			buf.put('B', item2.channel);
+			buf.put('B', item2.minimum_frequency_separation);
+		}
+	}
+
+	return buf;
+};
+
+// 0x8d - Transmit Power Limit
+// Wi-Fi EasyMesh
+encoder[0x8d] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (type(tlv.txpower_limit_eirp) != "int" || tlv.txpower_limit_eirp < 0 || tlv.txpower_limit_eirp > 0xff)
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', tlv.txpower_limit_eirp);
+
+	return buf;
+};
+
+// 0x8e - Channel Selection Response
+// Wi-Fi EasyMesh
+encoder[0x8e] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (!(tlv.channel_selection_response_code in [ 0x00, 0x01, 0x02, 0x03 ]))
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', tlv.channel_selection_response_code);
+
+	return buf;
+};
+
+// 0x8f - Operating Channel Report
+// Wi-Fi EasyMesh
+encoder[0x8f] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (type(tlv.current_opclasses) != "array" || length(tlv.current_opclasses) > 0xff)
+		return null;
+
+	if (type(tlv.current_txpower_eirp) != "int" || tlv.current_txpower_eirp < 0 || tlv.current_txpower_eirp > 0xff)
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', length(tlv.current_opclasses));
+
+	for (let item in tlv.current_opclasses) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.opclass) != "int" || item.opclass < 0 || item.opclass > 0xff)
+			return null;
+
+		if (type(item.current_operating_channel) != "int" || item.current_operating_channel < 0 || item.current_operating_channel > 0xff)
+			return null;
+
+		buf.put('B', item.opclass);
+		buf.put('B', item.current_operating_channel);
+	}
+
+	buf.put('B', tlv.current_txpower_eirp);
+
+	return buf;
+};
+
+// 0x90 - Client Info
+// Wi-Fi EasyMesh
+encoder[0x90] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	const mac_address = ether_aton(tlv.mac_address);
+
+	if (mac_address == null)
+		return null;
+
+	buf.put('6s', bssid);
+	buf.put('6s', mac_address);
+
+	return buf;
+};
+
+// 0x91 - Client Capability Report
+// Wi-Fi EasyMesh
+encoder[0x91] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (!(tlv.result_code in [ 0x00, 0x01 ]))
+		return null;
+
+	if (tlv.frame_body != null && (type(tlv.frame_body) != "string"))
+		return null;
+
+	tlv.result_code ??= (tlv.frame_body != null) && 0;
+
+	buf.put('B', tlv.result_code);
+
+	if (tlv.result_code == 0)
+		buf.put('Z', tlv.frame_body);
+
+	return buf;
+};
+
+// 0x92 - Client Association Event
+// Wi-Fi EasyMesh
+encoder[0x92] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const mac_address = ether_aton(tlv.mac_address);
+
+	if (mac_address == null)
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	buf.put('6s', mac_address);
+	buf.put('6s', bssid);
+	buf.put('B', 0
+		| (tlv.association_event << 7)
+	);
+
+	return buf;
+};
+
+// 0x93 - AP Metric Query
+// Wi-Fi EasyMesh
+encoder[0x93] = (buf, bssids) => {
+	if (type(bssids) != "array" || length(bssids) > 0xff)
+		return null;
+
+	buf.put('B', length(bssids));
+
+	for (let bssid in bssids) {
+		const _bssid = ether_aton(bssid);
+
+		if (_bssid == null)
+			return null;
+
+		buf.put('6s', _bssid);
+	}
+
+	return buf;
+};
+
+// 0x94 - AP Metrics
+// Wi-Fi EasyMesh
+encoder[0x94] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	if (type(tlv.channel_utilization) != "int" || tlv.channel_utilization < 0 || tlv.channel_utilization > 0xff)
+		return null;
+
+	if (type(tlv.sta_count) != "int" || tlv.sta_count < 0 || tlv.sta_count > 0xffff)
+		return null;
+
+	if (tlv.esp_be != null && (type(tlv.esp_be) != "string" || length(tlv.esp_be) > 3))
+		return null;
+
+	if (tlv.esp_bk != null && (type(tlv.esp_bk) != "string" || length(tlv.esp_bk) > 3))
+		return null;
+
+	if (tlv.esp_vo != null && (type(tlv.esp_vo) != "string" || length(tlv.esp_vo) > 3))
+		return null;
+
+	if (tlv.esp_vi != null && (type(tlv.esp_vi) != "string" || length(tlv.esp_vi) > 3))
+		return null;
+
+	tlv.include_esp_be ??= (tlv.esp_be != null) && 1;
+	tlv.include_esp_bk ??= (tlv.esp_bk != null) && 1;
+	tlv.include_esp_vo ??= (tlv.esp_vo != null) && 1;
+	tlv.include_esp_vi ??= (tlv.esp_vi != null) && 1;
+
+	buf.put('6s', bssid);
+	buf.put('B', tlv.channel_utilization);
+	buf.put('!H', tlv.sta_count);
+	buf.put('B', 0
+		| (tlv.include_esp_be << 7)
+		| (tlv.include_esp_bk << 6)
+		| (tlv.include_esp_vo << 5)
+		| (tlv.include_esp_vi << 4)
+	);
+
+	if (tlv.include_esp_be == 1)
+		buf.put('3s', tlv.esp_be);
+
+	if (tlv.include_esp_bk == 1)
+		buf.put('3s', tlv.esp_bk);
+
+	if (tlv.include_esp_vo == 1)
+		buf.put('3s', tlv.esp_vo);
+
+	if (tlv.include_esp_vi == 1)
+		buf.put('3s', tlv.esp_vi);
+
+	return buf;
+};
+
+// 0x95 - STA MAC Address Type
+// Wi-Fi EasyMesh
+encoder[0x95] = (buf, mac_address) => {
+	const _mac_address = ether_aton(mac_address);
+
+	if (_mac_address == null)
+		return null;
+
+	buf.put('6s', _mac_address);
+
+	return buf;
+};
+
+// 0x96 - Associated STA Link Metrics
+// Wi-Fi EasyMesh
+encoder[0x96] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const mac_address = ether_aton(tlv.mac_address);
+
+	if (mac_address == null)
+		return null;
+
+	if (type(tlv.bssids) != "array" || length(tlv.bssids) > 0xff)
+		return null;
+
+	buf.put('6s', mac_address);
+	buf.put('B', length(tlv.bssids));
+
+	for (let item in tlv.bssids) {
+		if (type(item) != "object")
+			return null;
+
+		const bssid = ether_aton(item.bssid);
+
+		if (bssid == null)
+			return null;
+
+		if (type(item.time_delta) != "int" || item.time_delta < 0 || item.time_delta > 0xffffffff)
+			return null;
+
+		if (type(item.estimated_downlink_mac_data_rate) != "int" || item.estimated_downlink_mac_data_rate < 0 || item.estimated_downlink_mac_data_rate > 0xffffffff)
+			return null;
+
+		if (type(item.estimated_uplink_mac_data_rate) != "int" || item.estimated_uplink_mac_data_rate < 0 || item.estimated_uplink_mac_data_rate > 0xffffffff)
+			return null;
+
+		if (type(item.uplink_rcpi) != "int" || item.uplink_rcpi < 0 || item.uplink_rcpi > 220)
+			return null;
+
+		buf.put('6s', bssid);
+		buf.put('!L', item.time_delta);
+		buf.put('!L', item.estimated_downlink_mac_data_rate);
+		buf.put('!L', item.estimated_uplink_mac_data_rate);
+		buf.put('B', item.uplink_rcpi);
+	}
+
+	return buf;
+};
+
+// 0x97 - Unassociated STA Link Metrics Query
+// Wi-Fi EasyMesh
+encoder[0x97] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.opclass) != "int" || tlv.opclass < 0 || tlv.opclass > 0xff)
+		return null;
+
+	if (type(tlv.channels) != "array" || length(tlv.channels) > 0xff)
+		return null;
+
+	buf.put('B', tlv.opclass);
+	buf.put('B', length(tlv.channels));
+
+	for (let item in tlv.channels) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.channel) != "int" || item.channel < 0 || item.channel > 0xff)
+			return null;
+
+		if (type(item.sta_mac_addresses) != "array" || length(item.sta_mac_addresses) > 0xff)
+			return null;
+
+		buf.put('B', item.channel);
+		buf.put('B', length(item.sta_mac_addresses));
+
+		for (let sta_mac_address in item.sta_mac_addresses) {
+			const _sta_mac_address = ether_aton(sta_mac_address);
+
+			if (_sta_mac_address == null)
+				return null;
+
+			buf.put('6s', _sta_mac_address);
+		}
+	}
+
+	return buf;
+};
+
+// 0x98 - Unassociated STA Link Metrics Response
+// Wi-Fi EasyMesh
+encoder[0x98] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.opclass) != "int" || tlv.opclass < 0 || tlv.opclass > 0xff)
+		return null;
+
+	if (type(tlv.sta_entries) != "array" || length(tlv.sta_entries) > 0xff)
+		return null;
+
+	buf.put('B', tlv.opclass);
+	buf.put('B', length(tlv.sta_entries));
+
+	for (let item in tlv.sta_entries) {
+		if (type(item) != "object")
+			return null;
+
+		const mac_address = ether_aton(item.mac_address);
+
+		if (mac_address == null)
+			return null;
+
+		if (type(item.channel) != "int" || item.channel < 0 || item.channel > 0xff)
+			return null;
+
+		if (type(item.time_delta) != "int" || item.time_delta < 0 || item.time_delta > 0xffffffff)
+			return null;
+
+		if (type(item.uplink_rcpi) != "int" || item.uplink_rcpi < 0 || item.uplink_rcpi > 220)
+			return null;
+
+		buf.put('6s', mac_address);
+		buf.put('B', item.channel);
+		buf.put('!L', item.time_delta);
+		buf.put('B', item.uplink_rcpi);
+	}
+
+	return buf;
+};
+
+// 0x99 - Beacon Metrics Query
+// Wi-Fi EasyMesh
+encoder[0x99] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const mac_address = ether_aton(tlv.mac_address);
+
+	if (mac_address == null)
+		return null;
+
+	if (type(tlv.opclass) != "int" || tlv.opclass < 0 || tlv.opclass > 0xff)
+		return null;
+
+	if (type(tlv.channel) != "int" || tlv.channel < 0 || tlv.channel > 0xff)
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	if (type(tlv.reporting_detail_value) != "int" || tlv.reporting_detail_value < 0 || tlv.reporting_detail_value > 0xff)
+		return null;
+
+	if (type(tlv.ssid) != "string" || length(tlv.ssid) > 0xff)
+		return null;
+
+	if (type(tlv.ap_channel_reports) != "array" || length(tlv.ap_channel_reports) > 0xff)
+		return null;
+
+	if (type(tlv.element_list) != "array")
+		return null;
+
+	buf.put('6s', mac_address);
+	buf.put('B', tlv.opclass);
+	buf.put('B', tlv.channel);
+	buf.put('6s', bssid);
+	buf.put('B', tlv.reporting_detail_value);
+	buf.put('B', length(tlv.ssid));
+	buf.put('*', tlv.ssid);
+	buf.put('B', length(tlv.ap_channel_reports));
+
+	for (let item in tlv.ap_channel_reports) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.opclass) != "int" || item.opclass < 0 || item.opclass > 0xff)
+			return null;
+
+		if (type(item.channels) != "array")
+			return null;
+
+		buf.put('B', length(item.channels));
+		buf.put('B', item.opclass);
+
+		for (let item2 in item.channels) {
+			if (type(item2) != "int" || item2 < 0 || item2 > 0xff)
+				return null;
+
+			buf.put('B', item2);
+		}
+	}
+
+	buf.put('B', length(tlv.element_list));
+
+	for (let item in tlv.element_list) {
+		if (type(item) != "int" || item < 0 || item > 0xff)
+			return null;
+
+		buf.put('B', item);
+	}
+
+	return buf;
+};
+
+// 0x9a - Beacon Metrics Response
+// Wi-Fi EasyMesh
+encoder[0x9a] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const mac_address = ether_aton(tlv.mac_address);
+
+	if (mac_address == null)
+		return null;
+
+	if (type(tlv.measurement_report_elements) != "array" || length(tlv.measurement_report_elements) > 0xff)
+		return null;
+
+	buf.put('6s', mac_address);
+	buf.put('1x');
+	buf.put('B', length(tlv.measurement_report_elements));
+
+	for (let item in tlv.measurement_report_elements) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.id) != "int" || item.id < 0 || item.id > 0xff)
+			return null;
+
+		if (type(item.token) != "int" || item.token < 0 || item.token > 0xff)
+			return null;
+
+		if (type(item.report_mode) != "int" || item.report_mode < 0 || item.report_mode > 0xff)
+			return null;
+
+		if (type(item.type) != "int" || item.type < 0 || item.type > 0xff)
+			return null;
+
+		if (type(item.report_data) != "string" || length(item.report_data) > 0xff - 3)
+			return null;
+
+		buf.put('B', item.id);
+		buf.put('B', length(item.report_data) + 3);
+		buf.put('B', item.token);
+		buf.put('B', item.report_mode);
+		buf.put('B', item.type);
+		buf.put('*', item.report_data);
+	}
+
+	return buf;
+};
+
+// 0x9b - Steering Request
+// Wi-Fi EasyMesh
+encoder[0x9b] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	if (type(tlv.steering_opportunity_window) != "int" || tlv.steering_opportunity_window < 0 || tlv.steering_opportunity_window > 0xffff)
+		return null;
+
+	if (type(tlv.btm_disassociation_timer) != "int" || tlv.btm_disassociation_timer < 0 || tlv.btm_disassociation_timer > 0xffff)
+		return null;
+
+	if (type(tlv.sta_list) != "array" || length(tlv.sta_list) > 0xff)
+		return null;
+
+	if (type(tlv.target_bssid_list) != "array" || length(tlv.target_bssid_list) > 0xff)
+		return null;
+
+	buf.put('6s', bssid);
+	buf.put('B', 0
+		| (tlv.request_mode << 7)
+		| (tlv.btm_disassociation_imminent_bit << 6)
+		| (tlv.btm_abridged_bit << 5)
+	);
+
+	buf.put('!H', tlv.steering_opportunity_window);
+	buf.put('!H', tlv.btm_disassociation_timer);
+	buf.put('B', length(tlv.sta_list));
+
+	for (let sta_mac_address in tlv.sta_list) {
+		const _sta_mac_address = ether_aton(sta_mac_address);
+
+		if (_sta_mac_address == null)
+			return null;
+
+		buf.put('6s', _sta_mac_address);
+	}
+
+	buf.put('B', length(tlv.target_bssid_list));
+
+	for (let item in tlv.target_bssid_list) {
+		if (type(item) != "object")
+			return null;
+
+		const target_bssid = ether_aton(item.target_bssid);
+
+		if (target_bssid == null)
+			return null;
+
+		if (type(item.target_bss_opclass) != "int" || item.target_bss_opclass < 0 || item.target_bss_opclass > 0xff)
+			return null;
+
+		if (type(item.target_bss_channel) != "int" || item.target_bss_channel < 0 || item.target_bss_channel > 0xff)
+			return null;
+
+		buf.put('6s', target_bssid);
+		buf.put('B', item.target_bss_opclass);
+		buf.put('B', item.target_bss_channel);
+	}
+
+	return buf;
+};
+
+// 0x9c - Steering BTM Report
+// Wi-Fi EasyMesh
+encoder[0x9c] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	const sta_mac_address = ether_aton(tlv.sta_mac_address);
+
+	if (sta_mac_address == null)
+		return null;
+
+	if (type(tlv.btm_status_code) != "int" || tlv.btm_status_code < 0 || tlv.btm_status_code > 0xff)
+		return null;
+
+	const target_bssid = ether_aton(tlv.target_bssid);
+
+	if (target_bssid == null)
+		return null;
+
+	buf.put('6s', bssid);
+	buf.put('6s', sta_mac_address);
+	buf.put('B', tlv.btm_status_code);
+	buf.put('6s', target_bssid);
+
+	return buf;
+};
+
+// 0x9d - Client Association Control Request
+// Wi-Fi EasyMesh
+encoder[0x9d] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	if (!(tlv.association_control in [ 0x00, 0x01, 0x02, 0x03 ]))
+		return null;
+
+	if (type(tlv.validity_period) != "int" || tlv.validity_period < 0 || tlv.validity_period > 0xffff)
+		return null;
+
+	if (type(tlv.sta_list) != "array" || length(tlv.sta_list) > 0xff)
+		return null;
+
+	buf.put('6s', bssid);
+	buf.put('B', tlv.association_control);
+	buf.put('!H', tlv.validity_period);
+	buf.put('B', length(tlv.sta_list));
+
+	for (let sta_mac_address in tlv.sta_list) {
+		const _sta_mac_address = ether_aton(sta_mac_address);
+
+		if (_sta_mac_address == null)
+			return null;
+
+		buf.put('6s', _sta_mac_address);
+	}
+
+	return buf;
+};
+
+// 0x9e - Backhaul Steering Request
+// Wi-Fi EasyMesh
+encoder[0x9e] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const mac_address = ether_aton(tlv.mac_address);
+
+	if (mac_address == null)
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	if (type(tlv.opclass) != "int" || tlv.opclass < 0 || tlv.opclass > 0xff)
+		return null;
+
+	if (type(tlv.channel) != "int" || tlv.channel < 0 || tlv.channel > 0xff)
+		return null;
+
+	buf.put('6s', mac_address);
+	buf.put('6s', bssid);
+	buf.put('B', tlv.opclass);
+	buf.put('B', tlv.channel);
+
+	return buf;
+};
+
+// 0x9f - Backhaul Steering Response
+// Wi-Fi EasyMesh
+encoder[0x9f] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const mac_address = ether_aton(tlv.mac_address);
+
+	if (mac_address == null)
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	if (!(tlv.result_code in [ 0x00, 0x01 ]))
+		return null;
+
+	buf.put('6s', mac_address);
+	buf.put('6s', bssid);
+	buf.put('B', tlv.result_code);
+
+	return buf;
+};
+
+// 0xa0 - Higher Layer Data
+// Wi-Fi EasyMesh
+encoder[0xa0] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.protocol) != "int" || tlv.protocol < 0 || tlv.protocol > 0xff)
+		return null;
+
+	if (type(tlv.data) != "string")
+		return null;
+
+	buf.put('B', tlv.protocol);
+	buf.put('*', tlv.data);
+
+	return buf;
+};
+
+// 0xa1 - AP Capability
+// Wi-Fi EasyMesh
+encoder[0xa1] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	buf.put('B', 0
+		| (tlv.onchannel_unassoc_sta_metrics << 7)
+		| (tlv.offchannel_unassoc_sta_metrics << 6)
+		| (tlv.agent_initiated_rcpi_steering << 5)
+	);
+
+	return buf;
+};
+
+// 0xa2 - Associated STA Traffic Stats
+// Wi-Fi EasyMesh
+encoder[0xa2] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const mac_address = ether_aton(tlv.mac_address);
+
+	if (mac_address == null)
+		return null;
+
+	if (type(tlv.bytes_sent) != "int" || tlv.bytes_sent < 0 || tlv.bytes_sent > 0xffffffff)
+		return null;
+
+	if (type(tlv.bytes_received) != "int" || tlv.bytes_received < 0 || tlv.bytes_received > 0xffffffff)
+		return null;
+
+	if (type(tlv.packets_sent) != "int" || tlv.packets_sent < 0 || tlv.packets_sent > 0xffffffff)
+		return null;
+
+	if (type(tlv.packets_received) != "int" || tlv.packets_received < 0 || tlv.packets_received > 0xffffffff)
+		return null;
+
+	if (type(tlv.tx_packets_errors) != "int" || tlv.tx_packets_errors < 0 || tlv.tx_packets_errors > 0xffffffff)
+		return null;
+
+	if (type(tlv.rx_packets_errors) != "int" || tlv.rx_packets_errors < 0 || tlv.rx_packets_errors > 0xffffffff)
+		return null;
+
+	if (type(tlv.retransmission_count) != "int" || tlv.retransmission_count < 0 || tlv.retransmission_count > 0xffffffff)
+		return null;
+
+	buf.put('6s', mac_address);
+	buf.put('!L', tlv.bytes_sent);
+	buf.put('!L', tlv.bytes_received);
+	buf.put('!L', tlv.packets_sent);
+	buf.put('!L', tlv.packets_received);
+	buf.put('!L', tlv.tx_packets_errors);
+	buf.put('!L', tlv.rx_packets_errors);
+	buf.put('!L', tlv.retransmission_count);
+
+	return buf;
+};
+
+// 0xa3 - Error Code
+// Wi-Fi EasyMesh
+encoder[0xa3] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (!(tlv.reason_code in [ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 ]))
+		return null;
+
+	const mac_address = ether_aton(tlv.mac_address);
+
+	if (mac_address == null)
+		return null;
+
+	buf.put('B', tlv.reason_code);
+	buf.put('6s', mac_address);
+
+	return buf;
+};
+
+// -----------------------------------------------------------------------------
+// TLV DECODER ROUTINES
+// -----------------------------------------------------------------------------
+
+// 0x80 - Supported Service
+// Wi-Fi EasyMesh
+decoder[0x80] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const services_count = buf.get('B');
+	const services = [];
+
+	for (let h = 0; h < services_count; h++) {
+		if (buf.pos() + 1 > end)
+			return null;
+
+		const supported_service = buf.get('B');
+
+		if (!exists(defs.MULTI_AP_SERVICE, supported_service))
+			return null;
+
+		push(services, {
+			supported_service,
+			supported_service_name: defs.MULTI_AP_SERVICE[supported_service],
+		});
+	}
+
+	return services;
+};
+
+// 0x81 - Searched Service
+// Wi-Fi EasyMesh
+decoder[0x81] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const services_count = buf.get('B');
+	const services = [];
+
+	for (let h = 0; h < services_count; h++) {
+		if (buf.pos() + 1 > end)
+			return null;
+
+		const searched_service = buf.get('B');
+
+		if (!exists(defs.MULTI_AP_SERVICE, searched_service))
+			return null;
+
+		push(services, {
+			searched_service,
+			searched_service_name: defs.MULTI_AP_SERVICE[searched_service],
+		});
+	}
+
+	return services;
+};
+
+// 0x82 - AP Radio Identifier
+// Wi-Fi EasyMesh
+decoder[0x82] = (buf, end) => {
+	if (buf.pos() + 6 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+
+	return radio_unique_identifier;
+};
+
+// 0x83 - AP Operational BSS
+// Wi-Fi EasyMesh
+decoder[0x83] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const radios_count = buf.get('B');
+	const radios = [];
+
+	for (let h = 0; h < radios_count; h++) {
+		if (buf.pos() + 7 > end)
+			return null;
+
+		const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+		const bss_count = buf.get('B');
+		const bss = [];
+
+		for (let i = 0; i < bss_count; i++) {
+			if (buf.pos() + 7 > end)
+				return null;
+
+			const mac_address = ether_ntoa(buf.get('6s'));
+			const ssid_length = buf.get('B');
+
+			if (buf.pos() + ssid_length > end)
+				return null;
+
+			const ssid = buf.get(ssid_length);
+
+			push(bss, {
+				mac_address,
+				ssid,
+			});
+		}
+
+		push(radios, {
+			radio_unique_identifier,
+			bss,
+		});
+	}
+
+	return radios;
+};
+
+// 0x84 - Associated Clients
+// Wi-Fi EasyMesh
+decoder[0x84] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const bss_count = buf.get('B');
+	const bss = [];
+
+	for (let h = 0; h < bss_count; h++) {
+		if (buf.pos() + 8 > end)
+			return null;
+
+		const bssid = ether_ntoa(buf.get('6s'));
+		const clients_count = buf.get('!H');
+		const clients = [];
+
+		for (let i = 0; i < clients_count; i++) {
+			if (buf.pos() + 8 > end)
+				return null;
+
+			const mac_address = ether_ntoa(buf.get('6s'));
+			const last_association = buf.get('!H');
+
+			if (last_association > 0xffff)
+				return null;
+
+			push(clients, {
+				mac_address,
+				last_association,
+			});
+		}
+
+		push(bss, {
+			bssid,
+			clients,
+		});
+	}
+
+	return bss;
+};
+
+// 0x85 - AP Radio Basic Capabilities
+// Wi-Fi EasyMesh
+decoder[0x85] = (buf, end) => {
+	if (buf.pos() + 8 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const max_bss_supported = buf.get('B');
+	const opclass_supported_count = buf.get('B');
+	const opclasses_supported = [];
+
+	for (let h = 0; h < opclass_supported_count; h++) {
+		if (buf.pos() + 3 > end)
+			return null;
+
+		const opclass = buf.get('B');
+		const max_txpower_eirp = buf.get('B');
+		const statically_non_operable_channels_count = buf.get('B');
+		const statically_non_operable_channels = [];
+
+		for (let i = 0; i < statically_non_operable_channels_count; i++) {
+			if (buf.pos() + 1 > end)
+				return null;
+
+			const channel = buf.get('B');
+
+			push(statically_non_operable_channels, channel);
+		}
+
+		push(opclasses_supported, {
+			opclass,
+			max_txpower_eirp,
+			statically_non_operable_channels,
+		});
+	}
+
+	return {
+		radio_unique_identifier,
+		max_bss_supported,
+		opclasses_supported,
+	};
+};
+
+// 0x86 - AP HT Capabilities
+// Wi-Fi EasyMesh
+decoder[0x86] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+
+	const bitfield = buf.get('B');
+	const max_supported_tx_spatial_streams = (bitfield >> 6) & 0b00000011;
+	const max_supported_rx_spatial_streams = (bitfield >> 4) & 0b00000011;
+	const short_gi_support_20mhz = ((bitfield & 0b00001000) == 0b00001000);
+	const short_gi_support_40mhz = ((bitfield & 0b00000100) == 0b00000100);
+	const ht_support_40mhz = ((bitfield & 0b00000010) == 0b00000010);
+
+	return {
+		radio_unique_identifier,
+		max_supported_tx_spatial_streams,
+		max_supported_tx_spatial_streams_name: defs.MAX_SUPPORTED_TX_SPATIAL_STREAMS[max_supported_tx_spatial_streams],
+		max_supported_rx_spatial_streams,
+		max_supported_rx_spatial_streams_name: defs.MAX_SUPPORTED_RX_SPATIAL_STREAMS[max_supported_rx_spatial_streams],
+		short_gi_support_20mhz,
+		short_gi_support_40mhz,
+		ht_support_40mhz,
+	};
+};
+
+// 0x87 - AP VHT Capabilities
+// Wi-Fi EasyMesh
+decoder[0x87] = (buf, end) => {
+	if (buf.pos() + 12 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const supported_vht_tx_mcs = buf.get('!H');
+	const supported_vht_rx_mcs = buf.get('!H');
+
+	const bitfield = buf.get('B');
+	const max_supported_tx_spatial_streams = (bitfield >> 5) & 0b00000111;
+	const max_supported_rx_spatial_streams = (bitfield >> 2) & 0b00000111;
+	const short_gi_support_80mhz = ((bitfield & 0b00000010) == 0b00000010);
+	const short_gi_support_160mhz_8080mhz = ((bitfield & 0b00000001) == 0b00000001);
+
+	const bitfield2 = buf.get('B');
+	const vht_support_8080mhz = ((bitfield2 & 0b10000000) == 0b10000000);
+	const vht_support_160mhz = ((bitfield2 & 0b01000000) == 0b01000000);
+	const su_beamformer_capable = ((bitfield2 & 0b00100000) == 0b00100000);
+	const mu_beamformer_capable = ((bitfield2 & 0b00010000) == 0b00010000);
+
+	return {
+		radio_unique_identifier,
+		supported_vht_tx_mcs,
+		supported_vht_rx_mcs,
+		max_supported_tx_spatial_streams,
+		max_supported_tx_spatial_streams_name: defs.MAX_SUPPORTED_TX_SPATIAL_STREAMS[max_supported_tx_spatial_streams],
+		max_supported_rx_spatial_streams,
+		max_supported_rx_spatial_streams_name: defs.MAX_SUPPORTED_RX_SPATIAL_STREAMS[max_supported_rx_spatial_streams],
+		short_gi_support_80mhz,
+		short_gi_support_160mhz_8080mhz,
+		vht_support_8080mhz,
+		vht_support_160mhz,
+		su_beamformer_capable,
+		mu_beamformer_capable,
+	};
+};
+
+// 0x88 - AP HE Capabilities
+// Wi-Fi EasyMesh
+decoder[0x88] = (buf, end) => {
+	if (buf.pos() + 9 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const supported_he_mcs_length = buf.get('B');
+
+	if (buf.pos() + supported_he_mcs_length > end)
+		return null;
+
+	const supported_he_mcs = buf.get(supported_he_mcs_length);
+
+	const bitfield = buf.get('B');
+	const max_supported_tx_spatial_streams = (bitfield >> 5) & 0b00000111;
+	const max_supported_rx_spatial_streams = (bitfield >> 2) & 0b00000111;
+	const he_support_8080mhz = ((bitfield & 0b00000010) == 0b00000010);
+	const he_support_160mhz = ((bitfield & 0b00000001) == 0b00000001);
+
+	const bitfield2 = buf.get('B');
+	const su_beamformer_capable = ((bitfield2 & 0b10000000) == 0b10000000);
+	const mu_beamformer_capable = ((bitfield2 & 0b01000000) == 0b01000000);
+	const ul_mu_mimo_capable = ((bitfield2 & 0b00100000) == 0b00100000);
+	const ul_mu_mimo_ofdma_capable = ((bitfield2 & 0b00010000) == 0b00010000);
+	const dl_mu_mimo_ofdma_capable = ((bitfield2 & 0b00001000) == 0b00001000);
+	const ul_ofdma_capable = ((bitfield2 & 0b00000100) == 0b00000100);
+	const dl_ofdma_capable = ((bitfield2 & 0b00000010) == 0b00000010);
+
+	return {
+		radio_unique_identifier,
+		supported_he_mcs,
+		max_supported_tx_spatial_streams,
+		max_supported_tx_spatial_streams_name: defs.MAX_SUPPORTED_TX_SPATIAL_STREAMS[max_supported_tx_spatial_streams],
+		max_supported_rx_spatial_streams,
+		max_supported_rx_spatial_streams_name: defs.MAX_SUPPORTED_RX_SPATIAL_STREAMS[max_supported_rx_spatial_streams],
+		he_support_8080mhz,
+		he_support_160mhz,
+		su_beamformer_capable,
+		mu_beamformer_capable,
+		ul_mu_mimo_capable,
+		ul_mu_mimo_ofdma_capable,
+		dl_mu_mimo_ofdma_capable,
+		ul_ofdma_capable,
+		dl_ofdma_capable,
+	};
+};
+
+// 0x89 - Steering Policy
+// Wi-Fi EasyMesh
+decoder[0x89] = (buf, end) => {
+	if (buf.pos() + 3 > end)
+		return null;
+
+	const local_steering_disallowed_sta_count = buf.get('B');
+	const local_steering_disallowed_sta = [];
+
+	for (let h = 0; h < local_steering_disallowed_sta_count; h++) {
+		if (buf.pos() + 6 > end)
+			return null;
+
+		const sta_mac_address = ether_ntoa(buf.get('6s'));
+
+		push(local_steering_disallowed_sta, sta_mac_address);
+	}
+
+	const btm_steering_disallowed_sta_count = buf.get('B');
+	const btm_steering_disallowed_sta = [];
+
+	for (let h = 0; h < btm_steering_disallowed_sta_count; h++) {
+		if (buf.pos() + 6 > end)
+			return null;
+
+		const sta_mac_address = ether_ntoa(buf.get('6s'));
+
+		push(btm_steering_disallowed_sta, sta_mac_address);
+	}
+
+	const radios_count = buf.get('B');
+	const radios = [];
+
+	for (let h = 0; h < radios_count; h++) {
+		if (buf.pos() + 9 > end)
+			return null;
+
+		const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+		const steering_policy = buf.get('B');
+
+		if (!exists(defs.STEERING_POLICY, steering_policy))
+			return null;
+
+		const channel_utilization_threshold = buf.get('B');
+		const rcpi_steering_threshold = buf.get('B');
+
+		if (rcpi_steering_threshold > 0xdc)
+			return null;
+
+		push(radios, {
+			radio_unique_identifier,
+			steering_policy,
+			steering_policy_name: defs.STEERING_POLICY[steering_policy],
+			channel_utilization_threshold,
+			rcpi_steering_threshold,
+		});
+	}
+
+	return {
+		local_steering_disallowed_sta,
+		btm_steering_disallowed_sta,
+		radios,
+	};
+};
+
+// 0x8a - Metric Reporting Policy
+// Wi-Fi EasyMesh
+decoder[0x8a] = (buf, end) => {
+	if (buf.pos() + 2 > end)
+		return null;
+
+	const ap_metrics_reporting_interval = buf.get('B');
+
+	if (ap_metrics_reporting_interval > 0xff)
+		return null;
+
+	const radios_count = buf.get('B');
+	const radios = [];
+
+	for (let h = 0; h < radios_count; h++) {
+		if (buf.pos() + 10 > end)
+			return null;
+
+		const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+		const sta_metrics_reporting_rcpi_threshold = buf.get('B');
+
+		if (sta_metrics_reporting_rcpi_threshold > 0xdc)
+			return null;
+
+		const sta_metrics_reporting_rcpi_hysteresis_margin_override = buf.get('B');
+		const ap_metrics_channel_utilization_reporting_threshold = buf.get('B');
+
+		const bitfield = buf.get('B');
+		const associated_sta_traffic_stats_inclusion_policy = ((bitfield & 0b10000000) == 0b10000000);
+		const associated_sta_link_metrics_inclusion_policy = ((bitfield & 0b01000000) == 0b01000000);
+		const associated_wifi6_sta_status_inclusion_policy = ((bitfield & 0b00100000) == 0b00100000);
+
+		push(radios, {
+			radio_unique_identifier,
+			sta_metrics_reporting_rcpi_threshold,
+			sta_metrics_reporting_rcpi_hysteresis_margin_override,
+			ap_metrics_channel_utilization_reporting_threshold,
+			associated_sta_traffic_stats_inclusion_policy,
+			associated_sta_link_metrics_inclusion_policy,
+			associated_wifi6_sta_status_inclusion_policy,
+		});
+	}
+
+	return {
+		ap_metrics_reporting_interval,
+		radios,
+	};
+};
+
+// 0x8b - Channel Preference
+// Wi-Fi EasyMesh
+decoder[0x8b] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const opclass_count = buf.get('B');
+	const opclasses = [];
+
+	for (let h = 0; h < opclass_count; h++) {
+		if (buf.pos() + 3 > end)
+			return null;
+
+		const opclass = buf.get('B');
+		const channels_count = buf.get('B');
+		const channels = [];
+
+		for (let i = 0; i < channels_count; i++) {
+			if (buf.pos() + 1 > end)
+				return null;
+
+			push(channels, buf.get('B'));
+		}
+
+		const bitfield = buf.get('B');
+		const preference = (bitfield >> 4) & 0b00001111;
+		const reason_code = bitfield & 0b00001111;
+
+		push(opclasses, {
+			opclass,
+			channels,
+			preference,
+			reason_code,
+			reason_code_name: defs.CHANNEL_PREFERENCE_REASON_CODE[reason_code],
+		});
+	}
+
+	return {
+		radio_unique_identifier,
+		opclasses,
+	};
+};
+
+// 0x8c - Radio Operation Restriction
+// Wi-Fi EasyMesh
+decoder[0x8c] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const opclass_count = buf.get('B');
+	const opclasses = [];
+
+	for (let h = 0; h < opclass_count; h++) {
+		if (buf.pos() + 2 > end)
+			return null;
+
+		const opclass = buf.get('B');
+		const channels_count = buf.get('B');
+		const channels = [];
+
+		for (let i = 0; i < channels_count; i++) {
+			if (buf.pos() + 2 > end)
+				return null;
+
+			const channel = buf.get('B');
+			const minimum_frequency_separation = buf.get('B');
+
+			push(channels, {
+				channel,
+				minimum_frequency_separation,
+			});
+		}
+
+		push(opclasses, {
+			opclass,
+			channels,
+		});
+	}
+
+	return {
+		radio_unique_identifier,
+		opclasses,
+	};
+};
+
+// 0x8d - Transmit Power Limit
+// Wi-Fi EasyMesh
+decoder[0x8d] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const txpower_limit_eirp = buf.get('B');
+
+	return {
+		radio_unique_identifier,
+		txpower_limit_eirp,
+	};
+};
+
+// 0x8e - Channel Selection Response
+// Wi-Fi EasyMesh
+decoder[0x8e] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const channel_selection_response_code = buf.get('B');
+
+	if (!exists(defs.CHANNEL_SELECTION_RESPONSE_CODE, channel_selection_response_code))
+		return null;
+
+	return {
+		radio_unique_identifier,
+		channel_selection_response_code,
+		channel_selection_response_code_name: defs.CHANNEL_SELECTION_RESPONSE_CODE[channel_selection_response_code],
+	};
+};
+
+// 0x8f - Operating Channel Report
+// Wi-Fi EasyMesh
+decoder[0x8f] = (buf, end) => {
+	if (buf.pos() + 8 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const current_opclass_count = buf.get('B');
+	const current_opclasses = [];
+
+	for (let h = 0; h < current_opclass_count; h++) {
+		if (buf.pos() + 2 > end)
+			return null;
+
+		const opclass = buf.get('B');
+		const current_operating_channel = buf.get('B');
+
+		push(current_opclasses, {
+			opclass,
+			current_operating_channel,
+		});
+	}
+
+	const current_txpower_eirp = buf.get('B');
+
+	return {
+		radio_unique_identifier,
+		current_opclasses,
+		current_txpower_eirp,
+	};
+};
+
+// 0x90 - Client Info
+// Wi-Fi EasyMesh
+decoder[0x90] = (buf, end) => {
+	if (buf.pos() + 12 > end)
+		return null;
+
+	const bssid = ether_ntoa(buf.get('6s'));
+	const mac_address = ether_ntoa(buf.get('6s'));
+
+	return {
+		bssid,
+		mac_address,
+	};
+};
+
+// 0x91 - Client Capability Report
+// Wi-Fi EasyMesh
+decoder[0x91] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const result_code = buf.get('B');
+
+	if (!exists(defs.RESULT_CODE, result_code))
+		return null;
+
+	let frame_body = null;
+
+	if (result_code == 0) {
+		frame_body = buf.get('Z');
+	}
+
+	return {
+		result_code,
+		result_code_name: defs.RESULT_CODE[result_code],
+		frame_body,
+	};
+};
+
+// 0x92 - Client Association Event
+// Wi-Fi EasyMesh
+decoder[0x92] = (buf, end) => {
+	if (buf.pos() + 13 > end)
+		return null;
+
+	const mac_address = ether_ntoa(buf.get('6s'));
+	const bssid = ether_ntoa(buf.get('6s'));
+
+	const bitfield = buf.get('B');
+	const association_event = ((bitfield & 0b10000000) == 0b10000000);
+
+	return {
+		mac_address,
+		bssid,
+		association_event,
+	};
+};
+
+// 0x93 - AP Metric Query
+// Wi-Fi EasyMesh
+decoder[0x93] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const bssids_count = buf.get('B');
+	const bssids = [];
+
+	for (let h = 0; h < bssids_count; h++) {
+		if (buf.pos() + 6 > end)
+			return null;
+
+		const bssid = ether_ntoa(buf.get('6s'));
+
+		push(bssids, bssid);
+	}
+
+	return bssids;
+};
+
+// 0x94 - AP Metrics
+// Wi-Fi EasyMesh
+decoder[0x94] = (buf, end) => {
+	if (buf.pos() + 10 > end)
+		return null;
+
+	const bssid = ether_ntoa(buf.get('6s'));
+	const channel_utilization = buf.get('B');
+	const sta_count = buf.get('!H');
+
+	const bitfield = buf.get('B');
+	const include_esp_be = ((bitfield & 0b10000000) == 0b10000000);
+	const include_esp_bk = ((bitfield & 0b01000000) == 0b01000000);
+	const include_esp_vo = ((bitfield & 0b00100000) == 0b00100000);
+	const include_esp_vi = ((bitfield & 0b00010000) == 0b00010000);
+
+	let esp_be = null;
+
+	if (include_esp_be == 1) {
+		esp_be = buf.get(3);
+	}
+
+	let esp_bk = null;
+
+	if (include_esp_bk == 1) {
+		esp_bk = buf.get(3);
+	}
+
+	let esp_vo = null;
+
+	if (include_esp_vo == 1) {
+		esp_vo = buf.get(3);
+	}
+
+	let esp_vi = null;
+
+	if (include_esp_vi == 1) {
+		esp_vi = buf.get(3);
+	}
+
+	return {
+		bssid,
+		channel_utilization,
+		sta_count,
+		include_esp_be,
+		include_esp_bk,
+		include_esp_vo,
+		include_esp_vi,
+		esp_be,
+		esp_bk,
+		esp_vo,
+		esp_vi,
+	};
+};
+
+// 0x95 - STA MAC Address Type
+// Wi-Fi EasyMesh
+decoder[0x95] = (buf, end) => {
+	if (buf.pos() + 6 > end)
+		return null;
+
+	const mac_address = ether_ntoa(buf.get('6s'));
+
+	return mac_address;
+};
+
+// 0x96 - Associated STA Link Metrics
+// Wi-Fi EasyMesh
+decoder[0x96] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const mac_address = ether_ntoa(buf.get('6s'));
+	const bssids_count = buf.get('B');
+	const bssids = [];
+
+	for (let h = 0; h < bssids_count; h++) {
+		if (buf.pos() + 19 > end)
+			return null;
+
+		const bssid = ether_ntoa(buf.get('6s'));
+		const time_delta = buf.get('!L');
+		const estimated_downlink_mac_data_rate = buf.get('!L');
+		const estimated_uplink_mac_data_rate = buf.get('!L');
+		const uplink_rcpi = buf.get('B');
+
+		if (uplink_rcpi > 0xdc)
+			return null;
+
+		push(bssids, {
+			bssid,
+			time_delta,
+			estimated_downlink_mac_data_rate,
+			estimated_uplink_mac_data_rate,
+			uplink_rcpi,
+		});
+	}
+
+	return {
+		mac_address,
+		bssids,
+	};
+};
+
+// 0x97 - Unassociated STA Link Metrics Query
+// Wi-Fi EasyMesh
+decoder[0x97] = (buf, end) => {
+	if (buf.pos() + 2 > end)
+		return null;
+
+	const opclass = buf.get('B');
+	const channels_count = buf.get('B');
+	const channels = [];
+
+	for (let h = 0; h < channels_count; h++) {
+		if (buf.pos() + 2 > end)
+			return null;
+
+		const channel = buf.get('B');
+		const sta_mac_addresses_count = buf.get('B');
+		const sta_mac_addresses = [];
+
+		for (let i = 0; i < sta_mac_addresses_count; i++) {
+			if (buf.pos() + 6 > end)
+				return null;
+
+			const sta_mac_address = ether_ntoa(buf.get('6s'));
+
+			push(sta_mac_addresses, sta_mac_address);
+		}
+
+		push(channels, {
+			channel,
+			sta_mac_addresses,
+		});
+	}
+
+	return {
+		opclass,
+		channels,
+	};
+};
+
+// 0x98 - Unassociated STA Link Metrics Response
+// Wi-Fi EasyMesh
+decoder[0x98] = (buf, end) => {
+	if (buf.pos() + 2 > end)
+		return null;
+
+	const opclass = buf.get('B');
+	const sta_entries_count = buf.get('B');
+	const sta_entries = [];
+
+	for (let h = 0; h < sta_entries_count; h++) {
+		if (buf.pos() + 12 > end)
+			return null;
+
+		const mac_address = ether_ntoa(buf.get('6s'));
+		const channel = buf.get('B');
+		const time_delta = buf.get('!L');
+		const uplink_rcpi = buf.get('B');
+
+		if (uplink_rcpi > 0xdc)
+			return null;
+
+		push(sta_entries, {
+			mac_address,
+			channel,
+			time_delta,
+			uplink_rcpi,
+		});
+	}
+
+	return {
+		opclass,
+		sta_entries,
+	};
+};
+
+// 0x99 - Beacon Metrics Query
+// Wi-Fi EasyMesh
+decoder[0x99] = (buf, end) => {
+	if (buf.pos() + 18 > end)
+		return null;
+
+	const mac_address = ether_ntoa(buf.get('6s'));
+	const opclass = buf.get('B');
+	const channel = buf.get('B');
+	const bssid = ether_ntoa(buf.get('6s'));
+	const reporting_detail_value = buf.get('B');
+	const ssid_length = buf.get('B');
+
+	if (buf.pos() + ssid_length > end)
+		return null;
+
+	const ssid = buf.get(ssid_length);
+	const ap_channel_reports_count = buf.get('B');
+	const ap_channel_reports = [];
+
+	for (let h = 0; h < ap_channel_reports_count; h++) {
+		if (buf.pos() + 1 > end)
+			return null;
+
+		const ap_channel_report_length = buf.get('B');
+		const opclass = buf.get('B');
+		const channels = [];
+
+		for (let i = 0; i < ap_channel_report_length; i++) {
+			if (buf.pos() + 1 > end)
+				return null;
+
+			push(channels, buf.get('B'));
+		}
+
+		push(ap_channel_reports, {
+			opclass,
+			channels,
+		});
+	}
+
+	const element_ids_count = buf.get('B');
+	const element_list = [];
+
+	for (let h = 0; h < element_ids_count; h++) {
+		if (buf.pos() + 1 > end)
+			return null;
+
+		push(element_list, buf.get('B'));
+	}
+
+	return {
+		mac_address,
+		opclass,
+		channel,
+		bssid,
+		reporting_detail_value,
+		ssid,
+		ap_channel_reports,
+		element_list,
+	};
+};
+
+// 0x9a - Beacon Metrics Response
+// Wi-Fi EasyMesh
+decoder[0x9a] = (buf, end) => {
+	if (buf.pos() + 8 > end)
+		return null;
+
+	const mac_address = ether_ntoa(buf.get('6s'));
+
+	buf.get(1);
+
+	const measurement_report_elements_count = buf.get('B');
+	const measurement_report_elements = [];
+
+	for (let h = 0; h < measurement_report_elements_count; h++) {
+		if (buf.pos() + 2 > end)
+			return null;
+
+		const id = buf.get('B');
+		const length = buf.get('B');
+		const token = buf.get('B');
+		const report_mode = buf.get('B');
+		const type = buf.get('B');
+
+		if (buf.pos() + length - 3 > end)
+			return null;
+
+		const report_data = buf.get(length - 3);
+
+		push(measurement_report_elements, {
+			id,
+			token,
+			report_mode,
+			type,
+			report_data,
+		});
+	}
+
+	return {
+		mac_address,
+		measurement_report_elements,
+	};
+};
+
+// 0x9b - Steering Request
+// Wi-Fi EasyMesh
+decoder[0x9b] = (buf, end) => {
+	if (buf.pos() + 13 > end)
+		return null;
+
+	const bssid = ether_ntoa(buf.get('6s'));
+
+	const bitfield = buf.get('B');
+	const request_mode = ((bitfield & 0b10000000) == 0b10000000);
+	const btm_disassociation_imminent_bit = ((bitfield & 0b01000000) == 0b01000000);
+	const btm_abridged_bit = ((bitfield & 0b00100000) == 0b00100000);
+
+	const steering_opportunity_window = buf.get('!H');
+	const btm_disassociation_timer = buf.get('!H');
+	const sta_list_count = buf.get('B');
+	const sta_list = [];
+
+	for (let h = 0; h < sta_list_count; h++) {
+		if (buf.pos() + 6 > end)
+			return null;
+
+		const sta_mac_address = ether_ntoa(buf.get('6s'));
+
+		push(sta_list, sta_mac_address);
+	}
+
+	const target_bssid_list_count = buf.get('B');
+	const target_bssid_list = [];
+
+	for (let h = 0; h < target_bssid_list_count; h++) {
+		if (buf.pos() + 8 > end)
+			return null;
+
+		const target_bssid = ether_ntoa(buf.get('6s'));
+		const target_bss_opclass = buf.get('B');
+		const target_bss_channel = buf.get('B');
+
+		push(target_bssid_list, {
+			target_bssid,
+			target_bss_opclass,
+			target_bss_channel,
+		});
+	}
+
+	return {
+		bssid,
+		request_mode,
+		btm_disassociation_imminent_bit,
+		btm_abridged_bit,
+		steering_opportunity_window,
+		btm_disassociation_timer,
+		sta_list,
+		target_bssid_list,
+	};
+};
+
+// 0x9c - Steering BTM Report
+// Wi-Fi EasyMesh
+decoder[0x9c] = (buf, end) => {
+	if (buf.pos() + 13 > end)
+		return null;
+
+	const bssid = ether_ntoa(buf.get('6s'));
+	const sta_mac_address = ether_ntoa(buf.get('6s'));
+	const btm_status_code = buf.get('B');
+	const target_bssid = ether_ntoa(buf.get('6s'));
+
+	return {
+		bssid,
+		sta_mac_address,
+		btm_status_code,
+		target_bssid,
+	};
+};
+
+// 0x9d - Client Association Control Request
+// Wi-Fi EasyMesh
+decoder[0x9d] = (buf, end) => {
+	if (buf.pos() + 10 > end)
+		return null;
+
+	const bssid = ether_ntoa(buf.get('6s'));
+	const association_control = buf.get('B');
+
+	if (!exists(defs.ASSOCIATION_CONTROL, association_control))
+		return null;
+
+	const validity_period = buf.get('!H');
+	const sta_list_count = buf.get('B');
+	const sta_list = [];
+
+	for (let h = 0; h < sta_list_count; h++) {
+		if (buf.pos() + 6 > end)
+			return null;
+
+		const sta_mac_address = ether_ntoa(buf.get('6s'));
+
+		push(sta_list, sta_mac_address);
+	}
+
+	return {
+		bssid,
+		association_control,
+		association_control_name: defs.ASSOCIATION_CONTROL[association_control],
+		validity_period,
+		sta_list,
+	};
+};
+
+// 0x9e - Backhaul Steering Request
+// Wi-Fi EasyMesh
+decoder[0x9e] = (buf, end) => {
+	if (buf.pos() + 14 > end)
+		return null;
+
+	const mac_address = ether_ntoa(buf.get('6s'));
+	const bssid = ether_ntoa(buf.get('6s'));
+	const opclass = buf.get('B');
+	const channel = buf.get('B');
+
+	return {
+		mac_address,
+		bssid,
+		opclass,
+		channel,
+	};
+};
+
+// 0x9f - Backhaul Steering Response
+// Wi-Fi EasyMesh
+decoder[0x9f] = (buf, end) => {
+	if (buf.pos() + 13 > end)
+		return null;
+
+	const mac_address = ether_ntoa(buf.get('6s'));
+	const bssid = ether_ntoa(buf.get('6s'));
+	const result_code = buf.get('B');
+
+	if (!exists(defs.RESULT_CODE, result_code))
+		return null;
+
+	return {
+		mac_address,
+		bssid,
+		result_code,
+		result_code_name: defs.RESULT_CODE[result_code],
+	};
+};
+
+// 0xa0 - Higher Layer Data
+// Wi-Fi EasyMesh
+decoder[0xa0] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const protocol = buf.get('B');
+	const data = buf.get('*');
+
+	return {
+		protocol,
+		data,
+	};
+};
+
+// 0xa1 - AP Capability
+// Wi-Fi EasyMesh
+decoder[0xa1] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const bitfield = buf.get('B');
+	const onchannel_unassoc_sta_metrics = ((bitfield & 0b10000000) == 0b10000000);
+	const offchannel_unassoc_sta_metrics = ((bitfield & 0b01000000) == 0b01000000);
+	const agent_initiated_rcpi_steering = ((bitfield & 0b00100000) == 0b00100000);
+
+	return {
+		onchannel_unassoc_sta_metrics,
+		offchannel_unassoc_sta_metrics,
+		agent_initiated_rcpi_steering,
+	};
+};
+
+// 0xa2 - Associated STA Traffic Stats
+// Wi-Fi EasyMesh
+decoder[0xa2] = (buf, end) => {
+	if (buf.pos() + 34 > end)
+		return null;
+
+	const mac_address = ether_ntoa(buf.get('6s'));
+	const bytes_sent = buf.get('!L');
+	const bytes_received = buf.get('!L');
+	const packets_sent = buf.get('!L');
+	const packets_received = buf.get('!L');
+	const tx_packets_errors = buf.get('!L');
+	const rx_packets_errors = buf.get('!L');
+	const retransmission_count = buf.get('!L');
+
+	return {
+		mac_address,
+		bytes_sent,
+		bytes_received,
+		packets_sent,
+		packets_received,
+		tx_packets_errors,
+		rx_packets_errors,
+		retransmission_count,
+	};
+};
+
+// 0xa3 - Error Code
+// Wi-Fi EasyMesh
+decoder[0xa3] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const reason_code = buf.get('B');
+
+	if (!exists(defs.REASON_CODE, reason_code))
+		return null;
+
+	const mac_address = ether_ntoa(buf.get('6s'));
+
+	return {
+		reason_code,
+		reason_code_name: defs.REASON_CODE[reason_code],
+		mac_address,
+	};
+};
+
+return { encoder, decoder, extended_encoder, extended_decoder };
@@ -0,0 +1,2101 @@
+import { ether_ntoa, ether_aton } from 'umap.core';
+import defs from 'umap.defs';
+
+const encoder = [];
+const decoder = [];
+const extended_encoder = [];
+const extended_decoder = [];
+
+// -----------------------------------------------------------------------------
+// TLV ENCODER ROUTINES
+// -----------------------------------------------------------------------------
+
+// 0xa4 - Channel Scan Reporting Policy
+// Wi-Fi EasyMesh
+encoder[0xa4] = (buf, report_independent_channel_scans) => {
+
+	buf.put('B', 0
+		| (report_independent_channel_scans << 7)
+	);
+
+	return buf;
+};
+
+// 0xa5 - Channel Scan Capabilities
+// Wi-Fi EasyMesh
+encoder[0xa5] = (buf, radios) => {
+	if (type(radios) != "array" || length(radios) > 0xff)
+		return null;
+
+	buf.put('B', length(radios));
+
+	for (let item in radios) {
+		if (type(item) != "object")
+			return null;
+
+		const radio_unique_identifier = ether_aton(item.radio_unique_identifier);
+
+		if (radio_unique_identifier == null)
+			return null;
+
+		if (!(item.scan_impact in [ 0x00, 0x01, 0x02, 0x03 ]))
+			return null;
+
+		if (type(item.minimum_scan_interval) != "int" || item.minimum_scan_interval < 0 || item.minimum_scan_interval > 0xffffffff)
+			return null;
+
+		if (type(item.opclasses) != "array" || length(item.opclasses) > 0xff)
+			return null;
+
+		buf.put('6s', radio_unique_identifier);
+		buf.put('B', 0
+			| (item.on_boot_only << 7)
+			| ((item.scan_impact & 0b00000011) << 5)
+		);
+
+		buf.put('!L', item.minimum_scan_interval);
+		buf.put('B', length(item.opclasses));
+
+		for (let item2 in item.opclasses) {
+			if (type(item2) != "object")
+				return null;
+
+			if (type(item2.opclass) != "int" || item2.opclass < 0 || item2.opclass > 0xff)
+				return null;
+
+			if (type(item2.channels) != "array")
+				return null;
+
+			buf.put('B', item2.opclass);
+			buf.put('B', length(item2.channels));
+
+			for (let item3 in item2.channels) {
+				if (type(item3) != "int" || item3 < 0 || item3 > 0xff)
+					return null;
+
+				buf.put('B', item3);
+			}
+		}
+	}
+
+	return buf;
+};
+
+// 0xa6 - Channel Scan Request
+// Wi-Fi EasyMesh
+encoder[0xa6] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.radios) != "array" || length(tlv.radios) > 0xff)
+		return null;
+
+	buf.put('B', 0
+		| (tlv.perform_fresh_scan << 7)
+	);
+
+	buf.put('B', length(tlv.radios));
+
+	for (let item in tlv.radios) {
+		if (type(item) != "object")
+			return null;
+
+		const radio_unique_identifier = ether_aton(item.radio_unique_identifier);
+
+		if (radio_unique_identifier == null)
+			return null;
+
+		if (type(item.opclasses) != "array" || length(item.opclasses) > 0xff)
+			return null;
+
+		buf.put('6s', radio_unique_identifier);
+		buf.put('B', length(item.opclasses));
+
+		for (let item2 in item.opclasses) {
+			if (type(item2) != "object")
+				return null;
+
+			if (type(item2.opclass) != "int" || item2.opclass < 0 || item2.opclass > 0xff)
+				return null;
+
+			if (type(item2.channels) != "array")
+				return null;
+
+			buf.put('B', item2.opclass);
+			buf.put('B', length(item2.channels));
+
+			for (let item3 in item2.channels) {
+				if (type(item3) != "int" || item3 < 0 || item3 > 0xff)
+					return null;
+
+				buf.put('B', item3);
+			}
+		}
+	}
+
+	return buf;
+};
+
+// 0xa7 - Channel Scan Result
+// Wi-Fi EasyMesh
+encoder[0xa7] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (type(tlv.opclass) != "int" || tlv.opclass < 0 || tlv.opclass > 0xff)
+		return null;
+
+	if (type(tlv.channel) != "int" || tlv.channel < 0 || tlv.channel > 0xff)
+		return null;
+
+	if (!(tlv.scan_status in [ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 ]))
+		return null;
+
+	if (tlv.timestamp != null && (type(tlv.timestamp) != "string" || length(tlv.timestamp) > 0xff))
+		return null;
+
+	if (type(tlv.utilization) != "int" || tlv.utilization < 0 || tlv.utilization > 0xff)
+		return null;
+
+	if (type(tlv.noise) != "int" || tlv.noise < 0 || tlv.noise > 0xff)
+		return null;
+
+	if (type(tlv.neighbors) != "array" || length(tlv.neighbors) > 0xffff)
+		return null;
+
+	if (type(tlv.aggregate_scan_duration) != "int" || tlv.aggregate_scan_duration < 0 || tlv.aggregate_scan_duration > 0xffffffff)
+		return null;
+
+	tlv.scan_status ??= (tlv.timestamp != null) && 0;
+	tlv.scan_status ??= (tlv.utilization != null) && 0;
+	tlv.scan_status ??= (tlv.noise != null) && 0;
+	tlv.scan_status ??= (tlv.neighbors != null) && 0;
+	tlv.scan_status ??= (tlv.aggregate_scan_duration != null) && 0;
+	tlv.scan_status ??= (tlv.active_scan != null) && 0;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', tlv.opclass);
+	buf.put('B', tlv.channel);
+	buf.put('B', tlv.scan_status);
+
+	if (tlv.scan_status == 0)
+		buf.put('B', length(tlv.timestamp));
+
+	if (tlv.scan_status == 0)
+		buf.put('*', tlv.timestamp);
+
+	if (tlv.scan_status == 0)
+		buf.put('B', tlv.utilization);
+
+	if (tlv.scan_status == 0)
+		buf.put('B', tlv.noise);
+
+	if (tlv.scan_status == 0)
+		buf.put('!H', length(tlv.neighbors));
+
+	if (tlv.scan_status == 0)
+		for (let item in tlv.neighbors) {
+			if (type(item) != "object")
+				return null;
+
+			const bssid = ether_aton(item.bssid);
+
+			if (bssid == null)
+				return null;
+
+			if (type(item.ssid) != "string" || length(item.ssid) > 0xff)
+				return null;
+
+			if (type(item.signal_strength) != "int" || item.signal_strength < 0 || item.signal_strength > 0xff)
+				return null;
+
+			if (type(item.channel_bandwidth) != "string" || length(item.channel_bandwidth) > 0xff)
+				return null;
+
+			if (type(item.bss_color) != "int" || item.bss_color < 0 || item.bss_color > 0)
+				return null;
+
+			if (type(item.channel_utilization) != "int" || item.channel_utilization < 0 || item.channel_utilization > 0xff)
+				return null;
+
+			if (type(item.station_count) != "int" || item.station_count < 0 || item.station_count > 0xffff)
+				return null;
+
+			buf.put('6s', bssid);
+			buf.put('B', length(item.ssid));
+			buf.put('*', item.ssid);
+			buf.put('B', item.signal_strength);
+			buf.put('B', length(item.channel_bandwidth));
+			buf.put('*', item.channel_bandwidth);
+			buf.put('B', 0
+				| (item.bss_load_element_present << 7)
+				| ((item.bss_color & 0b00111111) << 0)
+			);
+
+			buf.put('B', item.channel_utilization);
+			buf.put('!H', item.station_count);
+		}
+
+	if (tlv.scan_status == 0)
+		buf.put('!L', tlv.aggregate_scan_duration);
+
+	if (tlv.scan_status == 0)
+		buf.put('B', 0
+			| (tlv.active_scan << 7)
+		);
+
+	return buf;
+};
+
+// 0xa8 - Timestamp
+// Wi-Fi EasyMesh
+encoder[0xa8] = (buf, timestamp) => {
+	if (type(timestamp) != "string" || length(timestamp) > 0xff)
+		return null;
+
+	buf.put('B', length(timestamp));
+	buf.put('*', timestamp);
+
+	return buf;
+};
+
+// 0xad - CAC Request
+// Wi-Fi EasyMesh
+encoder[0xad] = (buf, radios) => {
+	if (type(radios) != "array" || length(radios) > 0xff)
+		return null;
+
+	buf.put('B', length(radios));
+
+	for (let item in radios) {
+		if (type(item) != "object")
+			return null;
+
+		const radio_unique_identifier = ether_aton(item.radio_unique_identifier);
+
+		if (radio_unique_identifier == null)
+			return null;
+
+		if (type(item.opclass) != "int" || item.opclass < 0 || item.opclass > 0xff)
+			return null;
+
+		if (type(item.channel) != "int" || item.channel < 0 || item.channel > 0xff)
+			return null;
+
+		if (type(item.cac_method) != "int" || item.cac_method < 0 || item.cac_method > 0b00000111)
+			return null;
+
+		if (type(item.cac_completion_action) != "int" || item.cac_completion_action < 0 || item.cac_completion_action > 0b00000011)
+			return null;
+
+		buf.put('6s', radio_unique_identifier);
+		buf.put('B', item.opclass);
+		buf.put('B', item.channel);
+		buf.put('B', 0
+			| ((item.cac_method & 0b00000111) << 5)
+			| ((item.cac_completion_action & 0b00000011) << 3)
+		);
+	}
+
+	return buf;
+};
+
+// 0xae - CAC Termination
+// Wi-Fi EasyMesh
+encoder[0xae] = (buf, radios) => {
+	if (type(radios) != "array" || length(radios) > 0xff)
+		return null;
+
+	buf.put('B', length(radios));
+
+	for (let item in radios) {
+		if (type(item) != "object")
+			return null;
+
+		const radio_unique_identifier = ether_aton(item.radio_unique_identifier);
+
+		if (radio_unique_identifier == null)
+			return null;
+
+		if (type(item.opclass) != "int" || item.opclass < 0 || item.opclass > 0xff)
+			return null;
+
+		if (type(item.channel) != "int" || item.channel < 0 || item.channel > 0xff)
+			return null;
+
+		buf.put('6s', radio_unique_identifier);
+		buf.put('B', item.opclass);
+		buf.put('B', item.channel);
+	}
+
+	return buf;
+};
+
+// 0xaf - CAC Completion Report
+// Wi-Fi EasyMesh
+encoder[0xaf] = (buf, radios) => {
+	if (type(radios) != "array" || length(radios) > 0xff)
+		return null;
+
+	buf.put('B', length(radios));
+
+	for (let item in radios) {
+		if (type(item) != "object")
+			return null;
+
+		const radio_unique_identifier = ether_aton(item.radio_unique_identifier);
+
+		if (radio_unique_identifier == null)
+			return null;
+
+		if (type(item.opclass) != "int" || item.opclass < 0 || item.opclass > 0xff)
+			return null;
+
+		if (type(item.channel) != "int" || item.channel < 0 || item.channel > 0xff)
+			return null;
+
+		if (!(item.cac_completion_status in [ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 ]))
+			return null;
+
+		if (type(item.pairs) != "array" || length(item.pairs) > 0xff)
+			return null;
+
+		buf.put('6s', radio_unique_identifier);
+		buf.put('B', item.opclass);
+		buf.put('B', item.channel);
+		buf.put('B', item.cac_completion_status);
+		buf.put('B', length(item.pairs));
+
+		for (let item2 in item.pairs) {
+			if (type(item2) != "object")
+				return null;
+
+			if (type(item2.opclass_detected) != "int" || item2.opclass_detected < 0 || item2.opclass_detected > 0xff)
+				return null;
+
+			if (type(item2.channel_detected) != "int" || item2.channel_detected < 0 || item2.channel_detected > 0xff)
+				return null;
+
+			buf.put('B', item2.opclass_detected);
+			buf.put('B', item2.channel_detected);
+		}
+	}
+
+	return buf;
+};
+
+// 0xb1 - CAC Status Report
+// Wi-Fi EasyMesh
+encoder[0xb1] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.available_channels) != "array" || length(tlv.available_channels) > 0xff)
+		return null;
+
+	if (type(tlv.radar_detected_channels) != "array" || length(tlv.radar_detected_channels) > 0xff)
+		return null;
+
+	if (type(tlv.active_cac_channels) != "array" || length(tlv.active_cac_channels) > 0xff)
+		return null;
+
+	buf.put('B', length(tlv.available_channels));
+
+	for (let item in tlv.available_channels) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.opclass) != "int" || item.opclass < 0 || item.opclass > 0xff)
+			return null;
+
+		if (type(item.channel) != "int" || item.channel < 0 || item.channel > 0xff)
+			return null;
+
+		if (type(item.minutes) != "int" || item.minutes < 0 || item.minutes > 0xffff)
+			return null;
+
+		buf.put('B', item.opclass);
+		buf.put('B', item.channel);
+		buf.put('!H', item.minutes);
+	}
+
+	buf.put('B', length(tlv.radar_detected_channels));
+
+	for (let item in tlv.radar_detected_channels) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.opclass) != "int" || item.opclass < 0 || item.opclass > 0xff)
+			return null;
+
+		if (type(item.channel) != "int" || item.channel < 0 || item.channel > 0xff)
+			return null;
+
+		if (type(item.duration) != "int" || item.duration < 0 || item.duration > 0xffff)
+			return null;
+
+		buf.put('B', item.opclass);
+		buf.put('B', item.channel);
+		buf.put('!H', item.duration);
+	}
+
+	buf.put('B', length(tlv.active_cac_channels));
+
+	for (let item in tlv.active_cac_channels) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.opclass) != "int" || item.opclass < 0 || item.opclass > 0xff)
+			return null;
+
+		if (type(item.channel) != "int" || item.channel < 0 || item.channel > 0xff)
+			return null;
+
+		if (type(item.countdown) != "int" || item.countdown < 0 || item.countdown > 0xffffff)
+			return null;
+
+		buf.put('B', item.opclass);
+		buf.put('B', item.channel);
+		buf.put('!BH', item.countdown >> 16, item.countdown & 0xffff);
+	}
+
+	return buf;
+};
+
+// 0xb2 - CAC Capabilities
+// Wi-Fi EasyMesh
+encoder[0xb2] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.country_code) != "string" || length(tlv.country_code) > 2)
+		return null;
+
+	if (type(tlv.radios) != "array" || length(tlv.radios) > 0xff)
+		return null;
+
+	buf.put('2s', tlv.country_code);
+	buf.put('B', length(tlv.radios));
+
+	for (let item in tlv.radios) {
+		if (type(item) != "object")
+			return null;
+
+		const radio_unique_identifier = ether_aton(item.radio_unique_identifier);
+
+		if (radio_unique_identifier == null)
+			return null;
+
+		if (type(item.cac_types_supported) != "array" || length(item.cac_types_supported) > 0xff)
+			return null;
+
+		buf.put('6s', radio_unique_identifier);
+		buf.put('B', length(item.cac_types_supported));
+
+		for (let item2 in item.cac_types_supported) {
+			if (type(item2) != "object")
+				return null;
+
+			if (!(item2.cac_method_supported in [ 0x00, 0x01, 0x02, 0x03 ]))
+				return null;
+
+			if (type(item2.duration) != "int" || item2.duration < 0 || item2.duration > 0xffffff)
+				return null;
+
+			if (type(item2.opclasses) != "array" || length(item2.opclasses) > 0xff)
+				return null;
+
+			buf.put('B', item2.cac_method_supported);
+			buf.put('!BH', item2.duration >> 16, item2.duration & 0xffff);
+			buf.put('B', length(item2.opclasses));
+
+			for (let item3 in item2.opclasses) {
+				if (type(item3) != "object")
+					return null;
+
+				if (type(item3.opclass) != "int" || item3.opclass < 0 || item3.opclass > 0xff)
+					return null;
+
+				if (type(item3.channels) != "array" || length(item3.channels) > 0xff)
+					return null;
+
+				buf.put('B', item3.opclass);
+				buf.put('B', length(item3.channels));
+
+				for (let channel in item3.channels) {
+					if (type(channel) != "int" || channel < 0 || channel > 0xff)
+						return null;
+
+					buf.put('B', channel);
+				}
+			}
+		}
+	}
+
+	return buf;
+};
+
+// 0xb3 - Multi-AP Profile
+// Wi-Fi EasyMesh
+encoder[0xb3] = (buf, profile) => {
+	if (!(profile in [ 0x00, 0x01, 0x02, 0x03 ]))
+		return null;
+
+	buf.put('B', profile);
+
+	return buf;
+};
+
+// 0xb4 - Profile-2 AP Capability
+// Wi-Fi EasyMesh
+encoder[0xb4] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.max_prioritization_rules) != "int" || tlv.max_prioritization_rules < 0 || tlv.max_prioritization_rules > 0xff)
+		return null;
+
+	if (!(tlv.byte_counter_unit in [ 0x0, 0x1, 0x2 ]))
+		return null;
+
+	if (type(tlv.max_unique_vids) != "int" || tlv.max_unique_vids < 0 || tlv.max_unique_vids > 0xff)
+		return null;
+
+	buf.put('B', tlv.max_prioritization_rules);
+	buf.put('1x');
+	buf.put('B', 0
+		| ((tlv.byte_counter_unit & 0b00000011) << 6)
+		| (tlv.supports_prioritization << 5)
+		| (tlv.supports_dpp_onboarding << 4)
+		| (tlv.supports_traffic_separation << 3)
+	);
+
+	buf.put('B', tlv.max_unique_vids);
+
+	return buf;
+};
+
+// 0xb5 - Default 802.1Q Settings
+// Wi-Fi EasyMesh
+encoder[0xb5] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.primary_vlan_id) != "int" || tlv.primary_vlan_id < 0 || tlv.primary_vlan_id > 0xffff)
+		return null;
+
+	if (type(tlv.default_pcp) != "int" || tlv.default_pcp < 0 || tlv.default_pcp > 0b00000111)
+		return null;
+
+	buf.put('!H', tlv.primary_vlan_id);
+	buf.put('B', 0
+		| ((tlv.default_pcp & 0b00000111) << 5)
+	);
+
+	return buf;
+};
+
+// 0xb6 - Traffic Separation Policy
+// Wi-Fi EasyMesh
+encoder[0xb6] = (buf, ssids) => {
+	if (type(ssids) != "array" || length(ssids) > 0xff)
+		return null;
+
+	buf.put('B', length(ssids));
+
+	for (let item in ssids) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.ssid_name) != "string" || length(item.ssid_name) > 0xff)
+			return null;
+
+		if (type(item.vlan_id) != "int" || item.vlan_id < 0 || item.vlan_id > 0xffff)
+			return null;
+
+		buf.put('B', length(item.ssid_name));
+		buf.put('*', item.ssid_name);
+		buf.put('!H', item.vlan_id);
+	}
+
+	return buf;
+};
+
+// 0xb9 - Service Prioritization Rule
+// Wi-Fi EasyMesh
+encoder[0xb9] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.rule_id) != "int" || tlv.rule_id < 0 || tlv.rule_id > 0xffffffff)
+		return null;
+
+	if (type(tlv.precedence) != "int" || tlv.precedence < 0 || tlv.precedence > 0xff)
+		return null;
+
+	if (type(tlv.output) != "int" || tlv.output < 0 || tlv.output > 0xff)
+		return null;
+
+	buf.put('!L', tlv.rule_id);
+	buf.put('B', 0
+		| (tlv.add_remove << 7)
+	);
+
+	buf.put('B', tlv.precedence);
+	buf.put('B', tlv.output);
+	buf.put('B', 0
+		| (tlv.always_match << 7)
+	);
+
+	return buf;
+};
+
+// 0xba - DSCP Mapping Table
+// Wi-Fi EasyMesh
+encoder[0xba] = (buf, dscp_pcp_mapping) => {
+	if (type(dscp_pcp_mapping) != "array")
+		return null;
+
+	for (let pcp_value in dscp_pcp_mapping) {
+		if (type(pcp_value) != "int" || pcp_value < 0 || pcp_value > 0xff)
+			return null;
+
+		buf.put('B', pcp_value);
+	}
+
+	return buf;
+};
+
+// 0xbc - Profile-2 Error Code
+// Wi-Fi EasyMesh
+encoder[0xbc] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (!(tlv.reason_code in [ 0x01, 0x02, 0x03, 0x05, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0D ]))
+		return null;
+
+	let bssid = null;
+
+	if (tlv.bssid != null) {
+		bssid = ether_aton(tlv.bssid);
+
+		if (bssid == null)
+			return null;
+	}
+
+	if (type(tlv.service_prio_rule_id) != "int" || tlv.service_prio_rule_id < 0 || tlv.service_prio_rule_id > 0xffffffff)
+		return null;
+
+	if (type(tlv.qmid) != "int" || tlv.qmid < 0 || tlv.qmid > 0xffff)
+		return null;
+
+	tlv.reason_code ??= (bssid != null) && 7;
+	tlv.reason_code ??= (tlv.service_prio_rule_id != null) && 1;
+	tlv.reason_code ??= (tlv.qmid != null) && 11;
+
+	buf.put('B', tlv.reason_code);
+
+	if (tlv.reason_code in [ 7, 8 ])
+		buf.put('6s', bssid);
+
+	if (tlv.reason_code in [ 1, 2 ])
+		buf.put('!L', tlv.service_prio_rule_id);
+
+	if (tlv.reason_code == 11)
+		buf.put('!H', tlv.qmid);
+
+	return buf;
+};
+
+// 0xbe - AP Radio Advanced Capabilities
+// Wi-Fi EasyMesh
+encoder[0xbe] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', 0
+		| (tlv.combined_front_back << 7)
+		| (tlv.combined_profile1_profile2 << 6)
+		| (tlv.mscs << 5)
+		| (tlv.scs << 4)
+		| (tlv.qos_map << 3)
+		| (tlv.dscp_policy << 2)
+	);
+
+	return buf;
+};
+
+// 0xbf - Association Status Notification
+// Wi-Fi EasyMesh
+encoder[0xbf] = (buf, bssids) => {
+	if (type(bssids) != "array" || length(bssids) > 0xff)
+		return null;
+
+	buf.put('B', length(bssids));
+
+	for (let item in bssids) {
+		if (type(item) != "object")
+			return null;
+
+		const bssid = ether_aton(item.bssid);
+
+		if (bssid == null)
+			return null;
+
+		if (!(item.association_allowance_status in [ 0x00, 0x01 ]))
+			return null;
+
+		buf.put('6s', bssid);
+		buf.put('B', item.association_allowance_status);
+	}
+
+	return buf;
+};
+
+// 0xc0 - Source Info
+// Wi-Fi EasyMesh
+encoder[0xc0] = (buf, mac_address) => {
+	const _mac_address = ether_aton(mac_address);
+
+	if (_mac_address == null)
+		return null;
+
+	buf.put('6s', _mac_address);
+
+	return buf;
+};
+
+// 0xc1 - Tunneled message type
+// Wi-Fi EasyMesh
+encoder[0xc1] = (buf, tunneled_protocol_type) => {
+	if (!(tunneled_protocol_type in [ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 ]))
+		return null;
+
+	buf.put('B', tunneled_protocol_type);
+
+	return buf;
+};
+
+// 0xc2 - Tunneled
+// Wi-Fi EasyMesh
+encoder[0xc2] = (buf, payload) => buf.put('*', payload);
+
+// 0xc3 - Profile-2 Steering Request
+// Wi-Fi EasyMesh
+encoder[0xc3] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	if (type(tlv.steering_opportunity_window) != "int" || tlv.steering_opportunity_window < 0 || tlv.steering_opportunity_window > 0xffff)
+		return null;
+
+	if (type(tlv.btm_disassociation_timer) != "int" || tlv.btm_disassociation_timer < 0 || tlv.btm_disassociation_timer > 0xffff)
+		return null;
+
+	if (type(tlv.sta_list) != "array" || length(tlv.sta_list) > 0xff)
+		return null;
+
+	if (type(tlv.target_bssids) != "array" || length(tlv.target_bssids) > 0xff)
+		return null;
+
+	buf.put('6s', bssid);
+	buf.put('B', 0
+		| (tlv.request_mode << 7)
+		| (tlv.btm_disassociation_imminent_bit << 6)
+		| (tlv.btm_abridged_bit << 5)
+	);
+
+	buf.put('!H', tlv.steering_opportunity_window);
+	buf.put('!H', tlv.btm_disassociation_timer);
+	buf.put('B', length(tlv.sta_list));
+
+	for (let mac_address in tlv.sta_list) {
+		const _mac_address = ether_aton(mac_address);
+
+		if (_mac_address == null)
+			return null;
+
+		buf.put('6s', _mac_address);
+	}
+
+	buf.put('B', length(tlv.target_bssids));
+
+	for (let item in tlv.target_bssids) {
+		if (type(item) != "object")
+			return null;
+
+		const target_bssid = ether_aton(item.target_bssid);
+
+		if (target_bssid == null)
+			return null;
+
+		if (type(item.target_bss_opclass) != "int" || item.target_bss_opclass < 0 || item.target_bss_opclass > 0xff)
+			return null;
+
+		if (type(item.target_bss_channel) != "int" || item.target_bss_channel < 0 || item.target_bss_channel > 0xff)
+			return null;
+
+		if (type(item.reason_code) != "int" || item.reason_code < 0 || item.reason_code > 0xff)
+			return null;
+
+		buf.put('6s', target_bssid);
+		buf.put('B', item.target_bss_opclass);
+		buf.put('B', item.target_bss_channel);
+		buf.put('B', item.reason_code);
+	}
+
+	return buf;
+};
+
+// 0xc4 - Unsuccessful Association Policy
+// Wi-Fi EasyMesh
+encoder[0xc4] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.max_reporting_rate) != "int" || tlv.max_reporting_rate < 0 || tlv.max_reporting_rate > 0xffffffff)
+		return null;
+
+	buf.put('B', 0
+		| (tlv.report_unsuccessful_assocs << 7)
+	);
+
+	buf.put('!L', tlv.max_reporting_rate);
+
+	return buf;
+};
+
+// 0xc5 - Metric Collection Interval
+// Wi-Fi EasyMesh
+encoder[0xc5] = (buf, collection_interval) => {
+	if (type(collection_interval) != "int" || collection_interval < 0 || collection_interval > 0xffffffff)
+		return null;
+
+	buf.put('!L', collection_interval);
+
+	return buf;
+};
+
+// 0xc6 - Radio Metrics
+// Wi-Fi EasyMesh
+encoder[0xc6] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (type(tlv.noise) != "int" || tlv.noise < 0 || tlv.noise > 0xff)
+		return null;
+
+	if (type(tlv.transmit) != "int" || tlv.transmit < 0 || tlv.transmit > 0xff)
+		return null;
+
+	if (type(tlv.receive_self) != "int" || tlv.receive_self < 0 || tlv.receive_self > 0xff)
+		return null;
+
+	if (type(tlv.receive_other) != "int" || tlv.receive_other < 0 || tlv.receive_other > 0xff)
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', tlv.noise);
+	buf.put('B', tlv.transmit);
+	buf.put('B', tlv.receive_self);
+	buf.put('B', tlv.receive_other);
+
+	return buf;
+};
+
+// 0xc7 - AP Extended Metrics
+// Wi-Fi EasyMesh
+encoder[0xc7] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	if (type(tlv.unicast_bytes_sent) != "int" || tlv.unicast_bytes_sent < 0 || tlv.unicast_bytes_sent > 0xffffffff)
+		return null;
+
+	if (type(tlv.unicast_bytes_received) != "int" || tlv.unicast_bytes_received < 0 || tlv.unicast_bytes_received > 0xffffffff)
+		return null;
+
+	if (type(tlv.multicast_bytes_sent) != "int" || tlv.multicast_bytes_sent < 0 || tlv.multicast_bytes_sent > 0xffffffff)
+		return null;
+
+	if (type(tlv.multicast_bytes_received) != "int" || tlv.multicast_bytes_received < 0 || tlv.multicast_bytes_received > 0xffffffff)
+		return null;
+
+	if (type(tlv.broadcast_bytes_sent) != "int" || tlv.broadcast_bytes_sent < 0 || tlv.broadcast_bytes_sent > 0xffffffff)
+		return null;
+
+	if (type(tlv.broadcast_bytes_received) != "int" || tlv.broadcast_bytes_received < 0 || tlv.broadcast_bytes_received > 0xffffffff)
+		return null;
+
+	buf.put('6s', bssid);
+	buf.put('!L', tlv.unicast_bytes_sent);
+	buf.put('!L', tlv.unicast_bytes_received);
+	buf.put('!L', tlv.multicast_bytes_sent);
+	buf.put('!L', tlv.multicast_bytes_received);
+	buf.put('!L', tlv.broadcast_bytes_sent);
+	buf.put('!L', tlv.broadcast_bytes_received);
+
+	return buf;
+};
+
+// 0xc8 - Associated STA Extended Link Metrics
+// Wi-Fi EasyMesh
+encoder[0xc8] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const mac_address = ether_aton(tlv.mac_address);
+
+	if (mac_address == null)
+		return null;
+
+	if (type(tlv.bssids) != "array" || length(tlv.bssids) > 0xff)
+		return null;
+
+	buf.put('6s', mac_address);
+	buf.put('B', length(tlv.bssids));
+
+	for (let item in tlv.bssids) {
+		if (type(item) != "object")
+			return null;
+
+		const bssid = ether_aton(item.bssid);
+
+		if (bssid == null)
+			return null;
+
+		if (type(item.last_data_downlink_rate) != "int" || item.last_data_downlink_rate < 0 || item.last_data_downlink_rate > 0xffffffff)
+			return null;
+
+		if (type(item.last_data_uplink_rate) != "int" || item.last_data_uplink_rate < 0 || item.last_data_uplink_rate > 0xffffffff)
+			return null;
+
+		if (type(item.utilization_receive) != "int" || item.utilization_receive < 0 || item.utilization_receive > 0xffffffff)
+			return null;
+
+		if (type(item.utilization_transmit) != "int" || item.utilization_transmit < 0 || item.utilization_transmit > 0xffffffff)
+			return null;
+
+		buf.put('6s', bssid);
+		buf.put('!L', item.last_data_downlink_rate);
+		buf.put('!L', item.last_data_uplink_rate);
+		buf.put('!L', item.utilization_receive);
+		buf.put('!L', item.utilization_transmit);
+	}
+
+	return buf;
+};
+
+// 0xc9 - Status Code
+// Wi-Fi EasyMesh
+encoder[0xc9] = (buf, status_code) => {
+	if (type(status_code) != "int" || status_code < 0 || status_code > 0xffff)
+		return null;
+
+	buf.put('!H', status_code);
+
+	return buf;
+};
+
+// 0xca - Reason Code
+// Wi-Fi EasyMesh
+encoder[0xca] = (buf, reason_code) => {
+	if (type(reason_code) != "int" || reason_code < 0 || reason_code > 0xffff)
+		return null;
+
+	buf.put('!H', reason_code);
+
+	return buf;
+};
+
+// 0xcb - Backhaul STA Radio Capabilities
+// Wi-Fi EasyMesh
+encoder[0xcb] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	let mac_address = null;
+
+	if (tlv.mac_address != null) {
+		mac_address = ether_aton(tlv.mac_address);
+
+		if (mac_address == null)
+			return null;
+	}
+
+	tlv.mac_address_included ??= (mac_address != null) && 1;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', 0
+		| (tlv.mac_address_included << 7)
+	);
+
+	if (tlv.mac_address_included == 1)
+		buf.put('6s', mac_address);
+
+	return buf;
+};
+
+// 0xd0 - Backhaul BSS Configuration
+// Wi-Fi EasyMesh
+encoder[0xd0] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	buf.put('6s', bssid);
+	buf.put('B', 0
+		| (tlv.profile1_backhaul_sta_disallowed << 7)
+		| (tlv.profile2_backhaul_sta_disallowed << 6)
+	);
+
+	return buf;
+};
+
+// -----------------------------------------------------------------------------
+// TLV DECODER ROUTINES
+// -----------------------------------------------------------------------------
+
+// 0xa4 - Channel Scan Reporting Policy
+// Wi-Fi EasyMesh
+decoder[0xa4] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const bitfield = buf.get('B');
+	const report_independent_channel_scans = ((bitfield & 0b10000000) == 0b10000000);
+
+	return {
+		report_independent_channel_scans,
+	};
+};
+
+// 0xa5 - Channel Scan Capabilities
+// Wi-Fi EasyMesh
+decoder[0xa5] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const radios_count = buf.get('B');
+	const radios = [];
+
+	for (let h = 0; h < radios_count; h++) {
+		if (buf.pos() + 12 > end)
+			return null;
+
+		const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+
+		const bitfield = buf.get('B');
+		const on_boot_only = ((bitfield & 0b10000000) == 0b10000000);
+		const scan_impact = (bitfield >> 5) & 0b00000011;
+
+		const minimum_scan_interval = buf.get('!L');
+		const opclass_count = buf.get('B');
+		const opclasses = [];
+
+		for (let i = 0; i < opclass_count; i++) {
+			if (buf.pos() + 2 > end)
+				return null;
+
+			const opclass = buf.get('B');
+			const channels_count = buf.get('B');
+			const channels = [];
+
+			for (let j = 0; j < channels_count; j++) {
+				if (buf.pos() + 1 > end)
+					return null;
+
+				push(channels, buf.get('B'));
+			}
+
+			push(opclasses, {
+				opclass,
+				channels,
+			});
+		}
+
+		push(radios, {
+			radio_unique_identifier,
+			on_boot_only,
+			scan_impact,
+			scan_impact_name: defs.SCAN_IMPACT[scan_impact],
+			minimum_scan_interval,
+			opclasses,
+		});
+	}
+
+	return radios;
+};
+
+// 0xa6 - Channel Scan Request
+// Wi-Fi EasyMesh
+decoder[0xa6] = (buf, end) => {
+	if (buf.pos() + 2 > end)
+		return null;
+
+	const bitfield = buf.get('B');
+	const perform_fresh_scan = ((bitfield & 0b10000000) == 0b10000000);
+
+	const radios_count = buf.get('B');
+	const radios = [];
+
+	for (let h = 0; h < radios_count; h++) {
+		if (buf.pos() + 7 > end)
+			return null;
+
+		const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+		const opclass_count = buf.get('B');
+		const opclasses = [];
+
+		for (let i = 0; i < opclass_count; i++) {
+			if (buf.pos() + 2 > end)
+				return null;
+
+			const opclass = buf.get('B');
+			const channels_count = buf.get('B');
+			const channels = [];
+
+			for (let j = 0; j < channels_count; j++) {
+				if (buf.pos() + 1 > end)
+					return null;
+
+				push(channels, buf.get('B'));
+			}
+
+			push(opclasses, {
+				opclass,
+				channels,
+			});
+		}
+
+		push(radios, {
+			radio_unique_identifier,
+			opclasses,
+		});
+	}
+
+	return {
+		perform_fresh_scan,
+		radios,
+	};
+};
+
+// 0xa7 - Channel Scan Result
+// Wi-Fi EasyMesh
+decoder[0xa7] = (buf, end) => {
+	if (buf.pos() + 9 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const opclass = buf.get('B');
+	const channel = buf.get('B');
+	const scan_status = buf.get('B');
+
+	if (!exists(defs.SCAN_STATUS, scan_status))
+		return null;
+
+	let timestamp_length = null;
+
+	if (scan_status == 0) {
+		timestamp_length = buf.get('B');
+	}
+
+	let timestamp = null;
+
+	if (scan_status == 0) {
+		if (buf.pos() + timestamp_length > end)
+			return null;
+
+		timestamp = buf.get(timestamp_length);
+	}
+
+	let utilization = null;
+
+	if (scan_status == 0) {
+		utilization = buf.get('B');
+	}
+
+	let noise = null;
+
+	if (scan_status == 0) {
+		noise = buf.get('B');
+	}
+
+	let number_of_neighbors = null;
+
+	if (scan_status == 0) {
+		number_of_neighbors = buf.get('!H');
+	}
+
+	let neighbors = null;
+
+	if (scan_status == 0) {
+		neighbors = [];
+
+		for (let i = 0; i < number_of_neighbors; i++) {
+			if (buf.pos() + 13 > end)
+				return null;
+
+			const bssid = ether_ntoa(buf.get('6s'));
+			const ssid_length = buf.get('B');
+
+			if (ssid_length > 0x20)
+				return null;
+
+			if (buf.pos() + ssid_length > end)
+				return null;
+
+			const ssid = buf.get(ssid_length);
+			const signal_strength = buf.get('B');
+			const channel_bandwidth_length = buf.get('B');
+
+			if (buf.pos() + channel_bandwidth_length > end)
+				return null;
+
+			const channel_bandwidth = buf.get(channel_bandwidth_length);
+
+			const bitfield = buf.get('B');
+			const bss_load_element_present = ((bitfield & 0b10000000) == 0b10000000);
+			const bss_color = bitfield & 0b00111111;
+
+			const channel_utilization = buf.get('B');
+			const station_count = buf.get('!H');
+
+			push(neighbors, {
+				bssid,
+				ssid,
+				signal_strength,
+				channel_bandwidth,
+				bss_load_element_present,
+				bss_color,
+				channel_utilization,
+				station_count,
+			});
+		}
+	}
+
+	let aggregate_scan_duration = null;
+
+	if (scan_status == 0) {
+		aggregate_scan_duration = buf.get('!L');
+	}
+
+	let active_scan = null;
+
+	if (scan_status == 0) {
+		const bitfield = buf.get('B');
+
+		active_scan = ((bitfield & 0b10000000) == 0b10000000);
+	}
+
+	return {
+		radio_unique_identifier,
+		opclass,
+		channel,
+		scan_status,
+		scan_status_name: defs.SCAN_STATUS[scan_status],
+		timestamp,
+		utilization,
+		noise,
+		neighbors,
+		aggregate_scan_duration,
+		active_scan,
+	};
+};
+
+// 0xa8 - Timestamp
+// Wi-Fi EasyMesh
+decoder[0xa8] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const timestamp_length = buf.get('B');
+
+	if (buf.pos() + timestamp_length > end)
+		return null;
+
+	const timestamp = buf.get(timestamp_length);
+
+	return timestamp;
+};
+
+// 0xad - CAC Request
+// Wi-Fi EasyMesh
+decoder[0xad] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const radios_count = buf.get('B');
+	const radios = [];
+
+	for (let h = 0; h < radios_count; h++) {
+		if (buf.pos() + 9 > end)
+			return null;
+
+		const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+		const opclass = buf.get('B');
+		const channel = buf.get('B');
+
+		const bitfield = buf.get('B');
+		const cac_method = (bitfield >> 5) & 0b00000111;
+		const cac_completion_action = (bitfield >> 3) & 0b00000011;
+
+		push(radios, {
+			radio_unique_identifier,
+			opclass,
+			channel,
+			cac_method,
+			cac_completion_action,
+		});
+	}
+
+	return radios;
+};
+
+// 0xae - CAC Termination
+// Wi-Fi EasyMesh
+decoder[0xae] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const radios_count = buf.get('B');
+	const radios = [];
+
+	for (let h = 0; h < radios_count; h++) {
+		if (buf.pos() + 8 > end)
+			return null;
+
+		const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+		const opclass = buf.get('B');
+		const channel = buf.get('B');
+
+		push(radios, {
+			radio_unique_identifier,
+			opclass,
+			channel,
+		});
+	}
+
+	return radios;
+};
+
+// 0xaf - CAC Completion Report
+// Wi-Fi EasyMesh
+decoder[0xaf] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const radios_count = buf.get('B');
+	const radios = [];
+
+	for (let h = 0; h < radios_count; h++) {
+		if (buf.pos() + 10 > end)
+			return null;
+
+		const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+		const opclass = buf.get('B');
+		const channel = buf.get('B');
+		const cac_completion_status = buf.get('B');
+
+		if (!exists(defs.CAC_COMPLETION_STATUS, cac_completion_status))
+			return null;
+
+		const pairs_count = buf.get('B');
+		const pairs = [];
+
+		for (let i = 0; i < pairs_count; i++) {
+			if (buf.pos() + 2 > end)
+				return null;
+
+			const opclass_detected = buf.get('B');
+			const channel_detected = buf.get('B');
+
+			push(pairs, {
+				opclass_detected,
+				channel_detected,
+			});
+		}
+
+		push(radios, {
+			radio_unique_identifier,
+			opclass,
+			channel,
+			cac_completion_status,
+			cac_completion_status_name: defs.CAC_COMPLETION_STATUS[cac_completion_status],
+			pairs,
+		});
+	}
+
+	return radios;
+};
+
+// 0xb1 - CAC Status Report
+// Wi-Fi EasyMesh
+decoder[0xb1] = (buf, end) => {
+	if (buf.pos() + 3 > end)
+		return null;
+
+	const available_channels_count = buf.get('B');
+	const available_channels = [];
+
+	for (let h = 0; h < available_channels_count; h++) {
+		if (buf.pos() + 4 > end)
+			return null;
+
+		const opclass = buf.get('B');
+		const channel = buf.get('B');
+		const minutes = buf.get('!H');
+
+		push(available_channels, {
+			opclass,
+			channel,
+			minutes,
+		});
+	}
+
+	const radar_detected_channels_count = buf.get('B');
+	const radar_detected_channels = [];
+
+	for (let h = 0; h < radar_detected_channels_count; h++) {
+		if (buf.pos() + 4 > end)
+			return null;
+
+		const opclass = buf.get('B');
+		const channel = buf.get('B');
+		const duration = buf.get('!H');
+
+		push(radar_detected_channels, {
+			opclass,
+			channel,
+			duration,
+		});
+	}
+
+	const active_cac_channels_count = buf.get('B');
+	const active_cac_channels = [];
+
+	for (let h = 0; h < active_cac_channels_count; h++) {
+		if (buf.pos() + 5 > end)
+			return null;
+
+		const opclass = buf.get('B');
+		const channel = buf.get('B');
+		const countdown = ((buf.get('B') << 16) | buf.get('!H'));
+
+		push(active_cac_channels, {
+			opclass,
+			channel,
+			countdown,
+		});
+	}
+
+	return {
+		available_channels,
+		radar_detected_channels,
+		active_cac_channels,
+	};
+};
+
+// 0xb2 - CAC Capabilities
+// Wi-Fi EasyMesh
+decoder[0xb2] = (buf, end) => {
+	if (buf.pos() + 3 > end)
+		return null;
+
+	const country_code = buf.get(2);
+	const radios_count = buf.get('B');
+	const radios = [];
+
+	for (let h = 0; h < radios_count; h++) {
+		if (buf.pos() + 7 > end)
+			return null;
+
+		const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+		const cac_types_supported_count = buf.get('B');
+		const cac_types_supported = [];
+
+		for (let i = 0; i < cac_types_supported_count; i++) {
+			if (buf.pos() + 5 > end)
+				return null;
+
+			const cac_method_supported = buf.get('B');
+
+			if (!exists(defs.CAC_METHOD_SUPPORTED, cac_method_supported))
+				return null;
+
+			const duration = ((buf.get('B') << 16) | buf.get('!H'));
+			const opclass_count = buf.get('B');
+			const opclasses = [];
+
+			for (let j = 0; j < opclass_count; j++) {
+				if (buf.pos() + 2 > end)
+					return null;
+
+				const opclass = buf.get('B');
+				const channels_count = buf.get('B');
+				const channels = [];
+
+				for (let k = 0; k < channels_count; k++) {
+					if (buf.pos() + 1 > end)
+						return null;
+
+					const channel = buf.get('B');
+
+					push(channels, channel);
+				}
+
+				push(opclasses, {
+					opclass,
+					channels,
+				});
+			}
+
+			push(cac_types_supported, {
+				cac_method_supported,
+				cac_method_supported_name: defs.CAC_METHOD_SUPPORTED[cac_method_supported],
+				duration,
+				opclasses,
+			});
+		}
+
+		push(radios, {
+			radio_unique_identifier,
+			cac_types_supported,
+		});
+	}
+
+	return {
+		country_code,
+		radios,
+	};
+};
+
+// 0xb3 - Multi-AP Profile
+// Wi-Fi EasyMesh
+decoder[0xb3] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const profile = buf.get('B');
+
+	if (!exists(defs.MULTI_AP_PROFILE, profile))
+		return null;
+
+	return {
+		profile,
+		profile_name: defs.MULTI_AP_PROFILE[profile],
+	};
+};
+
+// 0xb4 - Profile-2 AP Capability
+// Wi-Fi EasyMesh
+decoder[0xb4] = (buf, end) => {
+	if (buf.pos() + 4 > end)
+		return null;
+
+	const max_prioritization_rules = buf.get('B');
+
+	buf.get(1);
+
+	const bitfield = buf.get('B');
+	const byte_counter_unit = (bitfield >> 6) & 0b00000011;
+	const supports_prioritization = ((bitfield & 0b00100000) == 0b00100000);
+	const supports_dpp_onboarding = ((bitfield & 0b00010000) == 0b00010000);
+	const supports_traffic_separation = ((bitfield & 0b00001000) == 0b00001000);
+
+	const max_unique_vids = buf.get('B');
+
+	return {
+		max_prioritization_rules,
+		byte_counter_unit,
+		byte_counter_unit_name: defs.BYTE_COUNTER_UNIT[byte_counter_unit],
+		supports_prioritization,
+		supports_dpp_onboarding,
+		supports_traffic_separation,
+		max_unique_vids,
+	};
+};
+
+// 0xb5 - Default 802.1Q Settings
+// Wi-Fi EasyMesh
+decoder[0xb5] = (buf, end) => {
+	if (buf.pos() + 3 > end)
+		return null;
+
+	const primary_vlan_id = buf.get('!H');
+
+	const bitfield = buf.get('B');
+	const default_pcp = (bitfield >> 5) & 0b00000111;
+
+	return {
+		primary_vlan_id,
+		default_pcp,
+	};
+};
+
+// 0xb6 - Traffic Separation Policy
+// Wi-Fi EasyMesh
+decoder[0xb6] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const ssids_count = buf.get('B');
+	const ssids = [];
+
+	for (let h = 0; h < ssids_count; h++) {
+		if (buf.pos() + 3 > end)
+			return null;
+
+		const ssid_name_length = buf.get('B');
+
+		if (buf.pos() + ssid_name_length > end)
+			return null;
+
+		const ssid_name = buf.get(ssid_name_length);
+		const vlan_id = buf.get('!H');
+
+		push(ssids, {
+			ssid_name,
+			vlan_id,
+		});
+	}
+
+	return ssids;
+};
+
+// 0xb9 - Service Prioritization Rule
+// Wi-Fi EasyMesh
+decoder[0xb9] = (buf, end) => {
+	if (buf.pos() + 8 > end)
+		return null;
+
+	const rule_id = buf.get('!L');
+
+	const bitfield = buf.get('B');
+	const add_remove = ((bitfield & 0b10000000) == 0b10000000);
+
+	const precedence = buf.get('B');
+	const output = buf.get('B');
+
+	const bitfield2 = buf.get('B');
+	const always_match = ((bitfield2 & 0b10000000) == 0b10000000);
+
+	return {
+		rule_id,
+		add_remove,
+		precedence,
+		output,
+		always_match,
+	};
+};
+
+// 0xba - DSCP Mapping Table
+// Wi-Fi EasyMesh
+decoder[0xba] = (buf, end) => {
+	const dscp_pcp_mapping = [];
+
+	while (buf.pos() + 1 <= end) {
+		const pcp_value = buf.get('B');
+
+		push(dscp_pcp_mapping, pcp_value);
+	}
+
+	return dscp_pcp_mapping;
+};
+
+// 0xbc - Profile-2 Error Code
+// Wi-Fi EasyMesh
+decoder[0xbc] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const reason_code = buf.get('B');
+
+	if (!exists(defs.PROFILE_2_REASON_CODE, reason_code))
+		return null;
+
+	let bssid = null;
+
+	if (reason_code in [ 7, 8 ]) {
+		bssid = ether_ntoa(buf.get('6s'));
+	}
+
+	let service_prio_rule_id = null;
+
+	if (reason_code in [ 1, 2 ]) {
+		service_prio_rule_id = buf.get('!L');
+	}
+
+	let qmid = null;
+
+	if (reason_code == 11) {
+		qmid = buf.get('!H');
+	}
+
+	return {
+		reason_code,
+		reason_code_name: defs.PROFILE_2_REASON_CODE[reason_code],
+		bssid,
+		service_prio_rule_id,
+		qmid,
+	};
+};
+
+// 0xbe - AP Radio Advanced Capabilities
+// Wi-Fi EasyMesh
+decoder[0xbe] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+
+	const bitfield = buf.get('B');
+	const combined_front_back = ((bitfield & 0b10000000) == 0b10000000);
+	const combined_profile1_profile2 = ((bitfield & 0b01000000) == 0b01000000);
+	const mscs = ((bitfield & 0b00100000) == 0b00100000);
+	const scs = ((bitfield & 0b00010000) == 0b00010000);
+	const qos_map = ((bitfield & 0b00001000) == 0b00001000);
+	const dscp_policy = ((bitfield & 0b00000100) == 0b00000100);
+
+	return {
+		radio_unique_identifier,
+		combined_front_back,
+		combined_profile1_profile2,
+		mscs,
+		scs,
+		qos_map,
+		dscp_policy,
+	};
+};
+
+// 0xbf - Association Status Notification
+// Wi-Fi EasyMesh
+decoder[0xbf] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const bssids_count = buf.get('B');
+	const bssids = [];
+
+	for (let h = 0; h < bssids_count; h++) {
+		if (buf.pos() + 7 > end)
+			return null;
+
+		const bssid = ether_ntoa(buf.get('6s'));
+		const association_allowance_status = buf.get('B');
+
+		if (!exists(defs.ASSOCIATION_ALLOWANCE_STATUS, association_allowance_status))
+			return null;
+
+		push(bssids, {
+			bssid,
+			association_allowance_status,
+			association_allowance_status_name: defs.ASSOCIATION_ALLOWANCE_STATUS[association_allowance_status],
+		});
+	}
+
+	return bssids;
+};
+
+// 0xc0 - Source Info
+// Wi-Fi EasyMesh
+decoder[0xc0] = (buf, end) => {
+	if (buf.pos() + 6 > end)
+		return null;
+
+	const mac_address = ether_ntoa(buf.get('6s'));
+
+	return mac_address;
+};
+
+// 0xc1 - Tunneled message type
+// Wi-Fi EasyMesh
+decoder[0xc1] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const tunneled_protocol_type = buf.get('B');
+
+	if (!exists(defs.TUNNELED_PROTOCOL_TYPE, tunneled_protocol_type))
+		return null;
+
+	return {
+		tunneled_protocol_type,
+		tunneled_protocol_type_name: defs.TUNNELED_PROTOCOL_TYPE[tunneled_protocol_type],
+	};
+};
+
+// 0xc2 - Tunneled
+// Wi-Fi EasyMesh
+decoder[0xc2] = (buf, end) => buf.get(end - buf.pos());
+
+// 0xc3 - Profile-2 Steering Request
+// Wi-Fi EasyMesh
+decoder[0xc3] = (buf, end) => {
+	if (buf.pos() + 13 > end)
+		return null;
+
+	const bssid = ether_ntoa(buf.get('6s'));
+
+	const bitfield = buf.get('B');
+	const request_mode = ((bitfield & 0b10000000) == 0b10000000);
+	const btm_disassociation_imminent_bit = ((bitfield & 0b01000000) == 0b01000000);
+	const btm_abridged_bit = ((bitfield & 0b00100000) == 0b00100000);
+
+	const steering_opportunity_window = buf.get('!H');
+	const btm_disassociation_timer = buf.get('!H');
+	const sta_list_count = buf.get('B');
+	const sta_list = [];
+
+	for (let h = 0; h < sta_list_count; h++) {
+		if (buf.pos() + 6 > end)
+			return null;
+
+		const mac_address = ether_ntoa(buf.get('6s'));
+
+		push(sta_list, mac_address);
+	}
+
+	const target_bssid_count = buf.get('B');
+	const target_bssids = [];
+
+	for (let h = 0; h < target_bssid_count; h++) {
+		if (buf.pos() + 9 > end)
+			return null;
+
+		const target_bssid = ether_ntoa(buf.get('6s'));
+		const target_bss_opclass = buf.get('B');
+		const target_bss_channel = buf.get('B');
+		const reason_code = buf.get('B');
+
+		push(target_bssids, {
+			target_bssid,
+			target_bss_opclass,
+			target_bss_channel,
+			reason_code,
+		});
+	}
+
+	return {
+		bssid,
+		request_mode,
+		btm_disassociation_imminent_bit,
+		btm_abridged_bit,
+		steering_opportunity_window,
+		btm_disassociation_timer,
+		sta_list,
+		target_bssids,
+	};
+};
+
+// 0xc4 - Unsuccessful Association Policy
+// Wi-Fi EasyMesh
+decoder[0xc4] = (buf, end) => {
+	if (buf.pos() + 5 > end)
+		return null;
+
+	const bitfield = buf.get('B');
+	const report_unsuccessful_assocs = ((bitfield & 0b10000000) == 0b10000000);
+
+	const max_reporting_rate = buf.get('!L');
+
+	return {
+		report_unsuccessful_assocs,
+		max_reporting_rate,
+	};
+};
+
+// 0xc5 - Metric Collection Interval
+// Wi-Fi EasyMesh
+decoder[0xc5] = (buf, end) => {
+	if (buf.pos() + 4 > end)
+		return null;
+
+	const collection_interval = buf.get('!L');
+
+	return collection_interval;
+};
+
+// 0xc6 - Radio Metrics
+// Wi-Fi EasyMesh
+decoder[0xc6] = (buf, end) => {
+	if (buf.pos() + 10 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const noise = buf.get('B');
+	const transmit = buf.get('B');
+	const receive_self = buf.get('B');
+	const receive_other = buf.get('B');
+
+	return {
+		radio_unique_identifier,
+		noise,
+		transmit,
+		receive_self,
+		receive_other,
+	};
+};
+
+// 0xc7 - AP Extended Metrics
+// Wi-Fi EasyMesh
+decoder[0xc7] = (buf, end) => {
+	if (buf.pos() + 30 > end)
+		return null;
+
+	const bssid = ether_ntoa(buf.get('6s'));
+	const unicast_bytes_sent = buf.get('!L');
+	const unicast_bytes_received = buf.get('!L');
+	const multicast_bytes_sent = buf.get('!L');
+	const multicast_bytes_received = buf.get('!L');
+	const broadcast_bytes_sent = buf.get('!L');
+	const broadcast_bytes_received = buf.get('!L');
+
+	return {
+		bssid,
+		unicast_bytes_sent,
+		unicast_bytes_received,
+		multicast_bytes_sent,
+		multicast_bytes_received,
+		broadcast_bytes_sent,
+		broadcast_bytes_received,
+	};
+};
+
+// 0xc8 - Associated STA Extended Link Metrics
+// Wi-Fi EasyMesh
+decoder[0xc8] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const mac_address = ether_ntoa(buf.get('6s'));
+	const bssids_count = buf.get('B');
+	const bssids = [];
+
+	for (let h = 0; h < bssids_count; h++) {
+		if (buf.pos() + 22 > end)
+			return null;
+
+		const bssid = ether_ntoa(buf.get('6s'));
+		const last_data_downlink_rate = buf.get('!L');
+		const last_data_uplink_rate = buf.get('!L');
+		const utilization_receive = buf.get('!L');
+		const utilization_transmit = buf.get('!L');
+
+		push(bssids, {
+			bssid,
+			last_data_downlink_rate,
+			last_data_uplink_rate,
+			utilization_receive,
+			utilization_transmit,
+		});
+	}
+
+	return {
+		mac_address,
+		bssids,
+	};
+};
+
+// 0xc9 - Status Code
+// Wi-Fi EasyMesh
+decoder[0xc9] = (buf, end) => {
+	if (buf.pos() + 2 > end)
+		return null;
+
+	const status_code = buf.get('!H');
+
+	return status_code;
+};
+
+// 0xca - Reason Code
+// Wi-Fi EasyMesh
+decoder[0xca] = (buf, end) => {
+	if (buf.pos() + 2 > end)
+		return null;
+
+	const reason_code = buf.get('!H');
+
+	return reason_code;
+};
+
+// 0xcb - Backhaul STA Radio Capabilities
+// Wi-Fi EasyMesh
+decoder[0xcb] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+
+	const bitfield = buf.get('B');
+	const mac_address_included = ((bitfield & 0b10000000) == 0b10000000);
+
+	let mac_address = null;
+
+	if (mac_address_included == 1) {
+		mac_address = ether_ntoa(buf.get('6s'));
+	}
+
+	return {
+		radio_unique_identifier,
+		mac_address_included,
+		mac_address,
+	};
+};
+
+// 0xd0 - Backhaul BSS Configuration
+// Wi-Fi EasyMesh
+decoder[0xd0] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const bssid = ether_ntoa(buf.get('6s'));
+
+	const bitfield = buf.get('B');
+	const profile1_backhaul_sta_disallowed = ((bitfield & 0b10000000) == 0b10000000);
+	const profile2_backhaul_sta_disallowed = ((bitfield & 0b01000000) == 0b01000000);
+
+	return {
+		bssid,
+		profile1_backhaul_sta_disallowed,
+		profile2_backhaul_sta_disallowed,
+	};
+};
+
+return { encoder, decoder, extended_encoder, extended_decoder };
@@ -0,0 +1,2063 @@
+import { ether_ntoa, ether_aton } from 'umap.core';
+import defs from 'umap.defs';
+
+const encoder = [];
+const decoder = [];
+const extended_encoder = [];
+const extended_decoder = [];
+
+// -----------------------------------------------------------------------------
+// TLV ENCODER ROUTINES
+// -----------------------------------------------------------------------------
+
+// 0xa9 - 1905 Layer Security Capability
+// Wi-Fi EasyMesh
+encoder[0xa9] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.onboarding_protocol) != "int" || tlv.onboarding_protocol < 0 || tlv.onboarding_protocol > 0xff)
+		return null;
+
+	if (type(tlv.mic_algorithm) != "int" || tlv.mic_algorithm < 0 || tlv.mic_algorithm > 0xff)
+		return null;
+
+	if (type(tlv.encryption_algorithm) != "int" || tlv.encryption_algorithm < 0 || tlv.encryption_algorithm > 0xff)
+		return null;
+
+	buf.put('B', tlv.onboarding_protocol);
+	buf.put('B', tlv.mic_algorithm);
+	buf.put('B', tlv.encryption_algorithm);
+
+	return buf;
+};
+
+// 0xaa - AP Wi-Fi 6 Capabilities
+// Wi-Fi EasyMesh
+encoder[0xaa] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (type(tlv.roles) != "array" || length(tlv.roles) > 0xff)
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', length(tlv.roles));
+
+	for (let item in tlv.roles) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.agent_role) != "int" || item.agent_role < 0 || item.agent_role > 0b00000011)
+			return null;
+
+		if (type(item.mcs_nss) != "string" || length(item.mcs_nss) > 16)
+			return null;
+
+		if (type(item.max_dl_mu_mimo_tx) != "int" || item.max_dl_mu_mimo_tx < 0 || item.max_dl_mu_mimo_tx > 0b00001111)
+			return null;
+
+		if (type(item.max_ul_mu_mimo_rx) != "int" || item.max_ul_mu_mimo_rx < 0 || item.max_ul_mu_mimo_rx > 0b00001111)
+			return null;
+
+		if (type(item.max_dl_ofdma_tx) != "int" || item.max_dl_ofdma_tx < 0 || item.max_dl_ofdma_tx > 0xff)
+			return null;
+
+		if (type(item.max_ul_ofdma_rx) != "int" || item.max_ul_ofdma_rx < 0 || item.max_ul_ofdma_rx > 0xff)
+			return null;
+
+		buf.put('B', 0
+			| ((item.agent_role & 0b00000011) << 6)
+			| (item.he_160 << 5)
+			| (item.he_8080 << 4)
+			| ((length(item.mcs_nss) & 0b00001111) << 0)
+		);
+
+		buf.put('*', item.mcs_nss);
+		buf.put('B', 0
+			| (item.su_beamformer << 7)
+			| (item.su_beamformee << 6)
+			| (item.mu_beamformer_status << 5)
+			| (item.beamformee_sts_less_80 << 4)
+			| (item.beamformee_sts_greater_80 << 3)
+			| (item.ul_mu_mimo << 2)
+			| (item.ul_ofdma << 1)
+			| (item.dl_ofdma << 0)
+		);
+
+		buf.put('B', 0
+			| ((item.max_dl_mu_mimo_tx & 0b00001111) << 4)
+			| ((item.max_ul_mu_mimo_rx & 0b00001111) << 0)
+		);
+
+		buf.put('B', item.max_dl_ofdma_tx);
+		buf.put('B', item.max_ul_ofdma_rx);
+		buf.put('B', 0
+			| (item.rts << 7)
+			| (item.mu_rts << 6)
+			| (item.multi_bssid << 5)
+			| (item.mu_edca << 4)
+			| (item.twt_requester << 3)
+			| (item.twt_responder << 2)
+			| (item.spatial_reuse << 1)
+			| (item.anticipated_channel_usage << 0)
+		);
+	}
+
+	return buf;
+};
+
+// 0xab - MIC
+// Wi-Fi EasyMesh
+encoder[0xab] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.gtk_key_id) != "int" || tlv.gtk_key_id < 0 || tlv.gtk_key_id > 0b00000011)
+		return null;
+
+	if (type(tlv.mic_version) != "int" || tlv.mic_version < 0 || tlv.mic_version > 0b00000011)
+		return null;
+
+	if (type(tlv.integrity_transmission_counter) != "int" || tlv.integrity_transmission_counter < 0 || tlv.integrity_transmission_counter > 0xffffffffffff)
+		return null;
+
+	const source_1905_al_mac_address = ether_aton(tlv.source_1905_al_mac_address);
+
+	if (source_1905_al_mac_address == null)
+		return null;
+
+	if (type(tlv.mic) != "string" || length(tlv.mic) > 0xffff)
+		return null;
+
+	buf.put('B', 0
+		| ((tlv.gtk_key_id & 0b00000011) << 6)
+		| ((tlv.mic_version & 0b00000011) << 4)
+	);
+
+	buf.put('!HL', tlv.integrity_transmission_counter >> 32, tlv.integrity_transmission_counter & 0xffffffff);
+	buf.put('6s', source_1905_al_mac_address);
+	buf.put('!H', length(tlv.mic));
+	buf.put('*', tlv.mic);
+
+	return buf;
+};
+
+// 0xac - Encrypted
+// Wi-Fi EasyMesh
+encoder[0xac] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.encryption_transmission_counter) != "int" || tlv.encryption_transmission_counter < 0 || tlv.encryption_transmission_counter > 0xffffffffffff)
+		return null;
+
+	const source_1905_al_mac_address = ether_aton(tlv.source_1905_al_mac_address);
+
+	if (source_1905_al_mac_address == null)
+		return null;
+
+	const destination_1905_al_mac_address = ether_aton(tlv.destination_1905_al_mac_address);
+
+	if (destination_1905_al_mac_address == null)
+		return null;
+
+	if (type(tlv.aes_siv) != "string" || length(tlv.aes_siv) > 0xffff)
+		return null;
+
+	buf.put('!HL', tlv.encryption_transmission_counter >> 32, tlv.encryption_transmission_counter & 0xffffffff);
+	buf.put('6s', source_1905_al_mac_address);
+	buf.put('6s', destination_1905_al_mac_address);
+	buf.put('!H', length(tlv.aes_siv));
+	buf.put('*', tlv.aes_siv);
+
+	return buf;
+};
+
+// 0xb0 - Associated Wi-Fi 6 STA Status Report
+// Wi-Fi EasyMesh
+encoder[0xb0] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const mac_address = ether_aton(tlv.mac_address);
+
+	if (mac_address == null)
+		return null;
+
+	if (type(tlv.n2) != "array" || length(tlv.n2) > 0xff)
+		return null;
+
+	buf.put('6s', mac_address);
+	buf.put('B', length(tlv.n2));
+
+	for (let item in tlv.n2) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.tid) != "int" || item.tid < 0 || item.tid > 0xff)
+			return null;
+
+		if (type(item.queue_size) != "int" || item.queue_size < 0 || item.queue_size > 0xff)
+			return null;
+
+		buf.put('B', item.tid);
+		buf.put('B', item.queue_size);
+	}
+
+	return buf;
+};
+
+// 0xb7 - BSS Configuration Report TLV format BSSID
+// Wi-Fi EasyMesh
+encoder[0xb7] = (buf, radios) => {
+	if (type(radios) != "array" || length(radios) > 0xff)
+		return null;
+
+	buf.put('B', length(radios));
+
+	for (let item in radios) {
+		if (type(item) != "object")
+			return null;
+
+		const radio_unique_identifier = ether_aton(item.radio_unique_identifier);
+
+		if (radio_unique_identifier == null)
+			return null;
+
+		if (type(item.bss) != "array" || length(item.bss) > 0xff)
+			return null;
+
+		buf.put('6s', radio_unique_identifier);
+		buf.put('B', length(item.bss));
+
+		for (let item2 in item.bss) {
+			if (type(item2) != "object")
+				return null;
+
+			const bssid = ether_aton(item2.bssid);
+
+			if (bssid == null)
+				return null;
+
+			if (type(item2.ssid) != "string" || length(item2.ssid) > 0xff)
+				return null;
+
+			buf.put('6s', bssid);
+			buf.put('B', 0
+				| (item2.backhaul << 7)
+				| (item2.fronthaul << 6)
+				| (item2.r1_disallowed_status << 5)
+				| (item2.r2_disallowed_status << 4)
+				| (item2.multiple_bssid << 3)
+				| (item2.transmitted_bssid << 2)
+			);
+
+			buf.put('1x');
+			buf.put('B', length(item2.ssid));
+			buf.put('*', item2.ssid);
+		}
+	}
+
+	return buf;
+};
+
+// 0xb8 - BSSID
+// Wi-Fi EasyMesh
+encoder[0xb8] = (buf, bssid) => {
+	const _bssid = ether_aton(bssid);
+
+	if (_bssid == null)
+		return null;
+
+	buf.put('6s', _bssid);
+
+	return buf;
+};
+
+// 0xbb - BSS Configuration Request
+// Wi-Fi EasyMesh
+encoder[0xbb] = (buf, payload) => buf.put('*', payload);
+
+// 0xbd - BSS Configuration Response
+// Wi-Fi EasyMesh
+encoder[0xbd] = (buf, payload) => buf.put('*', payload);
+
+// 0xcc - AKM Suite Capabilities
+// Wi-Fi EasyMesh
+encoder[0xcc] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.backhaul_akm_suite_selectors) != "array" || length(tlv.backhaul_akm_suite_selectors) > 0xff)
+		return null;
+
+	if (type(tlv.fronthaul_akm_suite_selectors) != "array" || length(tlv.fronthaul_akm_suite_selectors) > 0xff)
+		return null;
+
+	buf.put('B', length(tlv.backhaul_akm_suite_selectors));
+
+	for (let item in tlv.backhaul_akm_suite_selectors) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.bh_oui) != "string" || length(item.bh_oui) > 3)
+			return null;
+
+		if (type(item.bh_akm_suite_type) != "int" || item.bh_akm_suite_type < 0 || item.bh_akm_suite_type > 0xff)
+			return null;
+
+		buf.put('3s', item.bh_oui);
+		buf.put('B', item.bh_akm_suite_type);
+	}
+
+	buf.put('B', length(tlv.fronthaul_akm_suite_selectors));
+
+	for (let item in tlv.fronthaul_akm_suite_selectors) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.fh_oui) != "string" || length(item.fh_oui) > 3)
+			return null;
+
+		if (type(item.fh_akm_suite_type) != "int" || item.fh_akm_suite_type < 0 || item.fh_akm_suite_type > 0xff)
+			return null;
+
+		buf.put('3s', item.fh_oui);
+		buf.put('B', item.fh_akm_suite_type);
+	}
+
+	return buf;
+};
+
+// 0xcd - 1905 Encap DPP
+// Wi-Fi EasyMesh
+encoder[0xcd] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const destination_sta_mac_address = ether_aton(tlv.destination_sta_mac_address);
+
+	if (destination_sta_mac_address == null)
+		return null;
+
+	if (type(tlv.frame_type) != "int" || tlv.frame_type < 0 || tlv.frame_type > 0xff)
+		return null;
+
+	if (type(tlv.encapsulated_frame) != "string" || length(tlv.encapsulated_frame) > 0xffff)
+		return null;
+
+	buf.put('B', 0
+		| (tlv.enrollee_mac_address_present << 7)
+		| (tlv.dpp_frame_indicator << 5)
+	);
+
+	buf.put('6s', destination_sta_mac_address);
+	buf.put('B', tlv.frame_type);
+	buf.put('!H', length(tlv.encapsulated_frame));
+	buf.put('Z', tlv.encapsulated_frame);
+
+	return buf;
+};
+
+// 0xce - 1905 Encap EAPOL
+// Wi-Fi EasyMesh
+encoder[0xce] = (buf, payload) => buf.put('*', payload);
+
+// 0xcf - DPP Bootstrapping URI Notification
+// Wi-Fi EasyMesh
+encoder[0xcf] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	const backhaul_sta_address = ether_aton(tlv.backhaul_sta_address);
+
+	if (backhaul_sta_address == null)
+		return null;
+
+	if (type(tlv.dpp_uri) != "string")
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('6s', bssid);
+	buf.put('6s', backhaul_sta_address);
+	buf.put('*', tlv.dpp_uri);
+
+	return buf;
+};
+
+// 0xd1 - DPP Message
+// Wi-Fi EasyMesh
+encoder[0xd1] = (buf, payload) => buf.put('*', payload);
+
+// 0xd2 - DPP CCE Indication
+// Wi-Fi EasyMesh
+encoder[0xd2] = (buf, advertise_cce) => {
+	if (!(advertise_cce in [ 0, 1 ]))
+		return null;
+
+	buf.put('B', advertise_cce);
+
+	return buf;
+};
+
+// 0xd3 - DPP Chirp Value
+// Wi-Fi EasyMesh
+encoder[0xd3] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const destination_sta_mac_address = ether_aton(tlv.destination_sta_mac_address);
+
+	if (destination_sta_mac_address == null)
+		return null;
+
+	if (type(tlv.hash_value) != "string" || length(tlv.hash_value) > 0xff)
+		return null;
+
+	buf.put('B', 0
+		| (tlv.enrollee_mac_address_present << 7)
+		| (tlv.hash_validity << 6)
+	);
+
+	buf.put('6s', destination_sta_mac_address);
+	buf.put('B', length(tlv.hash_value));
+	buf.put('*', tlv.hash_value);
+
+	return buf;
+};
+
+// 0xd4 - Device Inventory
+// Wi-Fi EasyMesh
+encoder[0xd4] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.serial_number) != "string" || length(tlv.serial_number) > 0xff)
+		return null;
+
+	if (type(tlv.software_version) != "string" || length(tlv.software_version) > 0xff)
+		return null;
+
+	if (type(tlv.execution_env) != "string" || length(tlv.execution_env) > 0xff)
+		return null;
+
+	if (type(tlv.radios) != "array" || length(tlv.radios) > 0xff)
+		return null;
+
+	buf.put('B', length(tlv.serial_number));
+	buf.put('*', tlv.serial_number);
+	buf.put('B', length(tlv.software_version));
+	buf.put('*', tlv.software_version);
+	buf.put('B', length(tlv.execution_env));
+	buf.put('*', tlv.execution_env);
+	buf.put('B', length(tlv.radios));
+
+	for (let item in tlv.radios) {
+		if (type(item) != "object")
+			return null;
+
+		const radio_unique_identifier = ether_aton(item.radio_unique_identifier);
+
+		if (radio_unique_identifier == null)
+			return null;
+
+		if (type(item.chipset_vendor) != "string" || length(item.chipset_vendor) > 0xff)
+			return null;
+
+		buf.put('6s', radio_unique_identifier);
+		buf.put('B', length(item.chipset_vendor));
+		buf.put('*', item.chipset_vendor);
+	}
+
+	return buf;
+};
+
+// 0xd5 - Agent List
+// Wi-Fi EasyMesh
+encoder[0xd5] = (buf, multi_ap_agents_present) => {
+	if (type(multi_ap_agents_present) != "array" || length(multi_ap_agents_present) > 0xff)
+		return null;
+
+	buf.put('B', length(multi_ap_agents_present));
+
+	for (let item in multi_ap_agents_present) {
+		if (type(item) != "object")
+			return null;
+
+		const mac_address = ether_aton(item.mac_address);
+
+		if (mac_address == null)
+			return null;
+
+		if (!(item.multi_ap_profile in [ 0x01, 0x02, 0x03 ]))
+			return null;
+
+		if (type(item.security) != "int" || item.security < 0 || item.security > 255)
+			return null;
+
+		buf.put('6s', mac_address);
+		buf.put('B', item.multi_ap_profile);
+		buf.put('B', item.security);
+	}
+
+	return buf;
+};
+
+// 0xd6 - Anticipated Channel Preference
+// Wi-Fi EasyMesh
+encoder[0xd6] = (buf, opclasses) => {
+	if (type(opclasses) != "array" || length(opclasses) > 0xff)
+		return null;
+
+	buf.put('B', length(opclasses));
+
+	for (let item in opclasses) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.opclass) != "int" || item.opclass < 0 || item.opclass > 0xff)
+			return null;
+
+		if (type(item.channels) != "array")
+			return null;
+
+		buf.put('B', item.opclass);
+		buf.put('B', length(item.channels));
+
+		for (let item2 in item.channels) {
+			if (type(item2) != "int" || item2 < 0 || item2 > 0xff)
+				return null;
+
+			buf.put('B', item2);
+		}
+
+		buf.put('4x');
+	}
+
+	return buf;
+};
+
+// 0xd7 - Anticipated Channel Usage
+// Wi-Fi EasyMesh
+encoder[0xd7] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.opclass) != "int" || tlv.opclass < 0 || tlv.opclass > 0xff)
+		return null;
+
+	if (type(tlv.channel) != "int" || tlv.channel < 0 || tlv.channel > 0xff)
+		return null;
+
+	const reference_bssid = ether_aton(tlv.reference_bssid);
+
+	if (reference_bssid == null)
+		return null;
+
+	if (type(tlv.burst_start_time) != "int" || tlv.burst_start_time < 0 || tlv.burst_start_time > 0xffffffff)
+		return null;
+
+	if (type(tlv.usage_entries) != "array" || length(tlv.usage_entries) > 0xff)
+		return null;
+
+	buf.put('B', tlv.opclass);
+	buf.put('B', tlv.channel);
+	buf.put('6s', reference_bssid);
+	buf.put('B', length(tlv.usage_entries));
+	buf.put('!L', tlv.burst_start_time);
+
+	for (let item in tlv.usage_entries) {
+		if (type(item) != "object")
+			return null;
+
+		if (type(item.burst_length) != "int" || item.burst_length < 0 || item.burst_length > 0xffffffff)
+			return null;
+
+		if (type(item.repetitions_count) != "int" || item.repetitions_count < 0 || item.repetitions_count > 0xffffffff)
+			return null;
+
+		if (type(item.burst_interval) != "int" || item.burst_interval < 0 || item.burst_interval > 0xffffffff)
+			return null;
+
+		if (type(item.ru_bitmask) != "string" || length(item.ru_bitmask) > 0xff)
+			return null;
+
+		const transmitter_identifier = ether_aton(item.transmitter_identifier);
+
+		if (transmitter_identifier == null)
+			return null;
+
+		if (type(item.power_level) != "int" || item.power_level < 0 || item.power_level > 0xff)
+			return null;
+
+		if (type(item.channel_usage_reason) != "int" || item.channel_usage_reason < 0 || item.channel_usage_reason > 0xff)
+			return null;
+
+		buf.put('!L', item.burst_length);
+		buf.put('!L', item.repetitions_count);
+		buf.put('!L', item.burst_interval);
+		buf.put('B', length(item.ru_bitmask));
+		buf.put('*', item.ru_bitmask);
+		buf.put('6s', transmitter_identifier);
+		buf.put('B', item.power_level);
+		buf.put('B', item.channel_usage_reason);
+		buf.put('4x');
+	}
+
+	return buf;
+};
+
+// 0xd8 - Spatial Reuse Request
+// Wi-Fi EasyMesh
+encoder[0xd8] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (type(tlv.bss_color) != "int" || tlv.bss_color < 0 || tlv.bss_color > 0b00111111)
+		return null;
+
+	if (type(tlv.non_srg_obsspd_max_offset) != "int" || tlv.non_srg_obsspd_max_offset < 0 || tlv.non_srg_obsspd_max_offset > 0xff)
+		return null;
+
+	if (type(tlv.srg_obsspd_min_offset) != "int" || tlv.srg_obsspd_min_offset < 0 || tlv.srg_obsspd_min_offset > 0xff)
+		return null;
+
+	if (type(tlv.srg_obsspd_max_offset) != "int" || tlv.srg_obsspd_max_offset < 0 || tlv.srg_obsspd_max_offset > 0xff)
+		return null;
+
+	if (type(tlv.srg_bss_color_bitmap) != "int" || tlv.srg_bss_color_bitmap < 0 || tlv.srg_bss_color_bitmap > 0xffffffffffffffff)
+		return null;
+
+	if (type(tlv.srg_partial_bssid_bitmap) != "int" || tlv.srg_partial_bssid_bitmap < 0 || tlv.srg_partial_bssid_bitmap > 0xffffffffffffffff)
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', 0
+		| ((tlv.bss_color & 0b00111111) << 0)
+	);
+
+	buf.put('B', 0
+		| (tlv.hesiga_spatial_reuse_value15_allowed << 4)
+		| (tlv.srg_information_valid << 3)
+		| (tlv.non_srg_offset_valid << 2)
+		| (tlv.psr_disallowed << 0)
+	);
+
+	buf.put('B', tlv.non_srg_obsspd_max_offset);
+	buf.put('B', tlv.srg_obsspd_min_offset);
+	buf.put('B', tlv.srg_obsspd_max_offset);
+	buf.put('!Q', tlv.srg_bss_color_bitmap);
+	buf.put('!Q', tlv.srg_partial_bssid_bitmap);
+	buf.put('2x');
+
+	return buf;
+};
+
+// 0xd9 - Spatial Reuse Report
+// Wi-Fi EasyMesh
+encoder[0xd9] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (type(tlv.bss_color) != "int" || tlv.bss_color < 0 || tlv.bss_color > 0b00111111)
+		return null;
+
+	if (type(tlv.non_srg_obsspd_max_offset) != "int" || tlv.non_srg_obsspd_max_offset < 0 || tlv.non_srg_obsspd_max_offset > 0xff)
+		return null;
+
+	if (type(tlv.srg_obsspd_min_offset) != "int" || tlv.srg_obsspd_min_offset < 0 || tlv.srg_obsspd_min_offset > 0xff)
+		return null;
+
+	if (type(tlv.srg_obsspd_max_offset) != "int" || tlv.srg_obsspd_max_offset < 0 || tlv.srg_obsspd_max_offset > 0xff)
+		return null;
+
+	if (type(tlv.srg_bss_color_bitmap) != "int" || tlv.srg_bss_color_bitmap < 0 || tlv.srg_bss_color_bitmap > 0xffffffffffffffff)
+		return null;
+
+	if (type(tlv.srg_partial_bssid_bitmap) != "int" || tlv.srg_partial_bssid_bitmap < 0 || tlv.srg_partial_bssid_bitmap > 0xffffffffffffffff)
+		return null;
+
+	if (type(tlv.used_neighbor_bss_colors) != "int" || tlv.used_neighbor_bss_colors < 0 || tlv.used_neighbor_bss_colors > 0xffffffffffffffff)
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', 0
+		| (tlv.partial_bss_color << 6)
+		| ((tlv.bss_color & 0b00111111) << 0)
+	);
+
+	buf.put('B', 0
+		| (tlv.hesiga_spatial_reuse_value15_allowed << 4)
+		| (tlv.srg_information_valid << 3)
+		| (tlv.non_srg_offset_valid << 2)
+		| (tlv.psr_disallowed << 0)
+	);
+
+	buf.put('B', tlv.non_srg_obsspd_max_offset);
+	buf.put('B', tlv.srg_obsspd_min_offset);
+	buf.put('B', tlv.srg_obsspd_max_offset);
+	buf.put('!Q', tlv.srg_bss_color_bitmap);
+	buf.put('!Q', tlv.srg_partial_bssid_bitmap);
+	buf.put('!Q', tlv.used_neighbor_bss_colors);
+	buf.put('2x');
+
+	return buf;
+};
+
+// 0xda - Spatial Reuse Config Response
+// Wi-Fi EasyMesh
+encoder[0xda] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (!(tlv.response_code in [ 0x00, 0x01 ]))
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', tlv.response_code);
+
+	return buf;
+};
+
+// 0xdb - QoS Management Policy
+// Wi-Fi EasyMesh
+encoder[0xdb] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.mscs_disallowed_sta) != "array" || length(tlv.mscs_disallowed_sta) > 0xff)
+		return null;
+
+	if (type(tlv.scs_disallowed_sta) != "array" || length(tlv.scs_disallowed_sta) > 0xff)
+		return null;
+
+	buf.put('B', length(tlv.mscs_disallowed_sta));
+
+	for (let mscs_disallowed_sta_mac in tlv.mscs_disallowed_sta) {
+		const _mscs_disallowed_sta_mac = ether_aton(mscs_disallowed_sta_mac);
+
+		if (_mscs_disallowed_sta_mac == null)
+			return null;
+
+		buf.put('6s', _mscs_disallowed_sta_mac);
+	}
+
+	buf.put('B', length(tlv.scs_disallowed_sta));
+
+	for (let scs_disallowed_sta_mac in tlv.scs_disallowed_sta) {
+		const _scs_disallowed_sta_mac = ether_aton(scs_disallowed_sta_mac);
+
+		if (_scs_disallowed_sta_mac == null)
+			return null;
+
+		buf.put('6s', _scs_disallowed_sta_mac);
+	}
+
+	buf.put('20x');
+
+	return buf;
+};
+
+// 0xdc - QoS Management Descriptor
+// Wi-Fi EasyMesh
+encoder[0xdc] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.qmid) != "int" || tlv.qmid < 0 || tlv.qmid > 0xffff)
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	const client_mac = ether_aton(tlv.client_mac);
+
+	if (client_mac == null)
+		return null;
+
+	if (type(tlv.descriptor_element) != "string")
+		return null;
+
+	buf.put('!H', tlv.qmid);
+	buf.put('6s', bssid);
+	buf.put('6s', client_mac);
+	buf.put('*', tlv.descriptor_element);
+
+	return buf;
+};
+
+// 0xdd - Controller Capability
+// Wi-Fi EasyMesh
+encoder[0xdd] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	buf.put('B', 0
+		| (tlv.kib_mib_counter << 7)
+		| (tlv.early_ap_capability << 6)
+	);
+
+	return buf;
+};
+
+// -----------------------------------------------------------------------------
+// TLV DECODER ROUTINES
+// -----------------------------------------------------------------------------
+
+// 0xa9 - 1905 Layer Security Capability
+// Wi-Fi EasyMesh
+decoder[0xa9] = (buf, end) => {
+	if (buf.pos() + 3 > end)
+		return null;
+
+	const onboarding_protocol = buf.get('B');
+	const mic_algorithm = buf.get('B');
+	const encryption_algorithm = buf.get('B');
+
+	return {
+		onboarding_protocol,
+		mic_algorithm,
+		encryption_algorithm,
+	};
+};
+
+// 0xaa - AP Wi-Fi 6 Capabilities
+// Wi-Fi EasyMesh
+decoder[0xaa] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const roles_count = buf.get('B');
+	const roles = [];
+
+	for (let h = 0; h < roles_count; h++) {
+		if (buf.pos() + 6 > end)
+			return null;
+
+		const bitfield = buf.get('B');
+		const agent_role = (bitfield >> 6) & 0b00000011;
+		const he_160 = ((bitfield & 0b00100000) == 0b00100000);
+		const he_8080 = ((bitfield & 0b00010000) == 0b00010000);
+		const mcs_nss_length = bitfield & 0b00001111;
+
+		if (buf.pos() + mcs_nss_length > end)
+			return null;
+
+		const mcs_nss = buf.get(mcs_nss_length);
+
+		const bitfield2 = buf.get('B');
+		const su_beamformer = ((bitfield2 & 0b10000000) == 0b10000000);
+		const su_beamformee = ((bitfield2 & 0b01000000) == 0b01000000);
+		const mu_beamformer_status = ((bitfield2 & 0b00100000) == 0b00100000);
+		const beamformee_sts_less_80 = ((bitfield2 & 0b00010000) == 0b00010000);
+		const beamformee_sts_greater_80 = ((bitfield2 & 0b00001000) == 0b00001000);
+		const ul_mu_mimo = ((bitfield2 & 0b00000100) == 0b00000100);
+		const ul_ofdma = ((bitfield2 & 0b00000010) == 0b00000010);
+		const dl_ofdma = ((bitfield2 & 0b00000001) == 0b00000001);
+
+		const bitfield3 = buf.get('B');
+		const max_dl_mu_mimo_tx = (bitfield3 >> 4) & 0b00001111;
+		const max_ul_mu_mimo_rx = bitfield3 & 0b00001111;
+
+		const max_dl_ofdma_tx = buf.get('B');
+		const max_ul_ofdma_rx = buf.get('B');
+
+		const bitfield4 = buf.get('B');
+		const rts = ((bitfield4 & 0b10000000) == 0b10000000);
+		const mu_rts = ((bitfield4 & 0b01000000) == 0b01000000);
+		const multi_bssid = ((bitfield4 & 0b00100000) == 0b00100000);
+		const mu_edca = ((bitfield4 & 0b00010000) == 0b00010000);
+		const twt_requester = ((bitfield4 & 0b00001000) == 0b00001000);
+		const twt_responder = ((bitfield4 & 0b00000100) == 0b00000100);
+		const spatial_reuse = ((bitfield4 & 0b00000010) == 0b00000010);
+		const anticipated_channel_usage = ((bitfield4 & 0b00000001) == 0b00000001);
+
+		push(roles, {
+			agent_role,
+			he_160,
+			he_8080,
+			mcs_nss,
+			su_beamformer,
+			su_beamformee,
+			mu_beamformer_status,
+			beamformee_sts_less_80,
+			beamformee_sts_greater_80,
+			ul_mu_mimo,
+			ul_ofdma,
+			dl_ofdma,
+			max_dl_mu_mimo_tx,
+			max_ul_mu_mimo_rx,
+			max_dl_ofdma_tx,
+			max_ul_ofdma_rx,
+			rts,
+			mu_rts,
+			multi_bssid,
+			mu_edca,
+			twt_requester,
+			twt_responder,
+			spatial_reuse,
+			anticipated_channel_usage,
+		});
+	}
+
+	return {
+		radio_unique_identifier,
+		roles,
+	};
+};
+
+// 0xab - MIC
+// Wi-Fi EasyMesh
+decoder[0xab] = (buf, end) => {
+	if (buf.pos() + 15 > end)
+		return null;
+
+	const bitfield = buf.get('B');
+	const gtk_key_id = (bitfield >> 6) & 0b00000011;
+	const mic_version = (bitfield >> 4) & 0b00000011;
+
+	const integrity_transmission_counter = ((buf.get('!H') << 32) | buf.get('!L'));
+	const source_1905_al_mac_address = ether_ntoa(buf.get('6s'));
+	const mic_length = buf.get('!H');
+
+	if (buf.pos() + mic_length > end)
+		return null;
+
+	const mic = buf.get(mic_length);
+
+	return {
+		gtk_key_id,
+		mic_version,
+		integrity_transmission_counter,
+		source_1905_al_mac_address,
+		mic,
+	};
+};
+
+// 0xac - Encrypted
+// Wi-Fi EasyMesh
+decoder[0xac] = (buf, end) => {
+	if (buf.pos() + 20 > end)
+		return null;
+
+	const encryption_transmission_counter = ((buf.get('!H') << 32) | buf.get('!L'));
+	const source_1905_al_mac_address = ether_ntoa(buf.get('6s'));
+	const destination_1905_al_mac_address = ether_ntoa(buf.get('6s'));
+	const aes_siv_length = buf.get('!H');
+
+	if (buf.pos() + aes_siv_length > end)
+		return null;
+
+	const aes_siv = buf.get(aes_siv_length);
+
+	return {
+		encryption_transmission_counter,
+		source_1905_al_mac_address,
+		destination_1905_al_mac_address,
+		aes_siv,
+	};
+};
+
+// 0xb0 - Associated Wi-Fi 6 STA Status Report
+// Wi-Fi EasyMesh
+decoder[0xb0] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const mac_address = ether_ntoa(buf.get('6s'));
+	const n = buf.get('B');
+	const n2 = [];
+
+	for (let h = 0; h < n; h++) {
+		if (buf.pos() + 2 > end)
+			return null;
+
+		const tid = buf.get('B');
+		const queue_size = buf.get('B');
+
+		push(n2, {
+			tid,
+			queue_size,
+		});
+	}
+
+	return {
+		mac_address,
+		n2,
+	};
+};
+
+// 0xb7 - BSS Configuration Report TLV format BSSID
+// Wi-Fi EasyMesh
+decoder[0xb7] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const radios_count = buf.get('B');
+	const radios = [];
+
+	for (let h = 0; h < radios_count; h++) {
+		if (buf.pos() + 7 > end)
+			return null;
+
+		const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+		const bss_count = buf.get('B');
+		const bss = [];
+
+		for (let i = 0; i < bss_count; i++) {
+			if (buf.pos() + 9 > end)
+				return null;
+
+			const bssid = ether_ntoa(buf.get('6s'));
+
+			const bitfield = buf.get('B');
+			const backhaul = ((bitfield & 0b10000000) == 0b10000000);
+			const fronthaul = ((bitfield & 0b01000000) == 0b01000000);
+			const r1_disallowed_status = ((bitfield & 0b00100000) == 0b00100000);
+			const r2_disallowed_status = ((bitfield & 0b00010000) == 0b00010000);
+			const multiple_bssid = ((bitfield & 0b00001000) == 0b00001000);
+			const transmitted_bssid = ((bitfield & 0b00000100) == 0b00000100);
+
+			buf.get(1);
+
+			const ssid_length = buf.get('B');
+
+			if (buf.pos() + ssid_length > end)
+				return null;
+
+			const ssid = buf.get(ssid_length);
+
+			push(bss, {
+				bssid,
+				backhaul,
+				fronthaul,
+				r1_disallowed_status,
+				r2_disallowed_status,
+				multiple_bssid,
+				transmitted_bssid,
+				ssid,
+			});
+		}
+
+		push(radios, {
+			radio_unique_identifier,
+			bss,
+		});
+	}
+
+	return radios;
+};
+
+// 0xb8 - BSSID
+// Wi-Fi EasyMesh
+decoder[0xb8] = (buf, end) => {
+	if (buf.pos() + 6 > end)
+		return null;
+
+	const bssid = ether_ntoa(buf.get('6s'));
+
+	return bssid;
+};
+
+// 0xbb - BSS Configuration Request
+// Wi-Fi EasyMesh
+decoder[0xbb] = (buf, end) => buf.get(end - buf.pos());
+
+// 0xbd - BSS Configuration Response
+// Wi-Fi EasyMesh
+decoder[0xbd] = (buf, end) => buf.get(end - buf.pos());
+
+// 0xcc - AKM Suite Capabilities
+// Wi-Fi EasyMesh
+decoder[0xcc] = (buf, end) => {
+	if (buf.pos() + 2 > end)
+		return null;
+
+	const backhaul_akm_suite_selectors_count = buf.get('B');
+	const backhaul_akm_suite_selectors = [];
+
+	for (let h = 0; h < backhaul_akm_suite_selectors_count; h++) {
+		if (buf.pos() + 4 > end)
+			return null;
+
+		const bh_oui = buf.get(3);
+		const bh_akm_suite_type = buf.get('B');
+
+		push(backhaul_akm_suite_selectors, {
+			bh_oui,
+			bh_akm_suite_type,
+		});
+	}
+
+	const fronthaul_akm_suite_selectors_count = buf.get('B');
+	const fronthaul_akm_suite_selectors = [];
+
+	for (let h = 0; h < fronthaul_akm_suite_selectors_count; h++) {
+		if (buf.pos() + 4 > end)
+			return null;
+
+		const fh_oui = buf.get(3);
+		const fh_akm_suite_type = buf.get('B');
+
+		push(fronthaul_akm_suite_selectors, {
+			fh_oui,
+			fh_akm_suite_type,
+		});
+	}
+
+	return {
+		backhaul_akm_suite_selectors,
+		fronthaul_akm_suite_selectors,
+	};
+};
+
+// 0xcd - 1905 Encap DPP
+// Wi-Fi EasyMesh
+decoder[0xcd] = (buf, end) => {
+	if (buf.pos() + 10 > end)
+		return null;
+
+	const bitfield = buf.get('B');
+	const enrollee_mac_address_present = ((bitfield & 0b10000000) == 0b10000000);
+	const dpp_frame_indicator = ((bitfield & 0b00100000) == 0b00100000);
+
+	const destination_sta_mac_address = ether_ntoa(buf.get('6s'));
+	const frame_type = buf.get('B');
+	const encapsulated_frame_length = buf.get('!H');
+
+	if (buf.pos() + encapsulated_frame_length > end)
+		return null;
+
+	const encapsulated_frame = buf.get(`${encapsulated_frame_length}Z`);
+
+	return {
+		enrollee_mac_address_present,
+		dpp_frame_indicator,
+		destination_sta_mac_address,
+		frame_type,
+		encapsulated_frame,
+	};
+};
+
+// 0xce - 1905 Encap EAPOL
+// Wi-Fi EasyMesh
+decoder[0xce] = (buf, end) => buf.get(end - buf.pos());
+
+// 0xcf - DPP Bootstrapping URI Notification
+// Wi-Fi EasyMesh
+decoder[0xcf] = (buf, end) => {
+	if (buf.pos() + 18 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const bssid = ether_ntoa(buf.get('6s'));
+	const backhaul_sta_address = ether_ntoa(buf.get('6s'));
+	const dpp_uri = buf.get('*');
+
+	return {
+		radio_unique_identifier,
+		bssid,
+		backhaul_sta_address,
+		dpp_uri,
+	};
+};
+
+// 0xd1 - DPP Message
+// Wi-Fi EasyMesh
+decoder[0xd1] = (buf, end) => buf.get(end - buf.pos());
+
+// 0xd2 - DPP CCE Indication
+// Wi-Fi EasyMesh
+decoder[0xd2] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const advertise_cce = buf.get('B');
+
+	if (!exists(defs.ADVERTISE_CCE, advertise_cce))
+		return null;
+
+	return {
+		advertise_cce,
+		advertise_cce_name: defs.ADVERTISE_CCE[advertise_cce],
+	};
+};
+
+// 0xd3 - DPP Chirp Value
+// Wi-Fi EasyMesh
+decoder[0xd3] = (buf, end) => {
+	if (buf.pos() + 8 > end)
+		return null;
+
+	const bitfield = buf.get('B');
+	const enrollee_mac_address_present = ((bitfield & 0b10000000) == 0b10000000);
+	const hash_validity = ((bitfield & 0b01000000) == 0b01000000);
+
+	const destination_sta_mac_address = ether_ntoa(buf.get('6s'));
+	const hash_length = buf.get('B');
+
+	if (buf.pos() + hash_length > end)
+		return null;
+
+	const hash_value = buf.get(hash_length);
+
+	return {
+		enrollee_mac_address_present,
+		hash_validity,
+		destination_sta_mac_address,
+		hash_value,
+	};
+};
+
+// 0xd4 - Device Inventory
+// Wi-Fi EasyMesh
+decoder[0xd4] = (buf, end) => {
+	if (buf.pos() + 4 > end)
+		return null;
+
+	const serial_number_length = buf.get('B');
+
+	if (buf.pos() + serial_number_length > end)
+		return null;
+
+	const serial_number = buf.get(serial_number_length);
+	const length = buf.get('B');
+
+	if (buf.pos() + length > end)
+		return null;
+
+	const software_version = buf.get(length);
+	const execution_env_length = buf.get('B');
+
+	if (buf.pos() + execution_env_length > end)
+		return null;
+
+	const execution_env = buf.get(execution_env_length);
+	const radios_count = buf.get('B');
+	const radios = [];
+
+	for (let h = 0; h < radios_count; h++) {
+		if (buf.pos() + 7 > end)
+			return null;
+
+		const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+		const chipset_vendor_length = buf.get('B');
+
+		if (buf.pos() + chipset_vendor_length > end)
+			return null;
+
+		const chipset_vendor = buf.get(chipset_vendor_length);
+
+		push(radios, {
+			radio_unique_identifier,
+			chipset_vendor,
+		});
+	}
+
+	return {
+		serial_number,
+		software_version,
+		execution_env,
+		radios,
+	};
+};
+
+// 0xd5 - Agent List
+// Wi-Fi EasyMesh
+decoder[0xd5] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const multi_ap_agents_present_count = buf.get('B');
+	const multi_ap_agents_present = [];
+
+	for (let h = 0; h < multi_ap_agents_present_count; h++) {
+		if (buf.pos() + 8 > end)
+			return null;
+
+		const mac_address = ether_ntoa(buf.get('6s'));
+		const multi_ap_profile = buf.get('B');
+
+		if (!exists(defs.MULTI_AP_PROFILE, multi_ap_profile))
+			return null;
+
+		const security = buf.get('B');
+
+		if (security > 0xff)
+			return null;
+
+		push(multi_ap_agents_present, {
+			mac_address,
+			multi_ap_profile,
+			multi_ap_profile_name: defs.MULTI_AP_PROFILE[multi_ap_profile],
+			security,
+		});
+	}
+
+	return multi_ap_agents_present;
+};
+
+// 0xd6 - Anticipated Channel Preference
+// Wi-Fi EasyMesh
+decoder[0xd6] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const opclass_count = buf.get('B');
+	const opclasses = [];
+
+	for (let h = 0; h < opclass_count; h++) {
+		if (buf.pos() + 6 > end)
+			return null;
+
+		const opclass = buf.get('B');
+		const channels_count = buf.get('B');
+		const channels = [];
+
+		for (let i = 0; i < channels_count; i++) {
+			if (buf.pos() + 1 > end)
+				return null;
+
+			push(channels, buf.get('B'));
+		}
+
+		buf.get(4);
+		push(opclasses, {
+			opclass,
+			channels,
+		});
+	}
+
+	return opclasses;
+};
+
+// 0xd7 - Anticipated Channel Usage
+// Wi-Fi EasyMesh
+decoder[0xd7] = (buf, end) => {
+	if (buf.pos() + 13 > end)
+		return null;
+
+	const opclass = buf.get('B');
+	const channel = buf.get('B');
+	const reference_bssid = ether_ntoa(buf.get('6s'));
+	const usage_entries_count = buf.get('B');
+	const burst_start_time = buf.get('!L');
+	const usage_entries = [];
+
+	for (let h = 0; h < usage_entries_count; h++) {
+		if (buf.pos() + 25 > end)
+			return null;
+
+		const burst_length = buf.get('!L');
+		const repetitions_count = buf.get('!L');
+		const burst_interval = buf.get('!L');
+		const ru_bitmask_length = buf.get('B');
+
+		if (buf.pos() + ru_bitmask_length > end)
+			return null;
+
+		const ru_bitmask = buf.get(ru_bitmask_length);
+		const transmitter_identifier = ether_ntoa(buf.get('6s'));
+		const power_level = buf.get('B');
+		const channel_usage_reason = buf.get('B');
+
+		buf.get(4);
+		push(usage_entries, {
+			burst_length,
+			repetitions_count,
+			burst_interval,
+			ru_bitmask,
+			transmitter_identifier,
+			power_level,
+			channel_usage_reason,
+		});
+	}
+
+	return {
+		opclass,
+		channel,
+		reference_bssid,
+		burst_start_time,
+		usage_entries,
+	};
+};
+
+// 0xd8 - Spatial Reuse Request
+// Wi-Fi EasyMesh
+decoder[0xd8] = (buf, end) => {
+	if (buf.pos() + 29 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+
+	const bitfield = buf.get('B');
+	const bss_color = bitfield & 0b00111111;
+
+	const bitfield2 = buf.get('B');
+	const hesiga_spatial_reuse_value15_allowed = ((bitfield2 & 0b00010000) == 0b00010000);
+	const srg_information_valid = ((bitfield2 & 0b00001000) == 0b00001000);
+	const non_srg_offset_valid = ((bitfield2 & 0b00000100) == 0b00000100);
+	const psr_disallowed = ((bitfield2 & 0b00000001) == 0b00000001);
+
+	const non_srg_obsspd_max_offset = buf.get('B');
+	const srg_obsspd_min_offset = buf.get('B');
+	const srg_obsspd_max_offset = buf.get('B');
+	const srg_bss_color_bitmap = buf.get('!Q');
+	const srg_partial_bssid_bitmap = buf.get('!Q');
+
+	buf.get(2);
+
+	return {
+		radio_unique_identifier,
+		bss_color,
+		hesiga_spatial_reuse_value15_allowed,
+		srg_information_valid,
+		non_srg_offset_valid,
+		psr_disallowed,
+		non_srg_obsspd_max_offset,
+		srg_obsspd_min_offset,
+		srg_obsspd_max_offset,
+		srg_bss_color_bitmap,
+		srg_partial_bssid_bitmap,
+	};
+};
+
+// 0xd9 - Spatial Reuse Report
+// Wi-Fi EasyMesh
+decoder[0xd9] = (buf, end) => {
+	if (buf.pos() + 37 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+
+	const bitfield = buf.get('B');
+	const partial_bss_color = ((bitfield & 0b01000000) == 0b01000000);
+	const bss_color = bitfield & 0b00111111;
+
+	const bitfield2 = buf.get('B');
+	const hesiga_spatial_reuse_value15_allowed = ((bitfield2 & 0b00010000) == 0b00010000);
+	const srg_information_valid = ((bitfield2 & 0b00001000) == 0b00001000);
+	const non_srg_offset_valid = ((bitfield2 & 0b00000100) == 0b00000100);
+	const psr_disallowed = ((bitfield2 & 0b00000001) == 0b00000001);
+
+	const non_srg_obsspd_max_offset = buf.get('B');
+	const srg_obsspd_min_offset = buf.get('B');
+	const srg_obsspd_max_offset = buf.get('B');
+	const srg_bss_color_bitmap = buf.get('!Q');
+	const srg_partial_bssid_bitmap = buf.get('!Q');
+	const used_neighbor_bss_colors = buf.get('!Q');
+
+	buf.get(2);
+
+	return {
+		radio_unique_identifier,
+		partial_bss_color,
+		bss_color,
+		hesiga_spatial_reuse_value15_allowed,
+		srg_information_valid,
+		non_srg_offset_valid,
+		psr_disallowed,
+		non_srg_obsspd_max_offset,
+		srg_obsspd_min_offset,
+		srg_obsspd_max_offset,
+		srg_bss_color_bitmap,
+		srg_partial_bssid_bitmap,
+		used_neighbor_bss_colors,
+	};
+};
+
+// 0xda - Spatial Reuse Config Response
+// Wi-Fi EasyMesh
+decoder[0xda] = (buf, end) => {
+	if (buf.pos() + 7 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const response_code = buf.get('B');
+
+	if (!exists(defs.RESPONSE_CODE, response_code))
+		return null;
+
+	return {
+		radio_unique_identifier,
+		response_code,
+		response_code_name: defs.RESPONSE_CODE[response_code],
+	};
+};
+
+// 0xdb - QoS Management Policy
+// Wi-Fi EasyMesh
+decoder[0xdb] = (buf, end) => {
+	if (buf.pos() + 22 > end)
+		return null;
+
+	const mscs_disallowed_sta_count = buf.get('B');
+	const mscs_disallowed_sta = [];
+
+	for (let h = 0; h < mscs_disallowed_sta_count; h++) {
+		if (buf.pos() + 6 > end)
+			return null;
+
+		const mscs_disallowed_sta_mac = ether_ntoa(buf.get('6s'));
+
+		push(mscs_disallowed_sta, mscs_disallowed_sta_mac);
+	}
+
+	const scs_disallowed_sta_count = buf.get('B');
+	const scs_disallowed_sta = [];
+
+	for (let h = 0; h < scs_disallowed_sta_count; h++) {
+		if (buf.pos() + 6 > end)
+			return null;
+
+		const scs_disallowed_sta_mac = ether_ntoa(buf.get('6s'));
+
+		push(scs_disallowed_sta, scs_disallowed_sta_mac);
+	}
+
+	buf.get(20);
+
+	return {
+		mscs_disallowed_sta,
+		scs_disallowed_sta,
+	};
+};
+
+// 0xdc - QoS Management Descriptor
+// Wi-Fi EasyMesh
+decoder[0xdc] = (buf, end) => {
+	if (buf.pos() + 14 > end)
+		return null;
+
+	const qmid = buf.get('!H');
+	const bssid = ether_ntoa(buf.get('6s'));
+	const client_mac = ether_ntoa(buf.get('6s'));
+	const descriptor_element = buf.get('*');
+
+	return {
+		qmid,
+		bssid,
+		client_mac,
+		descriptor_element,
+	};
+};
+
+// 0xdd - Controller Capability
+// Wi-Fi EasyMesh
+decoder[0xdd] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const bitfield = buf.get('B');
+	const kib_mib_counter = ((bitfield & 0b10000000) == 0b10000000);
+	const early_ap_capability = ((bitfield & 0b01000000) == 0b01000000);
+
+	return {
+		kib_mib_counter,
+		early_ap_capability,
+	};
+};
+
+// -----------------------------------------------------------------------------
+// TLV EXTENDED ENCODER ROUTINES
+// -----------------------------------------------------------------------------
+
+// 0x0001 - AP Radio VBSS Capabilities
+// Wi-Fi EasyMesh
+extended_encoder[0x0001] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (type(tlv.max_vbss) != "int" || tlv.max_vbss < 0 || tlv.max_vbss > 0xff)
+		return null;
+
+	if (type(tlv.fixed_bits_mask) != "string" || length(tlv.fixed_bits_mask) > 6)
+		return null;
+
+	if (type(tlv.fixed_bits_value) != "string" || length(tlv.fixed_bits_value) > 6)
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', tlv.max_vbss);
+	buf.put('B', 0
+		| (tlv.vbsss_subtract << 7)
+		| (tlv.vbssid_restrictions << 6)
+		| (tlv.vbssid_match_mask_restrictions << 5)
+		| (tlv.fixed_bits_restrictions << 4)
+	);
+
+	buf.put('6s', tlv.fixed_bits_mask);
+	buf.put('6s', tlv.fixed_bits_value);
+
+	return buf;
+};
+
+// 0x0002 - Virtual BSS Creation
+// Wi-Fi EasyMesh
+extended_encoder[0x0002] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	if (type(tlv.ssid) != "string" || length(tlv.ssid) > 0xffff)
+		return null;
+
+	if (type(tlv.pass) != "string" || length(tlv.pass) > 0xffff)
+		return null;
+
+	if (type(tlv.dpp_connector) != "string" || length(tlv.dpp_connector) > 0xffff)
+		return null;
+
+	const client_mac = ether_aton(tlv.client_mac);
+
+	if (client_mac == null)
+		return null;
+
+	if (type(tlv.client_assoc) != "int" || tlv.client_assoc < 0 || tlv.client_assoc > 0xff)
+		return null;
+
+	if (type(tlv.key) != "string" || length(tlv.key) > 0xffff)
+		return null;
+
+	if (type(tlv.tx_packet_number) != "int" || tlv.tx_packet_number < 0 || tlv.tx_packet_number > 0xffffffffffffffff)
+		return null;
+
+	if (type(tlv.group_key) != "string" || length(tlv.group_key) > 0xffff)
+		return null;
+
+	if (type(tlv.group_tx_packet_number) != "int" || tlv.group_tx_packet_number < 0 || tlv.group_tx_packet_number > 0xffffffffffffffff)
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('6s', bssid);
+	buf.put('!H', length(tlv.ssid));
+	buf.put('*', tlv.ssid);
+	buf.put('!H', length(tlv.pass));
+	buf.put('*', tlv.pass);
+	buf.put('!H', length(tlv.dpp_connector));
+	buf.put('*', tlv.dpp_connector);
+	buf.put('6s', client_mac);
+	buf.put('B', tlv.client_assoc);
+	buf.put('!H', length(tlv.key));
+	buf.put('*', tlv.key);
+	buf.put('!Q', tlv.tx_packet_number);
+	buf.put('!H', length(tlv.group_key));
+	buf.put('*', tlv.group_key);
+	buf.put('!Q', tlv.group_tx_packet_number);
+
+	return buf;
+};
+
+// 0x0003 - Virtual BSS Destruction
+// Wi-Fi EasyMesh
+extended_encoder[0x0003] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	if (type(tlv.disassociate_client) != "int" || tlv.disassociate_client < 0 || tlv.disassociate_client > 0xff)
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('6s', bssid);
+	buf.put('B', tlv.disassociate_client);
+
+	return buf;
+};
+
+// 0x0004 - Virtual BSS Event
+// Wi-Fi EasyMesh
+extended_encoder[0x0004] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	const radio_unique_identifier = ether_aton(tlv.radio_unique_identifier);
+
+	if (radio_unique_identifier == null)
+		return null;
+
+	if (type(tlv.success) != "int" || tlv.success < 0 || tlv.success > 0xff)
+		return null;
+
+	const bssid = ether_aton(tlv.bssid);
+
+	if (bssid == null)
+		return null;
+
+	buf.put('6s', radio_unique_identifier);
+	buf.put('B', tlv.success);
+	buf.put('6s', bssid);
+
+	return buf;
+};
+
+// 0x0005 - Client Security Context
+// Wi-Fi EasyMesh
+extended_encoder[0x0005] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.key) != "string" || length(tlv.key) > 0xffff)
+		return null;
+
+	if (type(tlv.tx_packet_number) != "int" || tlv.tx_packet_number < 0 || tlv.tx_packet_number > 0xffffffffffffffff)
+		return null;
+
+	if (type(tlv.group_key) != "string" || length(tlv.group_key) > 0xffff)
+		return null;
+
+	if (type(tlv.group_tx_packet_number) != "int" || tlv.group_tx_packet_number < 0 || tlv.group_tx_packet_number > 0xffffffffffffffff)
+		return null;
+
+	buf.put('B', 0
+		| (tlv.client_connected << 7)
+	);
+
+	buf.put('!H', length(tlv.key));
+	buf.put('*', tlv.key);
+	buf.put('!Q', tlv.tx_packet_number);
+	buf.put('!H', length(tlv.group_key));
+	buf.put('*', tlv.group_key);
+	buf.put('!Q', tlv.group_tx_packet_number);
+
+	return buf;
+};
+
+// 0x0006 - Trigger Channel Switch Announcement
+// Wi-Fi EasyMesh
+extended_encoder[0x0006] = (buf, tlv) => {
+	if (type(tlv) != "object")
+		return null;
+
+	if (type(tlv.csa_channel) != "int" || tlv.csa_channel < 0 || tlv.csa_channel > 0xff)
+		return null;
+
+	if (type(tlv.op_class) != "int" || tlv.op_class < 0 || tlv.op_class > 0xff)
+		return null;
+
+	buf.put('B', tlv.csa_channel);
+	buf.put('B', tlv.op_class);
+
+	return buf;
+};
+
+// 0x0007 - VBSS Configuration Report
+// Wi-Fi EasyMesh
+extended_encoder[0x0007] = (buf, radios) => {
+	if (type(radios) != "array" || length(radios) > 0xff)
+		return null;
+
+	buf.put('B', length(radios));
+
+	for (let item in radios) {
+		if (type(item) != "object")
+			return null;
+
+		const radio_unique_identifier = ether_aton(item.radio_unique_identifier);
+
+		if (radio_unique_identifier == null)
+			return null;
+
+		if (type(item.vbss) != "array" || length(item.vbss) > 0xff)
+			return null;
+
+		buf.put('6s', radio_unique_identifier);
+		buf.put('B', length(item.vbss));
+
+		for (let item2 in item.vbss) {
+			if (type(item2) != "object")
+				return null;
+
+			const bssid = ether_aton(item2.bssid);
+
+			if (bssid == null)
+				return null;
+
+			if (type(item2.ssid) != "string" || length(item2.ssid) > 0xff)
+				return null;
+
+			buf.put('6s', bssid);
+			buf.put('B', length(item2.ssid));
+			buf.put('*', item2.ssid);
+		}
+	}
+
+	return buf;
+};
+
+// -----------------------------------------------------------------------------
+// TLV EXTENDED DECODER ROUTINES
+// -----------------------------------------------------------------------------
+
+// 0x0001 - AP Radio VBSS Capabilities
+// Wi-Fi EasyMesh
+extended_decoder[0x0001] = (buf, end) => {
+	if (buf.pos() + 20 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const max_vbss = buf.get('B');
+
+	const bitfield = buf.get('B');
+	const vbsss_subtract = ((bitfield & 0b10000000) == 0b10000000);
+	const vbssid_restrictions = ((bitfield & 0b01000000) == 0b01000000);
+	const vbssid_match_mask_restrictions = ((bitfield & 0b00100000) == 0b00100000);
+	const fixed_bits_restrictions = ((bitfield & 0b00010000) == 0b00010000);
+
+	const fixed_bits_mask = buf.get(6);
+	const fixed_bits_value = buf.get(6);
+
+	return {
+		radio_unique_identifier,
+		max_vbss,
+		vbsss_subtract,
+		vbssid_restrictions,
+		vbssid_match_mask_restrictions,
+		fixed_bits_restrictions,
+		fixed_bits_mask,
+		fixed_bits_value,
+	};
+};
+
+// 0x0002 - Virtual BSS Creation
+// Wi-Fi EasyMesh
+extended_decoder[0x0002] = (buf, end) => {
+	if (buf.pos() + 45 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const bssid = ether_ntoa(buf.get('6s'));
+	const ssid_length = buf.get('!H');
+
+	if (buf.pos() + ssid_length > end)
+		return null;
+
+	const ssid = buf.get(ssid_length);
+	const pass_length = buf.get('!H');
+
+	if (buf.pos() + pass_length > end)
+		return null;
+
+	const pass = buf.get(pass_length);
+	const dpp_connector_length = buf.get('!H');
+
+	if (buf.pos() + dpp_connector_length > end)
+		return null;
+
+	const dpp_connector = buf.get(dpp_connector_length);
+	const client_mac = ether_ntoa(buf.get('6s'));
+	const client_assoc = buf.get('B');
+	const key_length = buf.get('!H');
+
+	if (buf.pos() + key_length > end)
+		return null;
+
+	const key = buf.get(key_length);
+	const tx_packet_number = buf.get('!Q');
+	const group_key_length = buf.get('!H');
+
+	if (buf.pos() + group_key_length > end)
+		return null;
+
+	const group_key = buf.get(group_key_length);
+	const group_tx_packet_number = buf.get('!Q');
+
+	return {
+		radio_unique_identifier,
+		bssid,
+		ssid,
+		pass,
+		dpp_connector,
+		client_mac,
+		client_assoc,
+		key,
+		tx_packet_number,
+		group_key,
+		group_tx_packet_number,
+	};
+};
+
+// 0x0003 - Virtual BSS Destruction
+// Wi-Fi EasyMesh
+extended_decoder[0x0003] = (buf, end) => {
+	if (buf.pos() + 13 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const bssid = ether_ntoa(buf.get('6s'));
+	const disassociate_client = buf.get('B');
+
+	return {
+		radio_unique_identifier,
+		bssid,
+		disassociate_client,
+	};
+};
+
+// 0x0004 - Virtual BSS Event
+// Wi-Fi EasyMesh
+extended_decoder[0x0004] = (buf, end) => {
+	if (buf.pos() + 13 > end)
+		return null;
+
+	const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+	const success = buf.get('B');
+	const bssid = ether_ntoa(buf.get('6s'));
+
+	return {
+		radio_unique_identifier,
+		success,
+		bssid,
+	};
+};
+
+// 0x0005 - Client Security Context
+// Wi-Fi EasyMesh
+extended_decoder[0x0005] = (buf, end) => {
+	if (buf.pos() + 21 > end)
+		return null;
+
+	const bitfield = buf.get('B');
+	const client_connected = ((bitfield & 0b10000000) == 0b10000000);
+
+	const key_length = buf.get('!H');
+
+	if (buf.pos() + key_length > end)
+		return null;
+
+	const key = buf.get(key_length);
+	const tx_packet_number = buf.get('!Q');
+	const group_key_length = buf.get('!H');
+
+	if (buf.pos() + group_key_length > end)
+		return null;
+
+	const group_key = buf.get(group_key_length);
+	const group_tx_packet_number = buf.get('!Q');
+
+	return {
+		client_connected,
+		key,
+		tx_packet_number,
+		group_key,
+		group_tx_packet_number,
+	};
+};
+
+// 0x0006 - Trigger Channel Switch Announcement
+// Wi-Fi EasyMesh
+extended_decoder[0x0006] = (buf, end) => {
+	if (buf.pos() + 2 > end)
+		return null;
+
+	const csa_channel = buf.get('B');
+	const op_class = buf.get('B');
+
+	return {
+		csa_channel,
+		op_class,
+	};
+};
+
+// 0x0007 - VBSS Configuration Report
+// Wi-Fi EasyMesh
+extended_decoder[0x0007] = (buf, end) => {
+	if (buf.pos() + 1 > end)
+		return null;
+
+	const radios_count = buf.get('B');
+	const radios = [];
+
+	for (let h = 0; h < radios_count; h++) {
+		if (buf.pos() + 7 > end)
+			return null;
+
+		const radio_unique_identifier = ether_ntoa(buf.get('6s'));
+		const vbss_count = buf.get('B');
+		const vbss = [];
+
+		for (let i = 0; i < vbss_count; i++) {
+			if (buf.pos() + 7 > end)
+				return null;
+
+			const bssid = ether_ntoa(buf.get('6s'));
+			const ssid_length = buf.get('B');
+
+			if (buf.pos() + ssid_length > end)
+				return null;
+
+			const ssid = buf.get(ssid_length);
+
+			push(vbss, {
+				bssid,
+				ssid,
+			});
+		}
+
+		push(radios, {
+			radio_unique_identifier,
+			vbss,
+		});
+	}
+
+	return radios;
+};
+
+return { encoder, decoder, extended_encoder, extended_decoder };
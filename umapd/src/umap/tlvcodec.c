@@ -0,0 +1,1178 @@
+/*
+ * Copyright (c) 2025 Jo-Philipp Wich <jo@mein.io>.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Native implementations of the most frequently used TLV codec routines.
+ *
+ * The exported `decoder`, `encoder`, `extended_decoder` and `extended_encoder`
+ * arrays follow the calling conventions of the generated routines in
+ * `umap/tlv/codec/`: decoders are invoked with a struct buffer positioned
+ * at the start of the TLV payload and the absolute end offset, encoders are
+ * invoked with a struct buffer followed by the value to encode and return
+ * the buffer on success.
+ *
+ * Types not covered here are left unset, the ucode codec merges the native
+ * routines into its own tables and keeps its implementation for the rest.
+ */
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <arpa/inet.h>
+
+#include <ucode/module.h>
+
+
+#define REGISTRY_DEFS_KEY "umap.tlvcodec.defs"
+
+typedef struct {
+	const uint8_t *pos, *end;
+} tlv_reader_t;
+
+typedef uc_value_t *(*tlv_decode_fn_t)(uc_vm_t *, tlv_reader_t *);
+typedef bool (*tlv_encode_fn_t)(uc_vm_t *, uc_stringbuf_t *, uc_value_t *);
+
+
+static uc_value_t *
+buf_invoke(uc_vm_t *vm, uc_value_t *buf, const char *method,
+           size_t nargs, ...)
+{
+	uc_value_t *fn = ucv_object_get(ucv_prototype_get(buf), method, NULL);
+	va_list ap;
+
+	if (!ucv_is_callable(fn))
+		return NULL;
+
+	uc_vm_stack_push(vm, ucv_get(buf));
+	uc_vm_stack_push(vm, ucv_get(fn));
+
+	va_start(ap, nargs);
+
+	for (size_t i = 0; i < nargs; i++)
+		uc_vm_stack_push(vm, va_arg(ap, uc_value_t *));
+
+	va_end(ap);
+
+	if (uc_vm_call(vm, true, nargs) != EXCEPTION_NONE)
+		return NULL;
+
+	return uc_vm_stack_pop(vm);
+}
+
+static uc_value_t *
+enum_name(uc_vm_t *vm, const char *table, unsigned int value)
+{
+	uc_value_t *defs = uc_vm_registry_get(vm, REGISTRY_DEFS_KEY);
+	char key[sizeof("4294967295")];
+
+	snprintf(key, sizeof(key), "%u", value);
+
+	return ucv_object_get(ucv_object_get(defs, table, NULL), key, NULL);
+}
+
+
+static bool
+rd_avail(tlv_reader_t *rd, size_t len)
+{
+	return (rd->pos + len <= rd->end);
+}
+
+static uint8_t
+rd_u8(tlv_reader_t *rd)
+{
+	return *rd->pos++;
+}
+
+static uint16_t
+rd_u16(tlv_reader_t *rd)
+{
+	uint16_t v = (rd->pos[0] << 8) | rd->pos[1];
+
+	rd->pos += 2;
+
+	return v;
+}
+
+static uint32_t
+rd_u32(tlv_reader_t *rd)
+{
+	uint32_t v = ((uint32_t)rd->pos[0] << 24) | (rd->pos[1] << 16) |
+	             (rd->pos[2] << 8) | rd->pos[3];
+
+	rd->pos += 4;
+
+	return v;
+}
+
+static uc_value_t *
+rd_bytes(tlv_reader_t *rd, size_t len)
+{
+	uc_value_t *v = ucv_string_new_length((const char *)rd->pos, len);
+
+	rd->pos += len;
+
+	return v;
+}
+
+static uc_value_t *
+rd_mac(tlv_reader_t *rd)
+{
+	static const char hex[] = "0123456789abcdef";
+	char mac[17];
+
+	for (size_t i = 0; i < 6; i++) {
+		mac[i * 3 + 0] = hex[rd->pos[i] >> 4];
+		mac[i * 3 + 1] = hex[rd->pos[i] & 15];
+
+		if (i < 5)
+			mac[i * 3 + 2] = ':';
+	}
+
+	rd->pos += 6;
+
+	return ucv_string_new_length(mac, sizeof(mac));
+}
+
+static uc_value_t *
+rd_ip(tlv_reader_t *rd, int family)
+{
+	char addr[INET6_ADDRSTRLEN];
+	size_t len = (family == AF_INET6) ? 16 : 4;
+
+	if (!inet_ntop(family, rd->pos, addr, sizeof(addr)))
+		addr[0] = 0;
+
+	rd->pos += len;
+
+	return ucv_string_new(addr);
+}
+
+
+static bool
+parse_mac(uc_value_t *v, uint8_t *mac)
+{
+	const char *s = ucv_string_get(v);
+
+	if (ucv_type(v) != UC_STRING || ucv_string_length(v) != 17)
+		return false;
+
+	for (size_t i = 0; i < 6; i++) {
+		uint8_t b = 0;
+
+		for (size_t j = 0; j < 2; j++) {
+			char c = s[i * 3 + j];
+
+			b <<= 4;
+
+			if (c >= '0' && c <= '9')
+				b |= c - '0';
+			else if (c >= 'a' && c <= 'f')
+				b |= c - 'a' + 10;
+			else if (c >= 'A' && c <= 'F')
+				b |= c - 'A' + 10;
+			else
+				return false;
+		}
+
+		if (i < 5 && s[i * 3 + 2] != ':')
+			return false;
+
+		mac[i] = b;
+	}
+
+	return true;
+}
+
+static bool
+get_uint(uc_value_t *v, uint32_t max, uint64_t *res)
+{
+	int64_t n;
+
+	if (ucv_type(v) != UC_INTEGER)
+		return false;
+
+	n = ucv_int64_get(v);
+
+	if (n < 0 || n > max)
+		return false;
+
+	*res = n;
+
+	return true;
+}
+
+static bool
+is_media_type(uc_value_t *v)
+{
+	static const uint16_t media_types[] = {
+		0x0000, 0x0001, 0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105,
+		0x0106, 0x0107, 0x0108, 0x0200, 0x0201, 0x0300, 0xffff
+	};
+
+	if (ucv_type(v) != UC_INTEGER)
+		return false;
+
+	for (size_t i = 0; i < ARRAY_SIZE(media_types); i++)
+		if (ucv_int64_get(v) == media_types[i])
+			return true;
+
+	return false;
+}
+
+static uint8_t
+get_flag(uc_value_t *v, int shift)
+{
+	if (ucv_type(v) == UC_BOOLEAN)
+		return ucv_boolean_get(v) << shift;
+
+	return (ucv_to_integer(v) << shift) & 0xff;
+}
+
+static void
+wr_u8(uc_stringbuf_t *sb, uint8_t v)
+{
+	printbuf_memappend_fast(sb, (char *)&v, 1);
+}
+
+static void
+wr_u16(uc_stringbuf_t *sb, uint16_t v)
+{
+	uint8_t b[2] = { v >> 8, v };
+
+	printbuf_memappend_fast(sb, (char *)b, sizeof(b));
+}
+
+static void
+wr_u32(uc_stringbuf_t *sb, uint32_t v)
+{
+	uint8_t b[4] = { v >> 24, v >> 16, v >> 8, v };
+
+	printbuf_memappend_fast(sb, (char *)b, sizeof(b));
+}
+
+static bool
+wr_mac(uc_stringbuf_t *sb, uc_value_t *v)
+{
+	uint8_t mac[6];
+
+	if (!parse_mac(v, mac))
+		return false;
+
+	printbuf_memappend_fast(sb, (char *)mac, sizeof(mac));
+
+	return true;
+}
+
+
+/* 0x01 - 1905.1 AL MAC address, 0x02 - MAC address,
+ * 0x82 - AP Radio Identifier */
+static uc_value_t *
+decode_mac(uc_vm_t *vm, tlv_reader_t *rd)
+{
+	if (!rd_avail(rd, 6))
+		return NULL;
+
+	return rd_mac(rd);
+}
+
+/* 0x03 - 1905.1 device information */
+static uc_value_t *
+decode_device_information(uc_vm_t *vm, tlv_reader_t *rd)
+{
+	uc_value_t *rv, *ifaces, *al_mac;
+	size_t count;
+
+	if (!rd_avail(rd, 7))
+		return NULL;
+
+	al_mac = rd_mac(rd);
+	count = rd_u8(rd);
+	ifaces = ucv_array_new_length(vm, count);
+
+	for (size_t h = 0; h < count; h++) {
+		uc_value_t *iface, *mac, *name;
+		uint16_t media_type;
+		size_t octets;
+
+		if (!rd_avail(rd, 9))
+			goto fail;
+
+		mac = rd_mac(rd);
+		media_type = rd_u16(rd);
+		name = enum_name(vm, "MEDIA_TYPE", media_type);
+		octets = rd_u8(rd);
+
+		if (!name || !rd_avail(rd, octets)) {
+			ucv_put(mac);
+			goto fail;
+		}
+
+		iface = ucv_object_new(vm);
+		ucv_object_add(iface, "local_if_mac_address", mac);
+		ucv_object_add(iface, "media_type", ucv_int64_new(media_type));
+		ucv_object_add(iface, "media_type_name", ucv_get(name));
+		ucv_object_add(iface, "media_specific_information", rd_bytes(rd, octets));
+		ucv_array_push(ifaces, iface);
+	}
+
+	rv = ucv_object_new(vm);
+	ucv_object_add(rv, "al_mac_address", al_mac);
+	ucv_object_add(rv, "local_interfaces", ifaces);
+
+	return rv;
+
+fail:
+	ucv_put(al_mac);
+	ucv_put(ifaces);
+
+	return NULL;
+}
+
+/* 0x06 - Non-1905 neighbor devices */
+static uc_value_t *
+decode_non1905_neighbor_devices(uc_vm_t *vm, tlv_reader_t *rd)
+{
+	uc_value_t *rv, *neighbors;
+
+	if (!rd_avail(rd, 6))
+		return NULL;
+
+	rv = ucv_object_new(vm);
+	ucv_object_add(rv, "local_if_mac_address", rd_mac(rd));
+
+	neighbors = ucv_array_new(vm);
+
+	while (rd_avail(rd, 6))
+		ucv_array_push(neighbors, rd_mac(rd));
+
+	ucv_object_add(rv, "non_ieee1905_neighbors", neighbors);
+
+	return rv;
+}
+
+/* 0x07 - 1905 neighbor devices */
+static uc_value_t *
+decode_ieee1905_neighbor_devices(uc_vm_t *vm, tlv_reader_t *rd)
+{
+	uc_value_t *rv, *neighbors;
+
+	if (!rd_avail(rd, 6))
+		return NULL;
+
+	rv = ucv_object_new(vm);
+	ucv_object_add(rv, "local_if_mac_address", rd_mac(rd));
+
+	neighbors = ucv_array_new(vm);
+
+	while (rd_avail(rd, 7)) {
+		uc_value_t *neighbor = ucv_object_new(vm);
+
+		ucv_object_add(neighbor, "neighbor_al_mac_address", rd_mac(rd));
+		ucv_object_add(neighbor, "bridges_present",
+			ucv_boolean_new(rd_u8(rd) & 0x80));
+
+		ucv_array_push(neighbors, neighbor);
+	}
+
+	ucv_object_add(rv, "ieee1905_neighbors", neighbors);
+
+	return rv;
+}
+
+/* 0x09 - 1905.1 transmitter link metric,
+ * 0x0a - 1905.1 receiver link metric */
+static uc_value_t *
+decode_link_metric(uc_vm_t *vm, tlv_reader_t *rd, bool tx)
+{
+	uc_value_t *rv, *metrics, *tx_mac, *nb_mac;
+
+	if (!rd_avail(rd, 12))
+		return NULL;
+
+	tx_mac = rd_mac(rd);
+	nb_mac = rd_mac(rd);
+	metrics = ucv_array_new(vm);
+
+	while (rd_avail(rd, tx ? 29 : 23)) {
+		uc_value_t *link, *local_mac, *remote_mac, *name;
+		uint16_t media_type;
+
+		local_mac = rd_mac(rd);
+		remote_mac = rd_mac(rd);
+		media_type = rd_u16(rd);
+		name = enum_name(vm, "MEDIA_TYPE", media_type);
+
+		if (!name) {
+			ucv_put(local_mac);
+			ucv_put(remote_mac);
+			ucv_put(tx_mac);
+			ucv_put(nb_mac);
+			ucv_put(metrics);
+
+			return NULL;
+		}
+
+		link = ucv_object_new(vm);
+		ucv_object_add(link, "local_if_mac_address", local_mac);
+		ucv_object_add(link, "remote_if_mac_address", remote_mac);
+		ucv_object_add(link, "media_type", ucv_int64_new(media_type));
+		ucv_object_add(link, "media_type_name", ucv_get(name));
+
+		if (tx) {
+			ucv_object_add(link, "bridges_present", ucv_boolean_new(rd_u8(rd) != 0));
+			ucv_object_add(link, "packet_errors", ucv_int64_new(rd_u32(rd)));
+			ucv_object_add(link, "transmitted_packets", ucv_int64_new(rd_u32(rd)));
+			ucv_object_add(link, "mac_throughput_capacity", ucv_int64_new(rd_u16(rd)));
+			ucv_object_add(link, "link_availability", ucv_int64_new(rd_u16(rd)));
+			ucv_object_add(link, "phy_rate", ucv_int64_new(rd_u16(rd)));
+		}
+		else {
+			ucv_object_add(link, "packet_errors", ucv_int64_new(rd_u32(rd)));
+			ucv_object_add(link, "received_packets", ucv_int64_new(rd_u32(rd)));
+			ucv_object_add(link, "rssi", ucv_int64_new(rd_u8(rd)));
+		}
+
+		ucv_array_push(metrics, link);
+	}
+
+	rv = ucv_object_new(vm);
+	ucv_object_add(rv, "transmitter_al_mac_address", tx_mac);
+	ucv_object_add(rv, "neighbor_al_mac_address", nb_mac);
+	ucv_object_add(rv, "link_metrics", metrics);
+
+	return rv;
+}
+
+static uc_value_t *
+decode_transmitter_link_metric(uc_vm_t *vm, tlv_reader_t *rd)
+{
+	return decode_link_metric(vm, rd, true);
+}
+
+static uc_value_t *
+decode_receiver_link_metric(uc_vm_t *vm, tlv_reader_t *rd)
+{
+	return decode_link_metric(vm, rd, false);
+}
+
+/* 0x15 - Device identification */
+static uc_value_t *
+decode_device_identification(uc_vm_t *vm, tlv_reader_t *rd)
+{
+	uc_value_t *rv;
+
+	if (!rd_avail(rd, 192))
+		return NULL;
+
+	rv = ucv_object_new(vm);
+	ucv_object_add(rv, "friendly_name", rd_bytes(rd, 64));
+	ucv_object_add(rv, "manufacturer_name", rd_bytes(rd, 64));
+	ucv_object_add(rv, "manufacturer_model", rd_bytes(rd, 64));
+
+	return rv;
+}
+
+/* 0x17 - IPv4 */
+static uc_value_t *
+decode_ipv4(uc_vm_t *vm, tlv_reader_t *rd)
+{
+	uc_value_t *interfaces;
+	size_t count;
+
+	if (!rd_avail(rd, 1))
+		return NULL;
+
+	count = rd_u8(rd);
+	interfaces = ucv_array_new_length(vm, count);
+
+	for (size_t h = 0; h < count; h++) {
+		uc_value_t *iface, *addresses;
+		size_t addr_count;
+
+		if (!rd_avail(rd, 7))
+			goto fail;
+
+		iface = ucv_object_new(vm);
+		ucv_object_add(iface, "if_mac_address", rd_mac(rd));
+		ucv_array_push(interfaces, iface);
+
+		addr_count = rd_u8(rd);
+
+		if (addr_count > 0x0f)
+			goto fail;
+
+		addresses = ucv_array_new_length(vm, addr_count);
+		ucv_object_add(iface, "addresses", addresses);
+
+		for (size_t i = 0; i < addr_count; i++) {
+			uc_value_t *addr, *name;
+			uint8_t addr_type;
+
+			if (!rd_avail(rd, 9))
+				goto fail;
+
+			addr_type = rd_u8(rd);
+			name = enum_name(vm, "IPV4ADDR_TYPE", addr_type);
+
+			if (!name)
+				goto fail;
+
+			addr = ucv_object_new(vm);
+			ucv_object_add(addr, "ipv4addr_type", ucv_int64_new(addr_type));
+			ucv_object_add(addr, "ipv4addr_type_name", ucv_get(name));
+			ucv_object_add(addr, "address", rd_ip(rd, AF_INET));
+			ucv_object_add(addr, "dhcp_server", rd_ip(rd, AF_INET));
+			ucv_array_push(addresses, addr);
+		}
+	}
+
+	return interfaces;
+
+fail:
+	ucv_put(interfaces);
+
+	return NULL;
+}
+
+/* 0x18 - IPv6 */
+static uc_value_t *
+decode_ipv6(uc_vm_t *vm, tlv_reader_t *rd)
+{
+	uc_value_t *interfaces;
+	size_t count;
+
+	if (!rd_avail(rd, 1))
+		return NULL;
+
+	count = rd_u8(rd);
+	interfaces = ucv_array_new_length(vm, count);
+
+	for (size_t h = 0; h < count; h++) {
+		uc_value_t *iface, *addresses;
+		size_t addr_count;
+
+		if (!rd_avail(rd, 23))
+			goto fail;
+
+		iface = ucv_object_new(vm);
+		ucv_object_add(iface, "if_mac_address", rd_mac(rd));
+		ucv_object_add(iface, "linklocal_address", rd_ip(rd, AF_INET6));
+		ucv_array_push(interfaces, iface);
+
+		addr_count = rd_u8(rd);
+
+		if (addr_count > 0x0f)
+			goto fail;
+
+		addresses = ucv_array_new_length(vm, addr_count);
+		ucv_object_add(iface, "other_addresses", addresses);
+
+		for (size_t i = 0; i < addr_count; i++) {
+			uc_value_t *addr, *name;
+			uint8_t addr_type;
+
+			if (!rd_avail(rd, 33))
+				goto fail;
+
+			addr_type = rd_u8(rd);
+			name = enum_name(vm, "IPV6ADDR_TYPE", addr_type);
+
+			if (!name)
+				goto fail;
+
+			addr = ucv_object_new(vm);
+			ucv_object_add(addr, "ipv6addr_type", ucv_int64_new(addr_type));
+			ucv_object_add(addr, "ipv6addr_type_name", ucv_get(name));
+			ucv_object_add(addr, "address", rd_ip(rd, AF_INET6));
+			ucv_object_add(addr, "origin", rd_ip(rd, AF_INET6));
+			ucv_array_push(addresses, addr);
+		}
+	}
+
+	return interfaces;
+
+fail:
+	ucv_put(interfaces);
+
+	return NULL;
+}
+
+/* 0x1e - L2 neighbor device */
+static uc_value_t *
+decode_l2_neighbor_device(uc_vm_t *vm, tlv_reader_t *rd)
+{
+	uc_value_t *interfaces;
+	size_t count;
+
+	if (!rd_avail(rd, 1))
+		return NULL;
+
+	count = rd_u8(rd);
+	interfaces = ucv_array_new_length(vm, count);
+
+	for (size_t h = 0; h < count; h++) {
+		uc_value_t *iface, *neighbors;
+		size_t neighbor_count;
+
+		if (!rd_avail(rd, 8))
+			goto fail;
+
+		iface = ucv_object_new(vm);
+		ucv_object_add(iface, "if_mac_address", rd_mac(rd));
+		ucv_array_push(interfaces, iface);
+
+		neighbor_count = rd_u16(rd);
+		neighbors = ucv_array_new(vm);
+		ucv_object_add(iface, "neighbors", neighbors);
+
+		for (size_t i = 0; i < neighbor_count; i++) {
+			uc_value_t *neighbor, *behind;
+			size_t behind_count;
+
+			if (!rd_avail(rd, 8))
+				goto fail;
+
+			neighbor = ucv_object_new(vm);
+			ucv_object_add(neighbor, "neighbor_mac_address", rd_mac(rd));
+			ucv_array_push(neighbors, neighbor);
+
+			behind_count = rd_u16(rd);
+			behind = ucv_array_new(vm);
+			ucv_object_add(neighbor, "behind_mac_addresses", behind);
+
+			for (size_t j = 0; j < behind_count; j++) {
+				if (!rd_avail(rd, 6))
+					goto fail;
+
+				ucv_array_push(behind, rd_mac(rd));
+			}
+		}
+	}
+
+	return interfaces;
+
+fail:
+	ucv_put(interfaces);
+
+	return NULL;
+}
+
+/* 0x83 - AP Operational BSS */
+static uc_value_t *
+decode_ap_operational_bss(uc_vm_t *vm, tlv_reader_t *rd)
+{
+	uc_value_t *radios;
+	size_t count;
+
+	if (!rd_avail(rd, 1))
+		return NULL;
+
+	count = rd_u8(rd);
+	radios = ucv_array_new_length(vm, count);
+
+	for (size_t h = 0; h < count; h++) {
+		uc_value_t *radio, *bsses;
+		size_t bss_count;
+
+		if (!rd_avail(rd, 7))
+			goto fail;
+
+		radio = ucv_object_new(vm);
+		ucv_object_add(radio, "radio_unique_identifier", rd_mac(rd));
+		ucv_array_push(radios, radio);
+
+		bss_count = rd_u8(rd);
+		bsses = ucv_array_new_length(vm, bss_count);
+		ucv_object_add(radio, "bss", bsses);
+
+		for (size_t i = 0; i < bss_count; i++) {
+			uc_value_t *bss, *mac;
+			size_t ssid_len;
+
+			if (!rd_avail(rd, 7))
+				goto fail;
+
+			mac = rd_mac(rd);
+			ssid_len = rd_u8(rd);
+
+			if (!rd_avail(rd, ssid_len)) {
+				ucv_put(mac);
+				goto fail;
+			}
+
+			bss = ucv_object_new(vm);
+			ucv_object_add(bss, "mac_address", mac);
+			ucv_object_add(bss, "ssid", rd_bytes(rd, ssid_len));
+			ucv_array_push(bsses, bss);
+		}
+	}
+
+	return radios;
+
+fail:
+	ucv_put(radios);
+
+	return NULL;
+}
+
+/* 0x84 - Associated Clients */
+static uc_value_t *
+decode_associated_clients(uc_vm_t *vm, tlv_reader_t *rd)
+{
+	uc_value_t *bsses;
+	size_t count;
+
+	if (!rd_avail(rd, 1))
+		return NULL;
+
+	count = rd_u8(rd);
+	bsses = ucv_array_new_length(vm, count);
+
+	for (size_t h = 0; h < count; h++) {
+		uc_value_t *bss, *clients;
+		size_t client_count;
+
+		if (!rd_avail(rd, 8))
+			goto fail;
+
+		bss = ucv_object_new(vm);
+		ucv_object_add(bss, "bssid", rd_mac(rd));
+		ucv_array_push(bsses, bss);
+
+		client_count = rd_u16(rd);
+		clients = ucv_array_new(vm);
+		ucv_object_add(bss, "clients", clients);
+
+		for (size_t i = 0; i < client_count; i++) {
+			uc_value_t *client;
+
+			if (!rd_avail(rd, 8))
+				goto fail;
+
+			client = ucv_object_new(vm);
+			ucv_object_add(client, "mac_address", rd_mac(rd));
+			ucv_object_add(client, "last_association", ucv_int64_new(rd_u16(rd)));
+			ucv_array_push(clients, client);
+		}
+	}
+
+	return bsses;
+
+fail:
+	ucv_put(bsses);
+
+	return NULL;
+}
+
+
+/* 0x01 - 1905.1 AL MAC address, 0x02 - MAC address */
+static bool
+encode_mac(uc_vm_t *vm, uc_stringbuf_t *sb, uc_value_t *mac)
+{
+	return wr_mac(sb, mac);
+}
+
+/* 0x03 - 1905.1 device information */
+static bool
+encode_device_information(uc_vm_t *vm, uc_stringbuf_t *sb, uc_value_t *tlv)
+{
+	uc_value_t *ifaces = ucv_object_get(tlv, "local_interfaces", NULL);
+
+	if (ucv_type(tlv) != UC_OBJECT)
+		return false;
+
+	if (!wr_mac(sb, ucv_object_get(tlv, "al_mac_address", NULL)))
+		return false;
+
+	if (ucv_type(ifaces) != UC_ARRAY || ucv_array_length(ifaces) > 0xff)
+		return false;
+
+	wr_u8(sb, ucv_array_length(ifaces));
+
+	for (size_t i = 0; i < ucv_array_length(ifaces); i++) {
+		uc_value_t *item = ucv_array_get(ifaces, i);
+		uc_value_t *media_type = ucv_object_get(item, "media_type", NULL);
+		uc_value_t *media_info = ucv_object_get(item, "media_specific_information", NULL);
+
+		if (ucv_type(item) != UC_OBJECT)
+			return false;
+
+		if (!wr_mac(sb, ucv_object_get(item, "local_if_mac_address", NULL)))
+			return false;
+
+		if (!is_media_type(media_type))
+			return false;
+
+		if (ucv_type(media_info) != UC_STRING || ucv_string_length(media_info) > 0xff)
+			return false;
+
+		wr_u16(sb, ucv_int64_get(media_type));
+		wr_u8(sb, ucv_string_length(media_info));
+		printbuf_memappend_fast(sb, ucv_string_get(media_info),
+			ucv_string_length(media_info));
+	}
+
+	return true;
+}
+
+/* 0x06 - Non-1905 neighbor devices */
+static bool
+encode_non1905_neighbor_devices(uc_vm_t *vm, uc_stringbuf_t *sb, uc_value_t *tlv)
+{
+	uc_value_t *neighbors = ucv_object_get(tlv, "non_ieee1905_neighbors", NULL);
+
+	if (ucv_type(tlv) != UC_OBJECT)
+		return false;
+
+	if (!wr_mac(sb, ucv_object_get(tlv, "local_if_mac_address", NULL)))
+		return false;
+
+	if (ucv_type(neighbors) != UC_ARRAY)
+		return false;
+
+	for (size_t i = 0; i < ucv_array_length(neighbors); i++)
+		if (!wr_mac(sb, ucv_array_get(neighbors, i)))
+			return false;
+
+	return true;
+}
+
+/* 0x07 - 1905 neighbor devices */
+static bool
+encode_ieee1905_neighbor_devices(uc_vm_t *vm, uc_stringbuf_t *sb, uc_value_t *tlv)
+{
+	uc_value_t *neighbors = ucv_object_get(tlv, "ieee1905_neighbors", NULL);
+
+	if (ucv_type(tlv) != UC_OBJECT)
+		return false;
+
+	if (!wr_mac(sb, ucv_object_get(tlv, "local_if_mac_address", NULL)))
+		return false;
+
+	if (ucv_type(neighbors) != UC_ARRAY)
+		return false;
+
+	for (size_t i = 0; i < ucv_array_length(neighbors); i++) {
+		uc_value_t *item = ucv_array_get(neighbors, i);
+
+		if (ucv_type(item) != UC_OBJECT)
+			return false;
+
+		if (!wr_mac(sb, ucv_object_get(item, "neighbor_al_mac_address", NULL)))
+			return false;
+
+		wr_u8(sb, get_flag(ucv_object_get(item, "bridges_present", NULL), 7));
+	}
+
+	return true;
+}
+
+/* 0x09 - 1905.1 transmitter link metric,
+ * 0x0a - 1905.1 receiver link metric */
+static bool
+encode_link_metric(uc_vm_t *vm, uc_stringbuf_t *sb, uc_value_t *tlv, bool tx)
+{
+	uc_value_t *metrics = ucv_object_get(tlv, "link_metrics", NULL);
+
+	if (ucv_type(tlv) != UC_OBJECT)
+		return false;
+
+	if (!wr_mac(sb, ucv_object_get(tlv, "transmitter_al_mac_address", NULL)) ||
+	    !wr_mac(sb, ucv_object_get(tlv, "neighbor_al_mac_address", NULL)))
+		return false;
+
+	if (ucv_type(metrics) != UC_ARRAY)
+		return false;
+
+	for (size_t i = 0; i < ucv_array_length(metrics); i++) {
+		uc_value_t *item = ucv_array_get(metrics, i);
+		uc_value_t *media_type = ucv_object_get(item, "media_type", NULL);
+		uint64_t errors, packets, throughput, availability, phy_rate, rssi;
+
+		if (ucv_type(item) != UC_OBJECT)
+			return false;
+
+		if (!wr_mac(sb, ucv_object_get(item, "local_if_mac_address", NULL)) ||
+		    !wr_mac(sb, ucv_object_get(item, "remote_if_mac_address", NULL)))
+			return false;
+
+		if (!is_media_type(media_type))
+			return false;
+
+		if (!get_uint(ucv_object_get(item, "packet_errors", NULL), 0xffffffff, &errors))
+			return false;
+
+		wr_u16(sb, ucv_int64_get(media_type));
+
+		if (tx) {
+			if (!get_uint(ucv_object_get(item, "transmitted_packets", NULL), 0xffffffff, &packets) ||
+			    !get_uint(ucv_object_get(item, "mac_throughput_capacity", NULL), 0xffff, &throughput) ||
+			    !get_uint(ucv_object_get(item, "link_availability", NULL), 0xffff, &availability) ||
+			    !get_uint(ucv_object_get(item, "phy_rate", NULL), 0xffff, &phy_rate))
+				return false;
+
+			wr_u8(sb, ucv_is_truish(ucv_object_get(item, "bridges_present", NULL)));
+			wr_u32(sb, errors);
+			wr_u32(sb, packets);
+			wr_u16(sb, throughput);
+			wr_u16(sb, availability);
+			wr_u16(sb, phy_rate);
+		}
+		else {
+			if (!get_uint(ucv_object_get(item, "received_packets", NULL), 0xffffffff, &packets) ||
+			    !get_uint(ucv_object_get(item, "rssi", NULL), 0xff, &rssi))
+				return false;
+
+			wr_u32(sb, errors);
+			wr_u32(sb, packets);
+			wr_u8(sb, rssi);
+		}
+	}
+
+	return true;
+}
+
+static bool
+encode_transmitter_link_metric(uc_vm_t *vm, uc_stringbuf_t *sb, uc_value_t *tlv)
+{
+	return encode_link_metric(vm, sb, tlv, true);
+}
+
+static bool
+encode_receiver_link_metric(uc_vm_t *vm, uc_stringbuf_t *sb, uc_value_t *tlv)
+{
+	return encode_link_metric(vm, sb, tlv, false);
+}
+
+/* 0x1e - L2 neighbor device */
+static bool
+encode_l2_neighbor_device(uc_vm_t *vm, uc_stringbuf_t *sb, uc_value_t *interfaces)
+{
+	if (ucv_type(interfaces) != UC_ARRAY || ucv_array_length(interfaces) > 0xff)
+		return false;
+
+	wr_u8(sb, ucv_array_length(interfaces));
+
+	for (size_t h = 0; h < ucv_array_length(interfaces); h++) {
+		uc_value_t *item = ucv_array_get(interfaces, h);
+		uc_value_t *neighbors = ucv_object_get(item, "neighbors", NULL);
+
+		if (ucv_type(item) != UC_OBJECT)
+			return false;
+
+		if (!wr_mac(sb, ucv_object_get(item, "if_mac_address", NULL)))
+			return false;
+
+		if (ucv_type(neighbors) != UC_ARRAY || ucv_array_length(neighbors) > 0xffff)
+			return false;
+
+		wr_u16(sb, ucv_array_length(neighbors));
+
+		for (size_t i = 0; i < ucv_array_length(neighbors); i++) {
+			uc_value_t *item2 = ucv_array_get(neighbors, i);
+			uc_value_t *behind = ucv_object_get(item2, "behind_mac_addresses", NULL);
+
+			if (ucv_type(item2) != UC_OBJECT)
+				return false;
+
+			if (!wr_mac(sb, ucv_object_get(item2, "neighbor_mac_address", NULL)))
+				return false;
+
+			if (ucv_type(behind) != UC_ARRAY || ucv_array_length(behind) > 0xffff)
+				return false;
+
+			wr_u16(sb, ucv_array_length(behind));
+
+			for (size_t j = 0; j < ucv_array_length(behind); j++)
+				if (!wr_mac(sb, ucv_array_get(behind, j)))
+					return false;
+		}
+	}
+
+	return true;
+}
+
+
+static uc_value_t *
+tlv_decode(uc_vm_t *vm, size_t nargs, tlv_decode_fn_t decode)
+{
+	uc_value_t *buf = uc_fn_arg(0), *end = uc_fn_arg(1);
+	uc_value_t *payload = NULL, *pos = NULL, *rv = NULL;
+	tlv_reader_t rd;
+	int64_t off;
+
+	if (ucv_type(buf) == UC_STRING)
+		return decode(vm, &(tlv_reader_t){
+			.pos = (const uint8_t *)ucv_string_get(buf),
+			.end = (const uint8_t *)ucv_string_get(buf) + ucv_string_length(buf)
+		});
+
+	pos = buf_invoke(vm, buf, "pos", 0);
+
+	if (ucv_type(pos) != UC_INTEGER || ucv_type(end) != UC_INTEGER ||
+	    ucv_int64_get(end) < ucv_int64_get(pos))
+		goto out;
+
+	payload = buf_invoke(vm, buf, "slice", 2, ucv_get(pos), ucv_get(end));
+
+	if (ucv_type(payload) != UC_STRING)
+		goto out;
+
+	rd.pos = (const uint8_t *)ucv_string_get(payload);
+	rd.end = rd.pos + ucv_string_length(payload);
+
+	rv = decode(vm, &rd);
+
+	/* leave the buffer positioned after the consumed payload, like the
+	 * ucode decoders do */
+	off = ucv_int64_get(pos) + (rd.pos - (const uint8_t *)ucv_string_get(payload));
+	ucv_put(buf_invoke(vm, buf, "pos", 1, ucv_int64_new(off)));
+
+out:
+	ucv_put(payload);
+	ucv_put(pos);
+
+	return rv;
+}
+
+static uc_value_t *
+tlv_encode(uc_vm_t *vm, size_t nargs, tlv_encode_fn_t encode)
+{
+	uc_value_t *buf = uc_fn_arg(0), *value = uc_fn_arg(1), *rv;
+	uc_stringbuf_t *sb = ucv_stringbuf_new();
+
+	if (!encode(vm, sb, value)) {
+		printbuf_free(sb);
+
+		return NULL;
+	}
+
+	rv = buf_invoke(vm, buf, "put", 2,
+		ucv_string_new("*"), ucv_stringbuf_finish(sb));
+
+	if (!rv)
+		return NULL;
+
+	ucv_put(rv);
+
+	return ucv_get(buf);
+}
+
+#define TLV_DECODER(type, fn) \
+	static uc_value_t *uc_decode_##type(uc_vm_t *vm, size_t nargs) \
+	{ return tlv_decode(vm, nargs, fn); }
+
+#define TLV_ENCODER(type, fn) \
+	static uc_value_t *uc_encode_##type(uc_vm_t *vm, size_t nargs) \
+	{ return tlv_encode(vm, nargs, fn); }
+
+TLV_DECODER(0x01, decode_mac)
+TLV_DECODER(0x02, decode_mac)
+TLV_DECODER(0x03, decode_device_information)
+TLV_DECODER(0x06, decode_non1905_neighbor_devices)
+TLV_DECODER(0x07, decode_ieee1905_neighbor_devices)
+TLV_DECODER(0x09, decode_transmitter_link_metric)
+TLV_DECODER(0x0a, decode_receiver_link_metric)
+TLV_DECODER(0x15, decode_device_identification)
+TLV_DECODER(0x17, decode_ipv4)
+TLV_DECODER(0x18, decode_ipv6)
+TLV_DECODER(0x1e, decode_l2_neighbor_device)
+TLV_DECODER(0x82, decode_mac)
+TLV_DECODER(0x83, decode_ap_operational_bss)
+TLV_DECODER(0x84, decode_associated_clients)
+
+TLV_ENCODER(0x01, encode_mac)
+TLV_ENCODER(0x02, encode_mac)
+TLV_ENCODER(0x03, encode_device_information)
+TLV_ENCODER(0x06, encode_non1905_neighbor_devices)
+TLV_ENCODER(0x07, encode_ieee1905_neighbor_devices)
+TLV_ENCODER(0x09, encode_transmitter_link_metric)
+TLV_ENCODER(0x0a, encode_receiver_link_metric)
+TLV_ENCODER(0x1e, encode_l2_neighbor_device)
+
+static const struct {
+	uint8_t type;
+	uc_cfn_ptr_t fn;
+} tlv_decoders[] = {
+	{ 0x01, uc_decode_0x01 },
+	{ 0x02, uc_decode_0x02 },
+	{ 0x03, uc_decode_0x03 },
+	{ 0x06, uc_decode_0x06 },
+	{ 0x07, uc_decode_0x07 },
+	{ 0x09, uc_decode_0x09 },
+	{ 0x0a, uc_decode_0x0a },
+	{ 0x15, uc_decode_0x15 },
+	{ 0x17, uc_decode_0x17 },
+	{ 0x18, uc_decode_0x18 },
+	{ 0x1e, uc_decode_0x1e },
+	{ 0x82, uc_decode_0x82 },
+	{ 0x83, uc_decode_0x83 },
+	{ 0x84, uc_decode_0x84 },
+}, tlv_encoders[] = {
+	{ 0x01, uc_encode_0x01 },
+	{ 0x02, uc_encode_0x02 },
+	{ 0x03, uc_encode_0x03 },
+	{ 0x06, uc_encode_0x06 },
+	{ 0x07, uc_encode_0x07 },
+	{ 0x09, uc_encode_0x09 },
+	{ 0x0a, uc_encode_0x0a },
+	{ 0x1e, uc_encode_0x1e },
+};
+
+static uc_value_t *
+uc_tlvcodec_init(uc_vm_t *vm, size_t nargs)
+{
+	uc_value_t *defs = uc_fn_arg(0);
+
+	if (ucv_type(defs) != UC_OBJECT)
+		return NULL;
+
+	uc_vm_registry_set(vm, REGISTRY_DEFS_KEY, ucv_get(defs));
+
+	return ucv_boolean_new(true);
+}
+
+
+static const uc_function_list_t tlvcodec_fns[] = {
+	{ "init", uc_tlvcodec_init },
+};
+
+void uc_module_init(uc_vm_t *vm, uc_value_t *scope)
+{
+	uc_value_t *decoders = ucv_array_new(vm);
+	uc_value_t *encoders = ucv_array_new(vm);
+	char name[sizeof("decode_0xff")];
+
+	uc_function_list_register(scope, tlvcodec_fns);
+
+	for (size_t i = 0; i < ARRAY_SIZE(tlv_decoders); i++) {
+		snprintf(name, sizeof(name), "decode_0x%02x", tlv_decoders[i].type);
+		ucv_array_set(decoders, tlv_decoders[i].type,
+			ucv_cfunction_new(name, tlv_decoders[i].fn));
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(tlv_encoders); i++) {
+		snprintf(name, sizeof(name), "encode_0x%02x", tlv_encoders[i].type);
+		ucv_array_set(encoders, tlv_encoders[i].type,
+			ucv_cfunction_new(name, tlv_encoders[i].fn));
+	}
+
+	ucv_object_add(scope, "decoder", decoders);
+	ucv_object_add(scope, "encoder", encoders);
+	ucv_object_add(scope, "extended_decoder", ucv_array_new(vm));
+	ucv_object_add(scope, "extended_encoder", ucv_array_new(vm));
+}
@@ -17,8 +17,42 @@
 import log from 'umap.log';
 import defs from 'umap.defs';
 import model from 'umap.model';
+import cmdu from 'umap.cmdu';
+import requests from 'umap.requests';
+import stats from 'umap.stats';
 import utils from 'umap.utils';
 import ubus from 'umap.ubusclient';
+import events from 'umap.events';
+
+/* device entries are rebuilt only when the device changed since the last dump */
+function topology_entry(i1905dev) {
+	if (i1905dev.topologyCache?.generation === i1905dev.generation)
+		return i1905dev.topologyCache.entry;
+
+	let links = i1905dev.getLinks();
+	let ipaddrs = i1905dev.getIPAddrs();
+
+	let info = i1905dev.dumpInformation();
+	let entry = {
+		al_address: i1905dev.al_address,
+		identification: i1905dev.getIdentification(),
+		unconfirmed: !!i1905dev.unconfirmed,
+		interfaces: [],
+		...info
+	};
+
+	for (let address, iface in i1905dev.getInterfaceInformation()) {
+		push(entry.interfaces, {
+			...iface,
+			...(ipaddrs[address] ?? {}),
+			links: links[address] ?? {}
+		});
+	}
+
+	i1905dev.topologyCache = { generation: i1905dev.generation, entry };
+
+	return entry;
+}
 
 const IUmapUbusProcedures = {
 	get_intf_list: {
@@ -97,37 +131,61 @@ const IUmapUbusProcedures = {
 
 	get_topology: {
 		args: {
-			ubus_rpc_session: "00000000000000000000000000000000"
+			ubus_rpc_session: "00000000000000000000000000000000",
+			epoch: "",
+			generation: 0,
+			delta: false
 		},
 		call: function (req) {
+			model.updateTopologyVisibility();
+
+			const epoch = model.topologyEpoch;
+			const generation = model.topologyGeneration;
+
+			/* generations of another daemon instance are meaningless, dump all */
+			const since = (req.args.epoch === epoch) ? req.args.generation : null;
+
+			if (since != null && since == generation)
+				return req.reply({ epoch, generation, unchanged: true });
+
+			/* deltas are only possible while removals since then are known */
+			if (since != null && req.args.delta && since < generation && since >= model.topologyHorizon) {
+				let res = {
+					epoch,
+					generation,
+					since,
+					added: [],
+					changed: [],
+					removed: []
+				};
+
+				for (let i1905dev in model.getDevices()) {
+					if (i1905dev.generation <= since || !i1905dev.visible)
+						continue;
+
+					if (i1905dev.created > since)
+						push(res.added, topology_entry(i1905dev));
+					else
+						push(res.changed, topology_entry(i1905dev));
+				}
+
+				for (let al_address, gen in model.topologyRemoved)
+					if (gen > since)
+						push(res.removed, al_address);
+
+				return req.reply(res);
+			}
+
 			let res = {
+				epoch,
+				generation,
 				devices: [],
 				links: []
 			};
 
-			for (let i1905dev in model.getDevices()) {
-				if (!i1905dev.isIEEE1905())
-					continue;
-
-				let links = i1905dev.getLinks();
-				let ipaddrs = i1905dev.getIPAddrs();
-
-				let info = i1905dev.dumpInformation();
-				push(res.devices, {
-					al_address: i1905dev.al_address,
-					identification: i1905dev.getIdentification(),
-					interfaces: [],
-					...info
-				});
-
-				for (let address, iface in i1905dev.getInterfaceInformation()) {
-					push(res.devices[-1].interfaces, {
-						...iface,
-						...(ipaddrs[address] ?? {}),
-						links: links[address] ?? {}
-					});
-				}
-			}
+			for (let i1905dev in model.getDevices())
+				if (i1905dev.visible)
+					push(res.devices, topology_entry(i1905dev));
 
 			return req.reply(res);
 		}
@@ -158,6 +216,37 @@ const IUmapUbusProcedures = {
 			return req.reply({ devices });
 		}
 	},
+
+	get_traffic_stats: {
+		args: {
+			ubus_rpc_session: "00000000000000000000000000000000"
+		},
+		call: function (req) {
+			let bridges = {};
+
+			for (let brname, sockbr in model.sockbr) {
+				let ports = bridges[brname] = {};
+
+				for (let ifname in sockbr.members)
+					ports[ifname] = sockbr.stats(ifname);
+			}
+
+			return req.reply({ bridges });
+		}
+	},
+
+	get_stats: {
+		args: {
+			ubus_rpc_session: "00000000000000000000000000000000"
+		},
+		call: function (req) {
+			return req.reply({
+				...stats.dump(),
+				reassembly: cmdu.reassembly_stats(),
+				requests: requests.stats()
+			});
+		}
+	},
 };
 
 let namespace;
@@ -190,6 +279,10 @@ export default {
 		if (this.connect()) {
 			const nsname = model.isController ? "umap" : "umap-agent";
 
+			if (!namespace)
+				events.register('model.topology',
+					(generation) => this.notify('topology_changed', { epoch: model.topologyEpoch, generation }));
+
 			return (namespace ??= ubus.publish(nsname, IUmapUbusProcedures));
 		}
 	},
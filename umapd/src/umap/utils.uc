@@ -14,7 +14,8 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
-import { unpack } from 'struct';
+import { pack, unpack } from 'struct';
+import { ether_ntoa, ether_aton } from 'umap.core';
 
 import defs from 'umap.defs';
 
@@ -70,33 +71,107 @@ const Queue = {
 	},
 };
 
-const AgingDict = {
-	gc: function (except_key, now) {
-		for (let k, v in this.d) {
-			if (k != except_key && now - v[0] > this.maxAge) {
-				this.onRemove?.(k, v[1]);
-				delete this.d[k];
+function timems() {
+	let tv = clock(true) ?? clock(false);
+	return tv[0] * 1000 + tv[1] / 1000000;
+}
+
+/*
+ * Items are filed into time buckets of the configured granularity when
+ * touched; touching an item again within the same bucket is a no-op and
+ * stale references in older buckets are skipped on expiry. The numbers of
+ * non-empty buckets are kept in ascending order, so expiring visits only
+ * buckets holding items, regardless of how much time passed in between.
+ */
+const ExpiryWheel = {
+	touch: function (item, now) {
+		const slot = int(now / this.granularity);
+
+		if (item.expirySlot === slot)
+			return item;
+
+		item.expirySlot = slot;
+
+		if (!this.slots[slot]) {
+			/* buckets are mostly created in ascending order, only items
+			 * restored with their original age may predate newer ones */
+			let i = length(this.order);
+
+			while (i > 0 && this.order[i - 1] > slot)
+				i--;
+
+			splice(this.order, i, 0, slot);
+			this.slots[slot] = [];
+		}
+
+		push(this.slots[slot], item);
+
+		return item;
+	},
+
+	remove: function (item) {
+		item.expirySlot = null;
+
+		return item;
+	},
+
+	expire: function (now, callback) {
+		const limit = int((now - this.maxAge) / this.granularity);
+		let count = 0;
+
+		while (length(this.order) && this.order[0] < limit) {
+			const slot = shift(this.order);
+
+			for (let item in this.slots[slot]) {
+				if (item.expirySlot !== slot)
+					continue;
+
+				item.expirySlot = null;
+				callback(item);
+				count++;
 			}
+
+			delete this.slots[slot];
 		}
+
+		return count;
+	}
+};
+
+function expiry_wheel(maxAge, granularity) {
+	return proto({
+		maxAge,
+		granularity: granularity ?? max(1, int(maxAge / 32)),
+		order: [],
+		slots: {}
+	}, ExpiryWheel);
+}
+
+const AgingDict = {
+	gc: function (now) {
+		this.wheel.expire(now, (e) => {
+			this.onRemove?.(e.key, e.val);
+			delete this.d[e.key];
+		});
 	},
 
 	set: function (key, val) {
-		let now = time();
-
-		this.gc(key, now);
+		let now = timems();
 
 		if (exists(this.d, key))
-			this.d[key][0] = now;
+			this.wheel.touch(this.d[key], now);
 		else
-			this.d[key] = [now, val];
+			this.wheel.touch(this.d[key] = { key, val }, now);
+
+		this.gc(now);
 
 		return val;
 	},
 
 	touch: function (key) {
 		if (exists(this.d, key)) {
-			this.d[key][0] = time();
-			return this.d[key][1];
+			this.wheel.touch(this.d[key], timems());
+			return this.d[key].val;
 		}
 
 		return null;
@@ -105,19 +180,19 @@ const AgingDict = {
 	unset: function (key) {
 		let val = null;
 
-		this.gc(key, time());
-
 		if (exists(this.d, key)) {
-			val = this.d[key][1];
+			val = this.wheel.remove(this.d[key]).val;
 			this.onRemove?.(key, val);
 			delete this.d[key];
 		}
 
+		this.gc(timems());
+
 		return val;
 	},
 
 	get: function (key) {
-		return this.d[key]?.[1];
+		return this.d[key]?.val;
 	},
 
 	has: function (key) {
@@ -128,7 +203,7 @@ const AgingDict = {
 		let rv = [];
 
 		for (let k, v in this.d)
-			push(rv, v[1]);
+			push(rv, v.val);
 
 		return rv;
 	}
@@ -141,26 +216,23 @@ export default {
 		q: []
 	}, Queue),
 
+	ExpiryWheel: expiry_wheel,
+
 	AgingDict: (maxAge, onRemove) => proto({
 		maxAge,
 		onRemove,
-		d: {}
+		d: {},
+		wheel: expiry_wheel(maxAge)
 	}, AgingDict),
 
-	ether_ntoa: function (v, off) {
-		let mac = unpack('6B', v, off);
-		return mac ? sprintf('%02x:%02x:%02x:%02x:%02x:%02x', ...mac) : null;
-	},
-
-	ether_aton: function (mac) {
-		return hexdec(mac, ':');
-	},
+	ether_ntoa,
+	ether_aton,
 
 	ether_increment: function (mac, increment) {
 		if (increment === 0)
 			return mac;
 
-		const bytes = unpack('6B', hexdec(mac, ':'));
+		const bytes = unpack('6B', ether_aton(mac));
 		let carry = increment ?? 1;
 
 		for (let i = 5; i >= 0; i--) {
@@ -171,7 +243,7 @@ export default {
 
 		bytes[0] |= 0x02;
 
-		return sprintf('%02x:%02x:%02x:%02x:%02x:%02x', ...bytes);
+		return ether_ntoa(pack('6B', ...bytes));
 	},
 
 	lookup_enum: function (v, d) {
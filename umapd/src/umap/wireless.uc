@@ -23,6 +23,7 @@ import { find_phy } from 'wifi.utils';
 import events from 'umap.events';
 import ubus from 'umap.ubusclient';
 import log from 'umap.log';
+import utils from 'umap.utils';
 
 /* shared constants */
 export const WPS_AUTH_OPEN = 0x0001;
@@ -267,7 +268,7 @@ function getSupportedOperatingClasses(phy, radio_band) {
 
 const IRadio = {
 	deriveUUID: function () {
-		const bytes = this.address ? unpack("6B", hexdec(this.address, ":")) : [this.info?.wiphy ?? 0];
+		const bytes = this.address ? unpack("6B", utils.ether_aton(this.address)) : [this.info?.wiphy ?? 0];
 
 		let h = 0;
 
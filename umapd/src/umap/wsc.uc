@@ -1,7 +1,13 @@
 import { pack, unpack, buffer } from 'struct';
 import { readfile } from 'fs';
+import { timer, handle, ULOOP_READ } from 'uloop';
 import log from 'umap.log';
-import { sha256, hmac_sha256, aes_encrypt, aes_decrypt, dh_keypair, dh_sharedkey } from 'umap.crypto';
+import {
+	sha256, hmac_sha256, aes_encrypt, aes_decrypt, kdf,
+	dh_keypair, dh_pool_fill, dh_sharedkey,
+	dh_keypair_async, dh_sharedkey_async, dh_pool_fill_async,
+	async_init, async_complete
+} from 'umap.crypto';
 
 import model from 'umap.model';
 import utils from 'umap.utils';
@@ -53,9 +59,13 @@ const WFA_ELEM_VERSION2 = 0x00;
 const WFA_ELEM_MULTI_AP = 0x06;
 const WPS_VERSION = 0x20;
 
+const DH_POOL_REFILL_INTERVAL = 100;
+const CRYPTO_WORKER_THREADS = 2;
+
 // Global variables
 let last_m1 = null;
 let last_key = null;
+let async_handle = null;
 
 function build_plain_settings(desiredConfiguration) {
 	let buf = buffer();
@@ -88,19 +98,42 @@ function build_plain_settings(desiredConfiguration) {
 }
 
 function derive_wps_keys(key, personalization_string, required_length) {
-	let result = "";
+	return kdf(key, personalization_string, required_length);
+}
+
+// Keypairs are generated ahead of time so that building M1/M2 messages does
+// not stall on DH key generation. With crypto worker threads, the pool is
+// refilled in the background, otherwise one keypair is generated per timer
+// expiry in the main thread.
+let dh_refill_timer = null;
+
+function dh_refill() {
+	if (dh_pool_fill(1) > 0)
+		dh_refill_timer.set(DH_POOL_REFILL_INTERVAL);
+}
+
+function dh_refill_schedule() {
+	if (async_handle && dh_pool_fill_async() != null)
+		return;
+
+	if (!dh_refill_timer)
+		dh_refill_timer = timer(DH_POOL_REFILL_INTERVAL, dh_refill);
+	else if (dh_refill_timer.remaining() < 0)
+		dh_refill_timer.set(DH_POOL_REFILL_INTERVAL);
+}
+
+function dh_pooled_keypair() {
+	const keypair = dh_keypair();
 
-	for (let i = 1; length(result) < required_length; i++)
-		result += hmac_sha256(key,
-			pack("!I*I", i, personalization_string, required_length * 8));
+	dh_refill_schedule();
 
-	return substr(result, 0, required_length);
+	return keypair;
 }
 
 function derive_registrar_uuid() {
 	let hash = 0;
 
-	for (let b in unpack("6B", hexdec(model.address, ":")))
+	for (let b in unpack("6B", utils.ether_aton(model.address)))
 		hash = (hash * 31) + b;
 
 	const uuid = [];
@@ -137,7 +170,7 @@ export function wscBuildM1(radio) {
 	let enrollee_nonce = readfile("/dev/urandom", 16);
 	buf.put("!HH16s", ATTR_ENROLLEE_NONCE, 16, enrollee_nonce);
 
-	let keypair = dh_keypair();
+	let keypair = dh_pooled_keypair();
 	let priv_key = keypair[0];
 	let pub_key = keypair[1];
 	buf.put("!HH*", ATTR_PUBLIC_KEY, length(pub_key), pub_key);
@@ -145,7 +178,7 @@ export function wscBuildM1(radio) {
 	buf.put("!HHH", ATTR_AUTH_TYPE_FLAGS, 2, radio.inferWSCAuthenticationSuites());
 	buf.put("!HHH", ATTR_ENCR_TYPE_FLAGS, 2, radio.inferWSCEncryptionTypes());
 
-	const id = local_device.getIdentification();
+	const id = local_device?.getIdentification();
 
 	buf.put("!HHB", ATTR_CONN_TYPE_FLAGS, 1, WPS_CONN_ESS);
 	buf.put("!HHH", ATTR_CONFIG_METHODS, 2, WPS_CONFIG_PUSHBUTTON);
@@ -218,7 +251,9 @@ export function wscProcessM1(m1) {
 	return settings;
 };
 
-export function wscBuildM2(m1, desiredConfiguration) {
+// When a callback is given, the DH computations are offloaded to the crypto
+// worker threads and the resulting M2 (or null) is passed to the callback.
+export function wscBuildM2(m1, desiredConfiguration, callback) {
 	let local_device = model.getLocalDevice();
 	let msg = buffer(m1);
 
@@ -241,79 +276,105 @@ export function wscBuildM2(m1, desiredConfiguration) {
 			msg.pos(msg.pos() + attr_len);
 	}
 
-	if (!m1_mac_address || !m1_nonce || !m1_pubkey)
-		return log.warn(`wsc: ignoring incomplete message received - ignoring M1`);
+	if (!m1_mac_address || !m1_nonce || !m1_pubkey) {
+		log.warn(`wsc: ignoring incomplete message received - ignoring M1`);
+		return callback?.(null);
+	}
 
-	let buf = buffer();
+	const finish = function (keypair, shared_secret) {
+		if (!keypair || !shared_secret)
+			return log.warn(`wsc: unable to derive shared secret - ignoring M1`);
 
-	buf.put("!HHB", ATTR_VERSION, 1, 0x10);
-	buf.put("!HHB", ATTR_MSG_TYPE, 1, WPS_M2);
-	buf.put("!HH16s", ATTR_ENROLLEE_NONCE, 16, m1_nonce);
+		let buf = buffer();
 
-	let registrar_nonce = readfile("/dev/urandom", 16);
-	buf.put("!HH16s", ATTR_REGISTRAR_NONCE, 16, registrar_nonce);
+		buf.put("!HHB", ATTR_VERSION, 1, 0x10);
+		buf.put("!HHB", ATTR_MSG_TYPE, 1, WPS_M2);
+		buf.put("!HH16s", ATTR_ENROLLEE_NONCE, 16, m1_nonce);
 
-	buf.put("!HH16B", ATTR_UUID_R, 16, ...derive_registrar_uuid());
+		let registrar_nonce = readfile("/dev/urandom", 16);
+		buf.put("!HH16s", ATTR_REGISTRAR_NONCE, 16, registrar_nonce);
 
-	let keypair = dh_keypair();
-	let local_privkey = keypair?.[0];
-	let local_pubkey = keypair?.[1];
-	buf.put("!HH*", ATTR_PUBLIC_KEY, length(local_pubkey), local_pubkey);
+		buf.put("!HH16B", ATTR_UUID_R, 16, ...derive_registrar_uuid());
 
-	//buf.put("!HHH", ATTR_AUTH_TYPE_FLAGS, 2, desiredConfiguration.authentication_types);
-	//buf.put("!HHH", ATTR_ENCR_TYPE_FLAGS, 2, desiredConfiguration.encryption_types);
+		let local_pubkey = keypair[1];
+		buf.put("!HH*", ATTR_PUBLIC_KEY, length(local_pubkey), local_pubkey);
 
-	buf.put("!HHB", ATTR_CONN_TYPE_FLAGS, 1, WPS_CONN_ESS);
-	buf.put("!HHH", ATTR_CONFIG_METHODS, 2, WPS_CONFIG_PUSHBUTTON);
+		//buf.put("!HHH", ATTR_AUTH_TYPE_FLAGS, 2, desiredConfiguration.authentication_types);
+		//buf.put("!HHH", ATTR_ENCR_TYPE_FLAGS, 2, desiredConfiguration.encryption_types);
 
-	const id = local_device.getIdentification();
+		buf.put("!HHB", ATTR_CONN_TYPE_FLAGS, 1, WPS_CONN_ESS);
+		buf.put("!HHH", ATTR_CONFIG_METHODS, 2, WPS_CONFIG_PUSHBUTTON);
 
-	buf.put("!HH*", ATTR_MANUFACTURER, length(id?.manufacturer_name), id?.manufacturer_name ?? '');
-	buf.put("!HH*", ATTR_MODEL_NAME, length(id?.manufacturer_model), id?.manufacturer_model ?? '');
-	buf.put("!HH*", ATTR_MODEL_NUMBER, length('unspecified'), 'unspecified');
-	buf.put("!HH*", ATTR_SERIAL_NUMBER, length('unspecified'), 'unspecified');
+		const id = local_device.getIdentification();
 
-	let oui = "\x00\x50\xf2\x00";
-	buf.put("!HHH4sH", ATTR_PRIMARY_DEV_TYPE, 8, WPS_DEV_NETWORK_INFRA, oui, WPS_DEV_NETWORK_INFRA_ROUTER);
+		buf.put("!HH*", ATTR_MANUFACTURER, length(id?.manufacturer_name), id?.manufacturer_name ?? '');
+		buf.put("!HH*", ATTR_MODEL_NAME, length(id?.manufacturer_model), id?.manufacturer_model ?? '');
+		buf.put("!HH*", ATTR_MODEL_NUMBER, length('unspecified'), 'unspecified');
+		buf.put("!HH*", ATTR_SERIAL_NUMBER, length('unspecified'), 'unspecified');
 
-	buf.put("!HH*", ATTR_DEV_NAME, length(id?.friendly_name), id?.friendly_name ?? '');
+		let oui = "\x00\x50\xf2\x00";
+		buf.put("!HHH4sH", ATTR_PRIMARY_DEV_TYPE, 8, WPS_DEV_NETWORK_INFRA, oui, WPS_DEV_NETWORK_INFRA_ROUTER);
 
-	buf.put("!HHB", ATTR_RF_BANDS, 1, desiredConfiguration.band);
+		buf.put("!HH*", ATTR_DEV_NAME, length(id?.friendly_name), id?.friendly_name ?? '');
 
-	buf.put("!HHH", ATTR_ASSOC_STATE, 2, WPS_ASSOC_CONN_SUCCESS);
-	buf.put("!HHH", ATTR_CONFIG_ERROR, 2, WPS_CFG_NO_ERROR);
-	buf.put("!HHH", ATTR_DEV_PASSWORD_ID, 2, DEV_PW_PUSHBUTTON);
-	buf.put("!HHI", ATTR_OS_VERSION, 4, 0x80000001);
+		buf.put("!HHB", ATTR_RF_BANDS, 1, desiredConfiguration.band);
 
-	buf.put("!HH3sBBB", ATTR_VENDOR_EXTENSION, 6, WPS_VENDOR_ID_WFA,
-		WFA_ELEM_VERSION2, 1, WPS_VERSION);
+		buf.put("!HHH", ATTR_ASSOC_STATE, 2, WPS_ASSOC_CONN_SUCCESS);
+		buf.put("!HHH", ATTR_CONFIG_ERROR, 2, WPS_CFG_NO_ERROR);
+		buf.put("!HHH", ATTR_DEV_PASSWORD_ID, 2, DEV_PW_PUSHBUTTON);
+		buf.put("!HHI", ATTR_OS_VERSION, 4, 0x80000001);
 
-	let shared_secret = dh_sharedkey(local_privkey, m1_pubkey);
-	let dhkey = sha256(shared_secret);
-	let kdk = hmac_sha256(dhkey, m1_nonce + m1_mac_address + registrar_nonce);
-	let keys = derive_wps_keys(kdk, "Wi-Fi Easy and Secure Key Derivation", 80);
-	let authkey = substr(keys, 0, 32);
-	let keywrapkey = substr(keys, 32, 16);
+		buf.put("!HH3sBBB", ATTR_VENDOR_EXTENSION, 6, WPS_VENDOR_ID_WFA,
+			WFA_ELEM_VERSION2, 1, WPS_VERSION);
 
-	let plain_settings = build_plain_settings(desiredConfiguration);
-	let key_wrap_auth = substr(hmac_sha256(authkey, plain_settings), 0, 8);
-	let wrap_settings = buffer(plain_settings);
-	wrap_settings.end().put('!HH8s', ATTR_KEY_WRAP_AUTH, 8, key_wrap_auth);
+		let dhkey = sha256(shared_secret);
+		let kdk = hmac_sha256(dhkey, m1_nonce + m1_mac_address + registrar_nonce);
+		let keys = derive_wps_keys(kdk, "Wi-Fi Easy and Secure Key Derivation", 80);
+		let authkey = substr(keys, 0, 32);
+		let keywrapkey = substr(keys, 32, 16);
 
-	let pad_bytes = 16 - (wrap_settings.length() % 16);
-	wrap_settings.set(pad_bytes, wrap_settings.pos(), wrap_settings.pos() + pad_bytes);
+		let plain_settings = build_plain_settings(desiredConfiguration);
+		let key_wrap_auth = substr(hmac_sha256(authkey, plain_settings), 0, 8);
+		let wrap_settings = buffer(plain_settings);
+		wrap_settings.end().put('!HH8s', ATTR_KEY_WRAP_AUTH, 8, key_wrap_auth);
 
-	let iv = readfile("/dev/urandom", 16);
-	let encrypted_settings = aes_encrypt(keywrapkey, iv, wrap_settings.pull());
-	buf.put("!HH*", ATTR_ENCR_SETTINGS, length(iv) + length(encrypted_settings), iv + encrypted_settings);
+		let pad_bytes = 16 - (wrap_settings.length() % 16);
+		wrap_settings.set(pad_bytes, wrap_settings.pos(), wrap_settings.pos() + pad_bytes);
 
-	let authenticator = hmac_sha256(authkey, m1 + buf.slice());
-	buf.put('!HH8s', ATTR_AUTHENTICATOR, 8, substr(authenticator, 0, 8));
+		let iv = readfile("/dev/urandom", 16);
+		let encrypted_settings = aes_encrypt(keywrapkey, iv, wrap_settings.pull());
+		buf.put("!HH*", ATTR_ENCR_SETTINGS, length(iv) + length(encrypted_settings), iv + encrypted_settings);
 
-	return buf.pull();
+		let authenticator = hmac_sha256(authkey, m1 + buf.slice());
+		buf.put('!HH8s', ATTR_AUTHENTICATOR, 8, substr(authenticator, 0, 8));
+
+		return buf.pull();
+	};
+
+	// Compute keypair and shared secret, synchronously if worker threads are unavailable
+	if (!callback) {
+		const keypair = dh_pooled_keypair();
+
+		return finish(keypair, keypair ? dh_sharedkey(keypair[0], m1_pubkey) : null);
+	}
+
+	const derive = function (keypair) {
+		if (!keypair)
+			return callback(finish(null, null));
+
+		if (!dh_sharedkey_async(keypair[0], m1_pubkey, (shared_secret) => callback(finish(keypair, shared_secret))))
+			callback(finish(keypair, dh_sharedkey(keypair[0], m1_pubkey)));
+	};
+
+	if (!dh_keypair_async((keypair) => { dh_refill_schedule(); derive(keypair); }))
+		derive(dh_pooled_keypair());
+
+	return true;
 };
 
-export function wscProcessM2(key, m1, m2) {
+// When a callback is given, the shared secret is derived by the crypto worker
+// threads and the resulting settings (or null) are passed to the callback.
+export function wscProcessM2(key, m1, m2, callback) {
 	// Extract necessary data from M1 && M2
 	let m1_nonce, m2_nonce, m2_pubkey, m2_encrypted_settings, m2_authenticator;
 	let msg = buffer(m1);
@@ -330,8 +391,10 @@ export function wscProcessM2(key, m1, m2) {
 			m1_nonce = msg.get("!16s");
 	}
 
-	if (!m1_nonce)
-		return log.warn("Incomplete M1 message received");
+	if (!m1_nonce) {
+		log.warn("Incomplete M1 message received");
+		return callback?.(null);
+	}
 
 	msg = buffer(m2);
 
@@ -370,75 +433,101 @@ export function wscProcessM2(key, m1, m2) {
 			msg.pos(msg.pos() + attr_len);
 	}
 
-	if (!m2_nonce || !m2_pubkey || !m2_encrypted_settings || !m2_authenticator)
-		return log.warn("Incomplete M2 message received");
-
-	// Compute shared secret
-	let shared_secret = dh_sharedkey(key.key, m2_pubkey);
+	if (!m2_nonce || !m2_pubkey || !m2_encrypted_settings || !m2_authenticator) {
+		log.warn("Incomplete M2 message received");
+		return callback?.(null);
+	}
 
-	// Derive keys
-	let dhkey = sha256(shared_secret);
-	let kdk = hmac_sha256(dhkey, m1_nonce + utils.ether_aton(key.mac) + m2_nonce);
-	let keys = derive_wps_keys(kdk, "Wi-Fi Easy and Secure Key Derivation", 80);
-	let authkey = substr(keys, 0, 32);
-	let keywrapkey = substr(keys, 32, 48);
-	//let emsk = substr(keys, 48, 80);
+	const finish = function (shared_secret) {
+		if (!shared_secret)
+			return log.warn('Unable to derive WSC shared secret');
+
+		// Derive keys
+		let dhkey = sha256(shared_secret);
+		let kdk = hmac_sha256(dhkey, m1_nonce + utils.ether_aton(key.mac) + m2_nonce);
+		let keys = derive_wps_keys(kdk, "Wi-Fi Easy and Secure Key Derivation", 80);
+		let authkey = substr(keys, 0, 32);
+		let keywrapkey = substr(keys, 32, 48);
+		//let emsk = substr(keys, 48, 80);
+
+		// Verify authenticator
+		let computed_authenticator = substr(hmac_sha256(authkey, m1 + substr(m2, 0, -12)), 0, 8);
+		if (computed_authenticator !== m2_authenticator)
+			return log.warn('WSC M2 message authentication failed');
+
+		// Decrypt and process encrypted settings
+		let iv = substr(m2_encrypted_settings, 0, 16);
+		let ciphertext = substr(m2_encrypted_settings, 16);
+		let decrypted_settings = aes_decrypt(keywrapkey, iv, ciphertext);
+
+		msg = buffer(decrypted_settings);
+
+		while (true) {
+			let attr_type = msg.get('!H');
+			let attr_len = msg.get('!H');
+
+			if (attr_type == null)
+				break;
+
+			if (attr_type == ATTR_SSID && attr_len > 0)
+				settings.ssid = msg.get(attr_len);
+			else if (attr_type == ATTR_AUTH_TYPE_FLAGS && attr_len == 2)
+				settings.authentication_types = msg.get('!H');
+			else if (attr_type == ATTR_ENCR_TYPE_FLAGS && attr_len == 2)
+				settings.encryption_types = msg.get('!H');
+			else if (attr_type == ATTR_NETWORK_KEY && attr_len > 0)
+				settings.network_key = msg.get(attr_len);
+			else if (attr_type == ATTR_MAC_ADDR && attr_len == 6)
+				settings.bssid = utils.ether_ntoa(msg.get(6));
+			else if (attr_type == ATTR_VENDOR_EXTENSION && attr_len >= 5) {
+				const oui = msg.get('3s');
+				const subattr_type = msg.get('B');
+				const subattr_len = msg.get('B');
+
+				if (oui == WPS_VENDOR_ID_WFA && subattr_type == WFA_ELEM_MULTI_AP && subattr_len == 1) {
+					const multi_ap_flags = msg.get('B');
+
+					settings.multi_ap = {
+						is_backhaul_sta: !!(multi_ap_flags & 0x1),
+						is_backhaul_bss: !!(multi_ap_flags & 0x2),
+						is_fronthaul_bss: !!(multi_ap_flags & 0x4),
+						tear_down: !!(multi_ap_flags & 0x8),
+						profile1_backhaul_sta_assoc_dissallowed: !!(multi_ap_flags & 0x10),
+						profile2_backhaul_sta_assoc_dissallowed: !!(multi_ap_flags & 0x20)
+					};
+				}
+				else {
+					msg.pos(msg.pos() + attr_len - 5);
+				}
+			}
+			else
+				msg.pos(msg.pos() + attr_len);
+		}
 
-	// Verify authenticator
-	let computed_authenticator = substr(hmac_sha256(authkey, m1 + substr(m2, 0, -12)), 0, 8);
-	if (computed_authenticator !== m2_authenticator)
-		return log.warn('WSC M2 message authentication failed');
+		return settings;
+	};
 
-	// Decrypt and process encrypted settings
-	let iv = substr(m2_encrypted_settings, 0, 16);
-	let ciphertext = substr(m2_encrypted_settings, 16);
-	let decrypted_settings = aes_decrypt(keywrapkey, iv, ciphertext);
+	// Compute shared secret, synchronously if worker threads are unavailable
+	if (!callback)
+		return finish(dh_sharedkey(key.key, m2_pubkey));
 
-	msg = buffer(decrypted_settings);
+	if (!dh_sharedkey_async(key.key, m2_pubkey, (shared_secret) => callback(finish(shared_secret))))
+		callback(finish(dh_sharedkey(key.key, m2_pubkey)));
 
-	while (true) {
-		let attr_type = msg.get('!H');
-		let attr_len = msg.get('!H');
+	return true;
+};
 
-		if (attr_type == null)
-			break;
+export function wscInit() {
+	if (!async_handle) {
+		const fd = async_init(CRYPTO_WORKER_THREADS);
 
-		if (attr_type == ATTR_SSID && attr_len > 0)
-			settings.ssid = msg.get(attr_len);
-		else if (attr_type == ATTR_AUTH_TYPE_FLAGS && attr_len == 2)
-			settings.authentication_types = msg.get('!H');
-		else if (attr_type == ATTR_ENCR_TYPE_FLAGS && attr_len == 2)
-			settings.encryption_types = msg.get('!H');
-		else if (attr_type == ATTR_NETWORK_KEY && attr_len > 0)
-			settings.network_key = msg.get(attr_len);
-		else if (attr_type == ATTR_MAC_ADDR && attr_len == 6)
-			settings.bssid = utils.ether_ntoa(msg.get(6));
-		else if (attr_type == ATTR_VENDOR_EXTENSION && attr_len >= 5) {
-			const oui = msg.get('3s');
-			const subattr_type = msg.get('B');
-			const subattr_len = msg.get('B');
-
-			if (oui == WPS_VENDOR_ID_WFA && subattr_type == WFA_ELEM_MULTI_AP && subattr_len == 1) {
-				const multi_ap_flags = msg.get('B');
-
-				settings.multi_ap = {
-					is_backhaul_sta: !!(multi_ap_flags & 0x1),
-					is_backhaul_bss: !!(multi_ap_flags & 0x2),
-					is_fronthaul_bss: !!(multi_ap_flags & 0x4),
-					tear_down: !!(multi_ap_flags & 0x8),
-					profile1_backhaul_sta_assoc_dissallowed: !!(multi_ap_flags & 0x10),
-					profile2_backhaul_sta_assoc_dissallowed: !!(multi_ap_flags & 0x20)
-				};
-			}
-			else {
-				msg.pos(msg.pos() + attr_len - 5);
-			}
-		}
+		if (fd != null)
+			async_handle = handle(fd, () => async_complete(), ULOOP_READ);
 		else
-			msg.pos(msg.pos() + attr_len);
+			log.warn('Unable to start crypto worker threads');
 	}
 
-	return settings;
+	dh_refill_schedule();
 };
 
 export function wscGetType(m) {